@@ -0,0 +1,66 @@
+#ifndef BENCHMARK_UTILS_H
+#define BENCHMARK_UTILS_H
+
+// ============================================================================
+// BENCHMARKUTILS.H - Tiny timing helpers shared by the benchmarks
+// ============================================================================
+// Deliberately dependency-free: std::chrono timing plus a sink that stops
+// the optimizer from deleting the work being measured.
+// ============================================================================
+
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+namespace bench {
+
+using Clock = std::chrono::steady_clock;
+
+// Results are folded in here so the compiler cannot discard them
+inline volatile uint64_t g_sink = 0;
+
+template <typename T>
+inline void consume(const T& value) {
+    g_sink = g_sink + static_cast<uint64_t>(value);
+}
+
+template <typename T>
+inline void consume(T* pointer) {
+    g_sink = g_sink + reinterpret_cast<uintptr_t>(pointer);
+}
+
+/**
+ * @brief Run fn once and return the elapsed wall time in nanoseconds
+ */
+template <typename Fn>
+inline double timeNs(Fn&& fn) {
+    auto start = Clock::now();
+    fn();
+    auto end = Clock::now();
+    return static_cast<double>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+}
+
+inline void printHeader(const std::string& title) {
+    std::cout << "\n================================================================\n";
+    std::cout << "  " << title << "\n";
+    std::cout << "================================================================\n";
+}
+
+/**
+ * @brief Print one result row: label, operation count, ns/op and Mops/s
+ */
+inline void printResult(const std::string& label, uint64_t ops, double totalNs) {
+    double nsPerOp = ops ? totalNs / static_cast<double>(ops) : 0.0;
+    double mopsPerSec = totalNs > 0 ? static_cast<double>(ops) * 1e3 / totalNs : 0.0;
+    std::cout << "  " << std::left << std::setw(40) << label
+              << std::right << std::setw(10) << ops << " ops"
+              << std::setw(12) << std::fixed << std::setprecision(1) << nsPerOp << " ns/op"
+              << std::setw(10) << std::setprecision(2) << mopsPerSec << " Mops/s\n";
+}
+
+} // namespace bench
+
+#endif // BENCHMARK_UTILS_H
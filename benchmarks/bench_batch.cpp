@@ -0,0 +1,113 @@
+// ============================================================================
+// BENCH_BATCH.CPP - One-at-a-time vs batched queue drain + matching
+// ============================================================================
+// Models a burst: BURST orders are already queued when the processor wakes
+// up (the generator -> processor path in main.cpp). The flow is 70% LIMIT
+// orders within 10 ticks of mid and 30% MARKET orders.
+//   single - popWithTimeout + processOrder per order (queue lock and book
+//            lock taken once per order)
+//   batch  - popBatch + processBatch (both locks taken once per batch)
+// ============================================================================
+
+#include "BenchmarkUtils.h"
+#include "MatchingEngine.h"
+#include "OrderQueue.h"
+#include "SpscOrderQueue.h"
+#include <random>
+#include <vector>
+
+using namespace orderbook;
+
+namespace {
+
+constexpr size_t BURST = 4096;
+constexpr size_t ROUNDS = 50;
+constexpr size_t MAX_BATCH = 64;
+constexpr Price MID = 100.0;
+
+std::vector<Order> makeFlow(size_t count) {
+    std::mt19937_64 rng(42);
+    std::vector<Order> flow;
+    flow.reserve(count);
+    for (OrderId id = 1; id <= count; ++id) {
+        Side side = (rng() % 2) ? Side::BUY : Side::SELL;
+        Quantity qty = 1 + static_cast<Quantity>(rng() % 100);
+        if (rng() % 10 < 3) {
+            flow.emplace_back(id, side, OrderType::MARKET, 0.0, qty);
+        } else {
+            int64_t ticks = static_cast<int64_t>(rng() % 10) - (side == Side::BUY ? 8 : 1);
+            flow.emplace_back(id, side, OrderType::LIMIT, MID + DEFAULT_TICK_SIZE * ticks, qty);
+        }
+    }
+    return flow;
+}
+
+void seedBook(OrderBook& book) {
+    OrderId id = 1u << 30;
+    for (int64_t i = 1; i <= 20; ++i) {
+        book.addOrder(Order(id++, Side::BUY, OrderType::LIMIT, MID - DEFAULT_TICK_SIZE * i, 1000));
+        book.addOrder(Order(id++, Side::SELL, OrderType::LIMIT, MID + DEFAULT_TICK_SIZE * i, 1000));
+    }
+}
+
+template <typename Queue>
+void runSingle(const char* label, const std::vector<Order>& flow) {
+    double totalNs = 0.0;
+    for (size_t round = 0; round < ROUNDS; ++round) {
+        Queue queue;
+        OrderBook book;
+        MatchingEngine engine(book);
+        seedBook(book);
+        for (const Order& order : flow) queue.push(order);
+
+        std::vector<Trade> trades;
+        trades.reserve(MAX_BATCH);
+        totalNs += bench::timeNs([&] {
+            for (size_t done = 0; done < flow.size(); ++done) {
+                auto order = queue.popWithTimeout(0);
+                engine.processOrder(*order, trades);
+                bench::consume(trades.size());
+            }
+        });
+    }
+    bench::printResult(label, BURST * ROUNDS, totalNs);
+}
+
+template <typename Queue>
+void runBatch(const char* label, const std::vector<Order>& flow) {
+    double totalNs = 0.0;
+    for (size_t round = 0; round < ROUNDS; ++round) {
+        Queue queue;
+        OrderBook book;
+        MatchingEngine engine(book);
+        seedBook(book);
+        for (const Order& order : flow) queue.push(order);
+
+        std::vector<Order> batch;
+        std::vector<Trade> trades;
+        batch.reserve(MAX_BATCH);
+        trades.reserve(MAX_BATCH * 4);
+        totalNs += bench::timeNs([&] {
+            for (size_t done = 0; done < flow.size();) {
+                done += queue.popBatch(batch, MAX_BATCH, 0);
+                engine.processBatch(batch, trades);
+                bench::consume(trades.size());
+            }
+        });
+    }
+    bench::printResult(label, BURST * ROUNDS, totalNs);
+}
+
+} // namespace
+
+int main() {
+    std::vector<Order> flow = makeFlow(BURST);
+
+    bench::printHeader("Burst drain - " + std::to_string(BURST) + " queued orders, batches of " +
+                       std::to_string(MAX_BATCH));
+    runSingle<OrderQueue>("OrderQueue     single", flow);
+    runBatch<OrderQueue>("OrderQueue     batch", flow);
+    runSingle<SpscOrderQueue>("SpscOrderQueue single", flow);
+    runBatch<SpscOrderQueue>("SpscOrderQueue batch", flow);
+    return 0;
+}
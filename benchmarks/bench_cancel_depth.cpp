@@ -0,0 +1,60 @@
+// ============================================================================
+// BENCH_CANCEL_DEPTH.CPP - Cancel latency vs queue depth at one price
+// ============================================================================
+// Puts N orders on a single bid level (N = 10 .. 100k) and cancels them in
+// random order. Each resting order carries its own queue links, so the
+// ns/op should stay flat as N grows instead of scaling with the queue.
+// ============================================================================
+
+#include "BenchmarkUtils.h"
+#include "OrderBook.h"
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <vector>
+
+using namespace orderbook;
+
+namespace {
+
+constexpr Price LEVEL_PRICE = 100.0;
+constexpr int ROUNDS = 5;
+
+void runDepth(const char* name, BookBackend backend, size_t depth) {
+    OrderBookConfig config;
+    config.backend = backend;
+
+    std::vector<OrderId> ids(depth);
+    std::iota(ids.begin(), ids.end(), 1);
+    std::mt19937_64 rng(42);
+
+    uint64_t ops = 0;
+    double totalNs = 0.0;
+    for (int round = 0; round < ROUNDS; ++round) {
+        OrderBook book(config);
+        for (OrderId id : ids) {
+            book.addOrder(Order(id, Side::BUY, OrderType::LIMIT, LEVEL_PRICE, 100));
+        }
+        std::shuffle(ids.begin(), ids.end(), rng);
+
+        totalNs += bench::timeNs([&] {
+            for (OrderId id : ids) {
+                bench::consume(book.cancelOrder(id));
+            }
+        });
+        ops += ids.size();
+    }
+
+    bench::printResult(std::string(name) + " depth " + std::to_string(depth), ops, totalNs);
+}
+
+} // namespace
+
+int main() {
+    bench::printHeader("Cancel latency - all orders at one price level");
+    for (size_t depth : {10u, 100u, 1000u, 10000u, 100000u}) {
+        runDepth("map ", BookBackend::MAP, depth);
+        runDepth("tick", BookBackend::TICK_ARRAY, depth);
+    }
+    return 0;
+}
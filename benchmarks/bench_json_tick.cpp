@@ -0,0 +1,145 @@
+// ============================================================================
+// BENCH_JSON_TICK.CPP - Time to encode one JSON tick message
+// ============================================================================
+// A full tick (15 levels/side, stats, 5 current candles, a trade) encoded:
+//   ostringstream   - the previous JsonBuilder approach, kept here as the
+//                     baseline: stats built as their own message, then
+//                     re-scanned and copied into the tick
+//   fresh string    - JsonWriter into a new std::string per tick
+//   reused frame    - JsonWriter into a recycled OutboundFrame (server path)
+// ============================================================================
+
+#include "BenchmarkUtils.h"
+#include "JsonBuilder.h"
+#include "OutboundFrame.h"
+#include <iomanip>
+#include <sstream>
+
+using namespace orderbook;
+
+namespace {
+
+constexpr int TICKS = 50000;
+
+// The stream-based encoding JsonBuilder used before JsonWriter
+std::string streamStats(const SessionStats& s) {
+    std::ostringstream ss;
+    ss << std::fixed << std::setprecision(2);
+    ss << R"({"type":"stats","data":{"symbol":")" << s.symbol << R"(","currentPrice":)" << s.currentPrice
+       << R"(,"openPrice":)" << s.openPrice << R"(,"highPrice":)" << s.highPrice
+       << R"(,"lowPrice":)" << s.lowPrice << R"(,"totalOrders":)" << s.totalOrders
+       << R"(,"totalTrades":)" << s.totalTrades << R"(,"totalVolume":)" << s.totalVolume
+       << R"(,"marketOrderPct":)" << s.marketOrderPct << R"(,"sentiment":")" << s.sentiment
+       << R"(","intensity":")" << s.intensity << R"(","spread":)" << s.spread
+       << R"(,"speed":)" << s.speed << R"(,"paused":)" << (s.paused ? "true" : "false")
+       << R"(,"newsShockEnabled":)" << (s.newsShockEnabled ? "true" : "false")
+       << R"(,"newsShockCooldown":)" << (s.newsShockCooldown ? "true" : "false")
+       << R"(,"newsShockCooldownRemaining":)" << s.newsShockCooldownRemaining
+       << R"(,"newsShockActiveRemaining":)" << s.newsShockActiveRemaining << "}}";
+    return ss.str();
+}
+
+void streamCandle(std::ostringstream& ss, const Candle& c) {
+    ss << R"({"timestamp":)" << c.timestamp << R"(,"open":)" << c.open << R"(,"high":)" << c.high
+       << R"(,"low":)" << c.low << R"(,"close":)" << c.close << R"(,"volume":)" << c.volume << "}";
+}
+
+std::string streamTick(const OrderBook& book, const std::string& statsJson, Price price, int volume,
+                       int64_t timestamp, const TradeData& trade, const std::map<int, Candle>& candles) {
+    size_t start = statsJson.find('{', statsJson.find("\"data\":") + 7);
+    std::string statsData = statsJson.substr(start, statsJson.rfind('}') - start);
+
+    BookSnapshot snap;
+    book.snapshot(JsonBuilder::BOOK_DEPTH, snap);
+
+    std::ostringstream ss;
+    ss << std::fixed << std::setprecision(2);
+    ss << R"({"type":"tick","data":{"orderbook":{"bids":[)";
+    for (size_t i = 0; i < snap.bidCount; ++i) {
+        ss << (i ? "," : "") << R"({"price":)" << snap.bids[i].price << R"(,"quantity":)" << snap.bids[i].quantity << "}";
+    }
+    ss << R"(],"asks":[)";
+    for (size_t i = 0; i < snap.askCount; ++i) {
+        ss << (i ? "," : "") << R"({"price":)" << snap.asks[i].price << R"(,"quantity":)" << snap.asks[i].quantity << "}";
+    }
+    ss << R"(],"bestBid":)" << snap.bestBid.value_or(Price()) << R"(,"bestAsk":)" << snap.bestAsk.value_or(Price())
+       << R"(,"spread":)" << snap.spread.value_or(Price()) << "},";
+    ss << R"("stats":)" << statsData << ",";
+    ss << R"("price":{"timestamp":)" << timestamp << R"(,"price":)" << price << R"(,"volume":)" << volume << "},";
+    ss << R"("currentCandles":{)";
+    bool first = true;
+    for (const auto& [tf, candle] : candles) {
+        ss << (first ? "" : ",") << "\"" << tf << "\":";
+        streamCandle(ss, candle);
+        first = false;
+    }
+    ss << R"(},"completedCandles":null,"trade":{"id":)" << trade.id << R"(,"price":)" << trade.price
+       << R"(,"quantity":)" << trade.quantity << R"(,"side":")" << trade.side
+       << R"(","timestamp":)" << trade.timestamp << "}}}";
+    return ss.str();
+}
+
+} // namespace
+
+int main() {
+    OrderBook book;
+    for (int i = 0; i < 15; ++i) {
+        book.addOrder(Order(i + 1, Side::BUY, OrderType::LIMIT, 179.95 - 0.05 * i, 100 + 7 * i));
+        book.addOrder(Order(i + 100, Side::SELL, OrderType::LIMIT, 180.05 + 0.05 * i, 120 + 5 * i));
+    }
+    std::map<int, Candle> candles;
+    for (int tf : {1, 5, 30, 60, 300}) candles[tf] = Candle(1700000000000, Price(180.0), 250);
+    std::vector<CompletedCandle> completed;
+
+    SessionStats stats;
+    stats.symbol = "AAPL";
+    stats.currentPrice = 180.0;
+    stats.openPrice = 178.5;
+    stats.highPrice = 181.25;
+    stats.lowPrice = 177.9;
+    stats.totalOrders = 123456;
+    stats.totalTrades = 23456;
+    stats.totalVolume = 3456789;
+    stats.marketOrderPct = 20;
+    stats.sentiment = "BULLISH";
+    stats.intensity = "NORMAL";
+    stats.spread = 0.10;
+    stats.speed = 1.0;
+    TradeData trade{42, Price(180.05), 30, "BUY", 1700000000000};
+
+    bench::printHeader("JSON tick encoding - 15 levels/side, 5 candles, trade");
+
+    double ns = bench::timeNs([&] {
+        for (int t = 0; t < TICKS; ++t) {
+            stats.totalOrders = 123456 + t;
+            std::string tick = streamTick(book, streamStats(stats), Price(180.0), 25,
+                                          1700000000000 + t, trade, candles);
+            bench::consume(tick.size());
+        }
+    });
+    bench::printResult("ostringstream (previous)", TICKS, ns);
+
+    ns = bench::timeNs([&] {
+        for (int t = 0; t < TICKS; ++t) {
+            stats.totalOrders = 123456 + t;
+            std::string tick = JsonBuilder::tickToJson(book, stats, Price(180.0), 25,
+                                                       1700000000000 + t, &trade, candles, completed);
+            bench::consume(tick.size());
+        }
+    });
+    bench::printResult("JsonWriter, fresh string", TICKS, ns);
+
+    FrameRef frame = FrameRef::create(false);
+    ns = bench::timeNs([&] {
+        for (int t = 0; t < TICKS; ++t) {
+            stats.totalOrders = 123456 + t;
+            frame->reset(false);
+            JsonBuilder::tickToJson(frame->buffer(), book, stats, Price(180.0), 25,
+                                    1700000000000 + t, &trade, candles, completed);
+            bench::consume(frame->size());
+        }
+    });
+    bench::printResult("JsonWriter, reused frame", TICKS, ns);
+    std::cout << "  tick size: " << frame->size() << " B\n";
+    return 0;
+}
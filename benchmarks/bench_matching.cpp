@@ -0,0 +1,118 @@
+// ============================================================================
+// BENCH_MATCHING.CPP - In-place matching vs the old copy-then-fill path
+// ============================================================================
+// A deep ask side (LEVELS levels of 100 shares) takes BUY LIMIT orders that
+// sweep 2.5 levels; the consumed quantity is re-added afterwards so every
+// iteration sees the same book.
+//   copy-then-fill - the previous MatchingEngine loop: copy the top 100 ask
+//                    levels, then lock the book once more per level filled
+//   processOrder   - MatchingEngine::processOrder (OrderBook::matchOrder)
+//   buffer+listener- the allocation-free overload with an inlined listener
+// ============================================================================
+
+#include "BenchmarkUtils.h"
+#include "MatchingEngine.h"
+#include <vector>
+
+using namespace orderbook;
+
+namespace {
+
+constexpr Price BEST_ASK = 100.0;
+constexpr Quantity LEVEL_QTY = 100;
+constexpr Quantity TAKER_QTY = 250;
+constexpr size_t ITERATIONS = 200000;
+
+Price levelPrice(size_t i) {
+    return BEST_ASK + DEFAULT_TICK_SIZE * static_cast<int64_t>(i);
+}
+
+void fillBook(OrderBook& book, size_t levels, OrderId& nextId) {
+    for (size_t i = 0; i < levels; ++i) {
+        book.addOrder(Order(nextId++, Side::SELL, OrderType::LIMIT, levelPrice(i), LEVEL_QTY));
+    }
+}
+
+// The pre-matchOrder engine loop, kept here for comparison
+struct CopyThenFill {
+    OrderBook& book;
+    explicit CopyThenFill(OrderBook& b) : book(b) {}
+
+    std::vector<Trade> operator()(Order& order) {
+        std::vector<Trade> trades;
+        auto asks = book.getTopAsks(100);
+        for (const auto& [price, qty] : asks) {
+            if (order.getRemainingQty() == 0 || price > order.getPrice()) break;
+            Quantity filled = book.fillQuantityAtPrice(Side::SELL, price,
+                                                       order.getRemainingQty());
+            if (filled == 0) continue;
+            order.fill(filled);
+
+            Trade trade;
+            trade.buyOrderId = order.getId();
+            trade.sellOrderId = 0;
+            trade.price = price;
+            trade.quantity = filled;
+            trade.timestamp = now();
+            trades.push_back(trade);
+        }
+        if (order.getRemainingQty() > 0) {
+            book.addOrder(order);
+        }
+        return trades;
+    }
+};
+
+struct InPlace {
+    MatchingEngine engine;
+    explicit InPlace(OrderBook& b) : engine(b) {}
+
+    std::vector<Trade> operator()(Order& order) { return engine.processOrder(order); }
+};
+
+struct InPlaceBuffer {
+    MatchingEngine engine;
+    std::vector<Trade> trades;
+    Quantity volume = 0;
+    explicit InPlaceBuffer(OrderBook& b) : engine(b) { trades.reserve(16); }
+
+    const std::vector<Trade>& operator()(Order& order) {
+        engine.processOrder(order, trades, [this](const Trade& t) { volume += t.quantity; });
+        return trades;
+    }
+};
+
+template<typename Matcher>
+void run(const char* label, size_t levels) {
+    OrderBook book;
+    Matcher match(book);
+    OrderId nextId = 1;
+    fillBook(book, levels, nextId);
+    Price limit = levelPrice(2);
+
+    double ns = bench::timeNs([&] {
+        for (size_t i = 0; i < ITERATIONS; ++i) {
+            Order taker(nextId++, Side::BUY, OrderType::LIMIT, limit, TAKER_QTY);
+            const std::vector<Trade>& trades = match(taker);
+            // Put back exactly what was taken so the book stays the same
+            for (const Trade& trade : trades) {
+                book.addOrder(Order(nextId++, Side::SELL, OrderType::LIMIT,
+                                    trade.price, trade.quantity));
+            }
+            bench::consume(trades.size());
+        }
+    });
+    bench::printResult(label, ITERATIONS, ns);
+}
+
+} // namespace
+
+int main() {
+    for (size_t levels : {10u, 100u, 1000u}) {
+        bench::printHeader("Matching - " + std::to_string(levels) + " ask levels, 2.5-level sweeps");
+        run<CopyThenFill>("copy-then-fill", levels);
+        run<InPlace>("processOrder  ", levels);
+        run<InPlaceBuffer>("buffer+listener", levels);
+    }
+    return 0;
+}
@@ -0,0 +1,107 @@
+// ============================================================================
+// BENCH_ORDER_INDEX.CPP - OrderIdIndex vs std::unordered_map
+// ============================================================================
+// Same workload on both containers, with ids that are sequential from a
+// base (like nextOrderId in main.cpp):
+//   insert - N sequential ids into an empty container
+//   hit    - look up every id in random order
+//   miss   - look up N ids that are not present
+//   erase  - erase every id in random order
+// ============================================================================
+
+#include "BenchmarkUtils.h"
+#include "OrderIdIndex.h"
+#include "PriceLevelIndex.h"
+#include <algorithm>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+using namespace orderbook;
+
+namespace {
+
+constexpr OrderId BASE_ID = 1000000;
+
+struct Workload {
+    std::vector<OrderId> ids;       // Sequential insert order
+    std::vector<OrderId> shuffled;  // Same ids, random order
+    std::vector<OrderId> missing;   // Ids never inserted
+    std::vector<RestingOrder> nodes;
+};
+
+Workload makeWorkload(size_t count) {
+    Workload w;
+    w.nodes.resize(count);
+    for (size_t i = 0; i < count; ++i) {
+        w.ids.push_back(BASE_ID + i);
+        w.missing.push_back(BASE_ID + count + i);
+    }
+    w.shuffled = w.ids;
+    std::mt19937_64 rng(42);
+    std::shuffle(w.shuffled.begin(), w.shuffled.end(), rng);
+    return w;
+}
+
+void runUnorderedMap(const Workload& w) {
+    size_t n = w.ids.size();
+    std::unordered_map<OrderId, const RestingOrder*> map;
+    map.reserve(n);
+
+    double ns = bench::timeNs([&] {
+        for (size_t i = 0; i < n; ++i) map.emplace(w.ids[i], &w.nodes[i]);
+    });
+    bench::printResult("unordered_map insert", n, ns);
+
+    ns = bench::timeNs([&] {
+        for (OrderId id : w.shuffled) bench::consume(map.find(id)->second);
+    });
+    bench::printResult("unordered_map hit", n, ns);
+
+    ns = bench::timeNs([&] {
+        for (OrderId id : w.missing) bench::consume(map.find(id) == map.end());
+    });
+    bench::printResult("unordered_map miss", n, ns);
+
+    ns = bench::timeNs([&] {
+        for (OrderId id : w.shuffled) bench::consume(map.erase(id));
+    });
+    bench::printResult("unordered_map erase", n, ns);
+}
+
+void runOrderIdIndex(Workload& w) {
+    size_t n = w.ids.size();
+    OrderIdIndex index(n);
+
+    double ns = bench::timeNs([&] {
+        for (size_t i = 0; i < n; ++i) index.insert(w.ids[i], &w.nodes[i]);
+    });
+    bench::printResult("OrderIdIndex  insert", n, ns);
+
+    ns = bench::timeNs([&] {
+        for (OrderId id : w.shuffled) bench::consume(index.find(id));
+    });
+    bench::printResult("OrderIdIndex  hit", n, ns);
+
+    ns = bench::timeNs([&] {
+        for (OrderId id : w.missing) bench::consume(index.find(id) == nullptr);
+    });
+    bench::printResult("OrderIdIndex  miss", n, ns);
+
+    ns = bench::timeNs([&] {
+        for (OrderId id : w.shuffled) bench::consume(index.erase(id));
+    });
+    bench::printResult("OrderIdIndex  erase", n, ns);
+}
+
+} // namespace
+
+int main() {
+    for (size_t count : {10000u, 100000u, 1000000u}) {
+        bench::printHeader("Order id index - " + std::to_string(count) + " sequential ids");
+        Workload w = makeWorkload(count);
+        runUnorderedMap(w);
+        runOrderIdIndex(w);
+    }
+    return 0;
+}
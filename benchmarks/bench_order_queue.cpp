@@ -0,0 +1,94 @@
+// ============================================================================
+// BENCH_ORDER_QUEUE.CPP - OrderQueue vs SpscOrderQueue hand-off
+// ============================================================================
+// One producer thread, one consumer thread (the generator -> processor
+// shape in main.cpp):
+//   throughput - producer pushes N orders back to back, consumer drains
+//   latency    - producer pushes one order every GAP_US microseconds with
+//                its push time as the id; the consumer records pop - push.
+//                A short gap keeps the SPSC consumer spinning, a long gap
+//                makes it park, so both wait paths are measured.
+// ============================================================================
+
+#include "BenchmarkUtils.h"
+#include "OrderQueue.h"
+#include "SpscOrderQueue.h"
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+using namespace orderbook;
+
+namespace {
+
+constexpr size_t THROUGHPUT_ORDERS = 1000000;
+constexpr size_t LATENCY_SAMPLES = 20000;
+
+uint64_t nowNs() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        bench::Clock::now().time_since_epoch()).count());
+}
+
+template <typename Queue>
+void runThroughput(const char* label) {
+    Queue queue;
+    double ns = bench::timeNs([&] {
+        std::thread producer([&queue] {
+            for (size_t i = 0; i < THROUGHPUT_ORDERS; ++i) {
+                queue.push(Order(i, Side::BUY, OrderType::LIMIT, 100.0, 100));
+            }
+        });
+        for (size_t received = 0; received < THROUGHPUT_ORDERS;) {
+            if (auto order = queue.popWithTimeout(1000)) {
+                bench::consume(order->getId());
+                received++;
+            }
+        }
+        producer.join();
+    });
+    bench::printResult(label, THROUGHPUT_ORDERS, ns);
+}
+
+template <typename Queue>
+void runLatency(const char* label, uint64_t gapUs) {
+    Queue queue;
+    std::vector<uint64_t> samples;
+    samples.reserve(LATENCY_SAMPLES);
+
+    std::thread producer([&queue, gapUs] {
+        for (size_t i = 0; i < LATENCY_SAMPLES; ++i) {
+            uint64_t due = nowNs() + gapUs * 1000;
+            while (nowNs() < due) {}  // Busy-wait so the gap is precise
+            queue.push(Order(nowNs(), Side::BUY, OrderType::LIMIT, 100.0, 100));
+        }
+    });
+    while (samples.size() < LATENCY_SAMPLES) {
+        if (auto order = queue.popWithTimeout(1000)) {
+            samples.push_back(nowNs() - order->getId());
+        }
+    }
+    producer.join();
+
+    std::sort(samples.begin(), samples.end());
+    auto pct = [&](double p) { return samples[static_cast<size_t>(p * (samples.size() - 1))]; };
+    std::cout << "  " << std::left << std::setw(40) << label << std::right
+              << "p50 " << std::setw(8) << pct(0.50) << " ns"
+              << "   p99 " << std::setw(8) << pct(0.99) << " ns"
+              << "   max " << std::setw(9) << samples.back() << " ns\n";
+}
+
+} // namespace
+
+int main() {
+    bench::printHeader("Order queue throughput - 1 producer, 1 consumer");
+    runThroughput<OrderQueue>("OrderQueue (mutex + condvar)");
+    runThroughput<SpscOrderQueue>("SpscOrderQueue");
+
+    for (uint64_t gapUs : {5u, 500u}) {
+        bench::printHeader("Order queue hand-off latency - one order every " +
+                           std::to_string(gapUs) + " us");
+        runLatency<OrderQueue>("OrderQueue (mutex + condvar)", gapUs);
+        runLatency<SpscOrderQueue>("SpscOrderQueue", gapUs);
+    }
+    return 0;
+}
@@ -0,0 +1,129 @@
+// ============================================================================
+// BENCH_ORDERBOOK.CPP - Map vs tick-array OrderBook backends
+// ============================================================================
+// For 10k, 100k and 1M resting orders spread over 1000 levels per side:
+//   add    - insert every order into an empty book
+//   cancel - cancel a random 10% of the resting orders
+//   churn  - steady state: cancel the oldest order, add a new one (pool reuse)
+//   fill   - repeatedly fill 100 shares at the best ask until it is empty
+// ============================================================================
+
+#include "BenchmarkUtils.h"
+#include "OrderBook.h"
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace orderbook;
+
+namespace {
+
+constexpr int LEVELS_PER_SIDE = 1000;
+constexpr Price TICK = 0.05;
+constexpr Price MID = 500.0;
+
+std::vector<Order> makeOrders(size_t count) {
+    std::vector<Order> orders;
+    orders.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        int level = static_cast<int>((i / 2) % LEVELS_PER_SIDE);
+        if (i % 2 == 0) {
+            orders.emplace_back(i + 1, Side::BUY, OrderType::LIMIT, MID - TICK * (level + 1), 100);
+        } else {
+            orders.emplace_back(i + 1, Side::SELL, OrderType::LIMIT, MID + TICK * (level + 1), 100);
+        }
+    }
+    return orders;
+}
+
+OrderBookConfig configFor(BookBackend backend, size_t orderCapacity) {
+    OrderBookConfig config;
+    config.backend = backend;
+    config.tickSize = TICK;
+    config.orderCapacity = orderCapacity;
+    return config;
+}
+
+void runBackend(const char* name, BookBackend backend, const std::vector<Order>& orders) {
+    std::string prefix = std::string(name) + " ";
+    OrderBookConfig config = configFor(backend, orders.size());
+
+    // ADD
+    {
+        OrderBook book(config);
+        double ns = bench::timeNs([&] {
+            for (const auto& order : orders) {
+                bench::consume(book.addOrder(order));
+            }
+        });
+        bench::printResult(prefix + "add", orders.size(), ns);
+    }
+
+    // CANCEL (random 10%)
+    {
+        OrderBook book(config);
+        for (const auto& order : orders) book.addOrder(order);
+
+        std::vector<OrderId> ids;
+        for (const auto& order : orders) ids.push_back(order.getId());
+        std::mt19937_64 rng(42);
+        std::shuffle(ids.begin(), ids.end(), rng);
+        ids.resize(ids.size() / 10);
+
+        double ns = bench::timeNs([&] {
+            for (OrderId id : ids) {
+                bench::consume(book.cancelOrder(id));
+            }
+        });
+        bench::printResult(prefix + "cancel", ids.size(), ns);
+    }
+
+    // CHURN (book stays full; every cancel is paired with an add)
+    {
+        OrderBook book(config);
+        for (const auto& order : orders) book.addOrder(order);
+        
+        OrderId nextId = orders.size() + 1;
+        OrderId oldestId = 1;
+        double ns = bench::timeNs([&] {
+            for (const auto& order : orders) {
+                bench::consume(book.cancelOrder(oldestId++));
+                bench::consume(book.addOrder(Order(nextId++, order.getSide(), OrderType::LIMIT,
+                                                   order.getPrice(), order.getQuantity())));
+            }
+        });
+        bench::printResult(prefix + "churn (cancel + add)", orders.size(), ns);
+        
+        auto pool = book.getPoolStats();
+        std::cout << "    pool: in use " << pool.inUse << ", high-water " << pool.highWater
+                  << ", capacity " << pool.capacity << ", slabs " << pool.slabs << "\n";
+    }
+    
+    // FILL (sweep the ask side from the top)
+    {
+        OrderBook book(config);
+        for (const auto& order : orders) book.addOrder(order);
+
+        uint64_t ops = 0;
+        double ns = bench::timeNs([&] {
+            while (auto bestAsk = book.getBestAsk()) {
+                bench::consume(book.fillQuantityAtPrice(Side::SELL, *bestAsk, 100));
+                ops++;
+            }
+        });
+        bench::printResult(prefix + "fill (best ask + fill)", ops, ns);
+    }
+}
+
+} // namespace
+
+int main() {
+    for (size_t count : {10000u, 100000u, 1000000u}) {
+        bench::printHeader("OrderBook backends - " + std::to_string(count) + " resting orders");
+        auto orders = makeOrders(count);
+        runBackend("map ", BookBackend::MAP, orders);
+        runBackend("tick", BookBackend::TICK_ARRAY, orders);
+    }
+    return 0;
+}
@@ -0,0 +1,99 @@
+// ============================================================================
+// BENCH_PRICE_ENGINE.CPP - Price model ticks per second on one core
+// ============================================================================
+// Per tick, a session needs its sentiment / intensity parameters and one
+// PriceEngine step:
+//   string lookup  - the previous path, kept here as the baseline: build
+//                    the wire names, then walk string-compare chains
+//   enum lookup    - constexpr tables indexed by the enums
+//   price step     - calculateNextPrice, cycling through all 30
+//                    sentiment x intensity combinations
+// ============================================================================
+
+#include "BenchmarkUtils.h"
+#include "PriceEngine.h"
+
+using namespace orderbook;
+
+namespace {
+
+constexpr int TICKS = 2000000;
+
+// The string-keyed lookups PriceEngine used before the tables
+SentimentParams legacySentimentParams(const std::string& sentiment) {
+    if (sentiment == "BULLISH") return SENTIMENT_PARAMS[0];
+    if (sentiment == "BEARISH") return SENTIMENT_PARAMS[1];
+    if (sentiment == "VOLATILE") return SENTIMENT_PARAMS[2];
+    if (sentiment == "SIDEWAYS") return SENTIMENT_PARAMS[3];
+    if (sentiment == "CHOPPY") return SENTIMENT_PARAMS[4];
+    return SENTIMENT_PARAMS[5];
+}
+
+double legacyIntensityMultiplier(const std::string& intensity) {
+    if (intensity == "MILD") return 0.4;
+    if (intensity == "MODERATE") return 0.7;
+    if (intensity == "AGGRESSIVE") return 1.0;
+    if (intensity == "EXTREME") return 1.25;
+    return 0.85;
+}
+
+double legacyVolumeMultiplier(const std::string& intensity) {
+    if (intensity == "MILD") return 0.5;
+    if (intensity == "MODERATE") return 0.8;
+    if (intensity == "AGGRESSIVE") return 1.2;
+    if (intensity == "EXTREME") return 1.5;
+    return 1.0;
+}
+
+Sentiment sentimentAt(int tick) { return static_cast<Sentiment>(tick % SENTIMENT_COUNT); }
+Intensity intensityAt(int tick) { return static_cast<Intensity>((tick / 7) % INTENSITY_COUNT); }
+
+void benchLookups() {
+    bench::printHeader("Parameter lookup per tick (sentiment + intensity)");
+
+    double ns = bench::timeNs([] {
+        for (int t = 0; t < TICKS; ++t) {
+            std::string sentiment(MarketSentimentController::getSentimentNameSimple(sentimentAt(t)));
+            std::string intensity(MarketSentimentController::getIntensityNameSimple(intensityAt(t)));
+            SentimentParams params = legacySentimentParams(sentiment);
+            bench::consume(params.baseVolatility * legacyIntensityMultiplier(intensity) *
+                           legacyVolumeMultiplier(intensity));
+        }
+    });
+    bench::printResult("string names + compare chains", TICKS, ns);
+
+    ns = bench::timeNs([] {
+        for (int t = 0; t < TICKS; ++t) {
+            const SentimentParams& params = getSentimentParams(sentimentAt(t));
+            bench::consume(params.baseVolatility * getIntensityMultiplier(intensityAt(t)) *
+                           getVolumeMultiplier(intensityAt(t)));
+        }
+    });
+    bench::printResult("constexpr enum tables", TICKS, ns);
+}
+
+void benchPriceStep() {
+    bench::printHeader("PriceEngine::calculateNextPrice");
+
+    FastRng rng(42);
+    PriceEngine engine(rng);
+    double price = 180.0;
+    double ns = bench::timeNs([&] {
+        for (int t = 0; t < TICKS; ++t) {
+            price = engine.calculateNextPrice(price, sentimentAt(t), intensityAt(t), false).newPrice;
+            if (price < 50.0 || price > 500.0) price = 180.0;
+        }
+    });
+    bench::consume(price);
+    bench::printResult("price step (all 30 conditions)", TICKS, ns);
+    std::cout << "  => " << std::fixed << std::setprecision(0)
+              << (static_cast<double>(TICKS) * 1e9 / ns) << " ticks/sec per core\n";
+}
+
+} // namespace
+
+int main() {
+    benchLookups();
+    benchPriceStep();
+    return 0;
+}
@@ -0,0 +1,103 @@
+// ============================================================================
+// BENCH_REGENERATE.CPP - Per-tick synthetic depth: rebuild vs in-place update
+// ============================================================================
+// Each session tick rewrites a 15-level-per-side synthetic book around the
+// current price. The price walks a tick at a time, and most levels keep
+// their size between ticks.
+//   rebuild  - clear() then addOrder() for all 30 levels (the old way)
+//   in-place - updateLevels() per side; only levels that moved are touched
+// Both run with and without change tracking, since a publisher that sends
+// deltas turns it on.
+// ============================================================================
+
+#include "BenchmarkUtils.h"
+#include "OrderBook.h"
+#include <array>
+#include <random>
+
+using namespace orderbook;
+
+namespace {
+
+constexpr int TICKS = 200000;
+constexpr int LEVELS = 15;
+constexpr double REDRAW_PROBABILITY = 0.3;
+
+enum class Mode { REBUILD, IN_PLACE };
+
+// One tick's target depth per side, produced the same way for both modes
+struct Targets {
+    std::array<BookSnapshot::Level, LEVELS> bids;
+    std::array<BookSnapshot::Level, LEVELS> asks;
+};
+
+void run(Mode mode, bool tracking) {
+    OrderBookConfig config;
+    config.trackLevelChanges = tracking;
+    OrderBook book(config);
+
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int> qty(10, 500);
+    std::uniform_int_distribution<int> step(-1, 1);
+    std::uniform_real_distribution<double> prob(0.0, 1.0);
+
+    // Quantity per price tick, persisting across ticks like the live book
+    std::array<Quantity, 4096> sizes{};
+    int64_t mid = 2048;
+    Targets targets;
+    OrderId nextId = 1;
+    std::vector<LevelChange> changes;
+
+    auto buildTargets = [&] {
+        for (int i = 0; i < LEVELS; ++i) {
+            for (int64_t tick : {mid - 1 - i, mid + 1 + i}) {
+                if (sizes[tick] == 0 || prob(gen) < REDRAW_PROBABILITY) {
+                    sizes[tick] = static_cast<Quantity>(qty(gen));
+                }
+            }
+            targets.bids[i] = {Price::fromRaw((mid - 1 - i) * 500), sizes[mid - 1 - i]};
+            targets.asks[i] = {Price::fromRaw((mid + 1 + i) * 500), sizes[mid + 1 + i]};
+        }
+    };
+
+    double ns = bench::timeNs([&] {
+        for (int t = 0; t < TICKS; ++t) {
+            mid += step(gen);
+            if (mid < 100 || mid > 4000) mid = 2048;
+            buildTargets();
+
+            if (mode == Mode::REBUILD) {
+                book.clear();
+                for (int i = 0; i < LEVELS; ++i) {
+                    book.addOrder(Order(nextId++, Side::BUY, OrderType::LIMIT,
+                                        targets.bids[i].price, targets.bids[i].quantity));
+                    book.addOrder(Order(nextId++, Side::SELL, OrderType::LIMIT,
+                                        targets.asks[i].price, targets.asks[i].quantity));
+                }
+            } else {
+                book.updateLevels(Side::BUY, targets.bids.data(), LEVELS, nextId);
+                book.updateLevels(Side::SELL, targets.asks.data(), LEVELS, nextId);
+            }
+
+            if (tracking) {
+                book.takeLevelChanges(changes);
+                bench::consume(changes.size());
+            }
+        }
+    });
+
+    std::string label = std::string(mode == Mode::REBUILD ? "rebuild " : "in-place") +
+                        (tracking ? " + change set" : "");
+    bench::printResult(label, TICKS, ns);
+}
+
+} // namespace
+
+int main() {
+    bench::printHeader("Synthetic depth refresh - 15 levels/side, 200k ticks");
+    run(Mode::REBUILD, false);
+    run(Mode::IN_PLACE, false);
+    run(Mode::REBUILD, true);
+    run(Mode::IN_PLACE, true);
+    return 0;
+}
@@ -0,0 +1,113 @@
+// ============================================================================
+// BENCH_SESSION_TICK.CPP - Tick latency with 100+ sessions, by generator use
+// ============================================================================
+// Steps real SessionStates the way stepSession does (price step, candles,
+// in-place depth refresh, JSON tick) on one thread, and varies only where
+// the depth generator comes from:
+//   per tick + mt19937  - the previous path, kept here as the baseline: a
+//                         SentimentOrderGenerator built every tick, seeding
+//                         its own std::mt19937 from std::random_device
+//   per tick            - built every tick on the session's FastRng
+//   session member      - SessionState::getOrderGenerator(), built once
+// Reported per session count: average and worst time to step every session
+// once, and the average per session.
+// ============================================================================
+
+#include "BenchmarkUtils.h"
+#include "JsonBuilder.h"
+#include "SessionState.h"
+#include "TickDeadline.h"
+#include <memory>
+#include <random>
+
+using namespace orderbook;
+
+namespace {
+
+constexpr int TICKS = 200;
+
+enum class GeneratorUse { PER_TICK_MT19937, PER_TICK, MEMBER };
+
+void stepSession(SessionState& session, GeneratorUse use, int64_t timestamp) {
+    PriceResult result = session.getPriceEngine().calculateNextPrice(
+        session.getCurrentPrice(), session.getSentiment(), session.getIntensity(), false);
+    session.setCurrentPrice(result.newPrice);
+    double price = session.getCurrentPrice();
+    auto completed = session.getCandleManager().updateCandles(price, 25, timestamp);
+
+    switch (use) {
+        case GeneratorUse::PER_TICK_MT19937: {
+            std::random_device device;
+            std::mt19937 gen(device());
+            bench::consume(gen());
+            SentimentOrderGenerator generator(session.getSentimentController(), session.getRng());
+            generator.refreshOrderBook(session.getOrderBook(), price, session.getSpread());
+            break;
+        }
+        case GeneratorUse::PER_TICK: {
+            SentimentOrderGenerator generator(session.getSentimentController(), session.getRng());
+            generator.refreshOrderBook(session.getOrderBook(), price, session.getSpread());
+            break;
+        }
+        case GeneratorUse::MEMBER:
+            session.getOrderGenerator().refreshOrderBook(session.getOrderBook(), price,
+                                                         session.getSpread());
+            break;
+    }
+
+    SessionStats stats;
+    stats.symbol = session.getSymbol();
+    stats.currentPrice = price;
+    stats.spread = session.getSpread();
+    stats.speed = session.getSpeed();
+
+    BookFrame frame;
+    bool delta = session.nextBookFrame(frame);
+    FrameRef tick = session.acquireTickFrame(false);
+    JsonBuilder::tickToJson(tick->buffer(), session.getOrderBook(), stats, price, 25, timestamp,
+                            nullptr, session.getCandleManager().getCurrentCandles(), completed,
+                            delta ? &frame : nullptr);
+    bench::consume(tick->buffer().size());
+}
+
+void run(size_t sessionCount, GeneratorUse use, const char* label) {
+    std::vector<std::unique_ptr<SessionState>> sessions;
+    for (size_t i = 0; i < sessionCount; ++i) {
+        SessionConfig config;
+        config.basePrice = 180.0;
+        config.seed = FastRng::deriveSeed(42, i + 1);
+        config.sentiment = static_cast<Sentiment>(i % SENTIMENT_COUNT);
+        sessions.push_back(std::make_unique<SessionState>(static_cast<uint32_t>(i + 1), config));
+    }
+
+    TickDeadline deadline(std::chrono::milliseconds(50));
+    int64_t timestamp = 1700000000000;
+    for (int t = 0; t < TICKS; ++t) {
+        timestamp += 50;
+        auto start = bench::Clock::now();
+        for (auto& session : sessions) {
+            stepSession(*session, use, timestamp);
+        }
+        deadline.record(bench::Clock::now() - start, sessions.size());
+    }
+
+    TickDeadlineStats stats = deadline.window();
+    std::cout << "  " << std::left << std::setw(5) << sessionCount << " " << std::setw(20) << label
+              << std::right << std::fixed << std::setprecision(3)
+              << "   avg " << std::setw(7) << stats.avgMs << " ms"
+              << "   max " << std::setw(7) << stats.maxMs << " ms"
+              << "   " << std::setprecision(2) << std::setw(6)
+              << stats.avgMs * 1000.0 / static_cast<double>(sessionCount) << " us/session\n";
+}
+
+} // namespace
+
+int main() {
+    bench::printHeader("Tick latency - one thread steps every session once");
+    for (size_t sessions : {100, 300, 1000}) {
+        run(sessions, GeneratorUse::PER_TICK_MT19937, "per tick + mt19937");
+        run(sessions, GeneratorUse::PER_TICK, "per tick");
+        run(sessions, GeneratorUse::MEMBER, "session member");
+    }
+    return 0;
+}
@@ -0,0 +1,107 @@
+// ============================================================================
+// BENCH_TICK_BYTES.CPP - Tick message size: full book vs delta, JSON vs binary
+// ============================================================================
+// Replays a session the way the server loop drives it (price walk, in-place
+// depth refresh, stats, candles) and encodes every tick in each combination:
+//   full  - the top 15 levels per side every tick (the original format)
+//   delta - level changes, with a snapshot every 200 ticks
+//   json / binary - JsonBuilder text vs BinaryEncoder frames
+// Reported: time per tick (refresh + encode), average bytes per tick, and
+// for JSON the bytes of the book payload alone.
+// ============================================================================
+
+#include "BenchmarkUtils.h"
+#include "BinaryEncoder.h"
+#include "JsonBuilder.h"
+#include "SessionState.h"
+#include <random>
+
+using namespace orderbook;
+
+namespace {
+
+constexpr int TICKS = 20000;
+
+// Size of the book part alone ("orderbook":{...} or "book":{...})
+size_t bookBytes(const std::string& tick) {
+    size_t start = tick.find(R"("orderbook":{)");
+    if (start == std::string::npos) start = tick.find(R"("book":{)");
+    size_t end = tick.find(R"(,"stats":)", start);
+    return end - start;
+}
+
+void run(BookFeedMode mode, WireFormat format) {
+    SessionState session(1);
+    session.setBookFeedMode(mode);
+    std::mt19937 gen(7);
+    std::uniform_int_distribution<int> step(-2, 2);
+
+    double price = 150.0;
+    int64_t timestamp = 1700000000000;
+    size_t tickBytesTotal = 0;
+    size_t bookBytesTotal = 0;
+
+    double ns = bench::timeNs([&] {
+        for (int t = 0; t < TICKS; ++t) {
+            price = std::max(101.0, price + 0.05 * step(gen));
+            timestamp += 50;
+            session.setCurrentPrice(price);
+            auto completed = session.getCandleManager().updateCandles(Price(price), 25, timestamp);
+
+            session.getOrderGenerator().refreshOrderBook(session.getOrderBook(), price, session.getSpread());
+
+            SessionStats stats;
+            stats.symbol = session.getSymbol();
+            stats.currentPrice = price;
+            stats.openPrice = session.getOpenPrice();
+            stats.highPrice = session.getHighPrice();
+            stats.lowPrice = session.getLowPrice();
+            stats.totalOrders = 1000 + t;
+            stats.totalTrades = 300 + t / 3;
+            stats.totalVolume = 25 * t;
+            stats.marketOrderPct = 20;
+            stats.sentiment = "NEUTRAL";
+            stats.intensity = "NORMAL";
+            stats.spread = session.getSpread();
+            stats.speed = session.getSpeed();
+
+            BookFrame frame;
+            bool delta = session.nextBookFrame(frame);
+            if (format == WireFormat::BINARY) {
+                std::string tick = BinaryEncoder::tick(
+                    session.getOrderBook(), stats, price, 25, timestamp, nullptr,
+                    session.getCandleManager().getCurrentCandles(), completed,
+                    delta ? &frame : nullptr);
+                tickBytesTotal += tick.size();
+            } else {
+                std::string tick = JsonBuilder::tickToJson(
+                    session.getOrderBook(), stats, price, 25, timestamp,
+                    nullptr, session.getCandleManager().getCurrentCandles(), completed,
+                    delta ? &frame : nullptr);
+                tickBytesTotal += tick.size();
+                bookBytesTotal += bookBytes(tick);
+            }
+        }
+    });
+
+    std::string label = std::string(mode == BookFeedMode::FULL ? "full " : "delta") +
+                        (format == WireFormat::BINARY ? " binary" : " json  ");
+    bench::printResult(label + " (refresh + encode)", TICKS, ns);
+    std::cout << "  " << std::left << std::setw(40) << ("  " + label + " bytes/tick") << std::right
+              << std::setw(10) << tickBytesTotal / TICKS << " B";
+    if (format == WireFormat::JSON) {
+        std::cout << std::setw(12) << bookBytesTotal / TICKS << " B book";
+    }
+    std::cout << "\n";
+}
+
+} // namespace
+
+int main() {
+    bench::printHeader("Tick message size - 15 levels/side, 20k ticks");
+    for (WireFormat format : {WireFormat::JSON, WireFormat::BINARY}) {
+        run(BookFeedMode::FULL, format);
+        run(BookFeedMode::DELTA, format);
+    }
+    return 0;
+}
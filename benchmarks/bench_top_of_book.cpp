@@ -0,0 +1,91 @@
+// ============================================================================
+// BENCH_TOP_OF_BOOK.CPP - Top-of-book polling: book mutex vs seqlock
+// ============================================================================
+// One writer thread churns the book (add + cancel near the touch, which
+// moves the best prices); 1-8 reader threads poll the best bid/ask as fast
+// as they can for a fixed time.
+//   locked   - readers call OrderBook::snapshot(0, ...), taking m_mutex
+//   seqlock  - readers call OrderBook::getTopOfBook(), taking no lock
+// Reported: writer ops/s (how much polling slows matching down) and total
+// reader polls/s.
+// ============================================================================
+
+#include "BenchmarkUtils.h"
+#include "OrderBook.h"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace orderbook;
+
+namespace {
+
+constexpr auto RUN_TIME = std::chrono::milliseconds(300);
+
+enum class ReadMode { LOCKED, SEQLOCK };
+
+void run(ReadMode mode, int readers) {
+    OrderBook book;
+    for (int64_t i = 1; i <= 20; ++i) {
+        book.addOrder(Order(i, Side::BUY, OrderType::LIMIT, 100.0 - 0.05 * i, 100));
+        book.addOrder(Order(100 + i, Side::SELL, OrderType::LIMIT, 100.0 + 0.05 * i, 100));
+    }
+
+    std::atomic<bool> stop{false};
+    std::atomic<uint64_t> polls{0};
+    uint64_t writes = 0;
+
+    std::vector<std::thread> threads;
+    for (int r = 0; r < readers; ++r) {
+        threads.emplace_back([&] {
+            uint64_t local = 0;
+            BookSnapshot snap;
+            while (!stop.load(std::memory_order_relaxed)) {
+                if (mode == ReadMode::LOCKED) {
+                    book.snapshot(0, snap);
+                    bench::consume(snap.bestBid ? snap.bestBid->raw() : 0);
+                } else {
+                    bench::consume(book.getTopOfBook().bestBid.raw());
+                }
+                local++;
+            }
+            polls += local;
+        });
+    }
+
+    double ns = bench::timeNs([&] {
+        auto end = bench::Clock::now() + RUN_TIME;
+        OrderId id = 1000;
+        while (bench::Clock::now() < end) {
+            for (int i = 0; i < 64; ++i, ++id) {
+                Side side = (id & 1) ? Side::BUY : Side::SELL;
+                Price price = side == Side::BUY ? Price(100.0) : Price(100.05);
+                book.addOrder(Order(id, side, OrderType::LIMIT, price, 10));
+                book.cancelOrder(id);
+                writes += 2;
+            }
+        }
+        stop = true;
+    });
+    for (auto& t : threads) t.join();
+
+    std::string label = std::string(mode == ReadMode::LOCKED ? "locked " : "seqlock") +
+                        " writer, " + std::to_string(readers) + " reader(s)";
+    bench::printResult(label, writes, ns);
+    std::cout << "  " << std::left << std::setw(40) << "  reader polls" << std::right
+              << std::setw(10) << polls.load() << " polls"
+              << std::setw(11) << std::fixed << std::setprecision(2)
+              << static_cast<double>(polls.load()) * 1e3 / ns << " Mpolls/s\n";
+}
+
+} // namespace
+
+int main() {
+    bench::printHeader("Top of book - 1 writer, N polling readers (" +
+                       std::to_string(std::thread::hardware_concurrency()) + " CPUs)");
+    for (int readers : {1, 2, 4, 8}) {
+        run(ReadMode::LOCKED, readers);
+        run(ReadMode::SEQLOCK, readers);
+    }
+    return 0;
+}
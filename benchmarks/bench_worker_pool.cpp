@@ -0,0 +1,114 @@
+// ============================================================================
+// BENCH_WORKER_POOL.CPP - Tick latency: sessions stepped serially vs pooled
+// ============================================================================
+// Each simulated session does what a tick does to it: walk its 15-level
+// synthetic book (updateLevels) and encode a JSON tick into its frame.
+// Every 8th session is four times as expensive, the way busy sessions are,
+// so the pooled runs also exercise work stealing. Reported per worker
+// count: average and worst tick, and ticks over the 50ms budget.
+// ============================================================================
+
+#include "BenchmarkUtils.h"
+#include "JsonBuilder.h"
+#include "TickDeadline.h"
+#include "WorkerPool.h"
+#include <array>
+#include <memory>
+#include <random>
+#include <thread>
+
+using namespace orderbook;
+
+namespace {
+
+constexpr int TICKS = 40;
+constexpr int LEVELS = 15;
+
+// The per-session state a tick touches
+struct BenchSession {
+    explicit BenchSession(uint32_t seed) : gen(seed) {}
+
+    OrderBook book;
+    std::mt19937 gen;
+    int64_t mid = 3600;  // In ticks ($180.00)
+    OrderId nextId = 1;
+    std::string frame;
+    SessionStats stats;
+    std::map<int, Candle> candles;
+    std::vector<CompletedCandle> completed;
+
+    void step(int64_t timestamp) {
+        std::uniform_int_distribution<int> walk(-1, 1);
+        std::uniform_int_distribution<int> qty(10, 500);
+        mid += walk(gen);
+
+        std::array<BookSnapshot::Level, LEVELS> levels;
+        for (int i = 0; i < LEVELS; ++i) {
+            levels[i] = {DEFAULT_TICK_SIZE * (mid - 1 - i), static_cast<Quantity>(qty(gen))};
+        }
+        book.updateLevels(Side::BUY, levels.data(), LEVELS, nextId);
+        for (int i = 0; i < LEVELS; ++i) {
+            levels[i] = {DEFAULT_TICK_SIZE * (mid + 1 + i), static_cast<Quantity>(qty(gen))};
+        }
+        book.updateLevels(Side::SELL, levels.data(), LEVELS, nextId);
+
+        frame.clear();
+        stats.currentPrice = (DEFAULT_TICK_SIZE * mid).toDouble();
+        JsonBuilder::tickToJson(frame, book, stats, DEFAULT_TICK_SIZE * mid, 25,
+                                timestamp, nullptr, candles, completed);
+    }
+};
+
+void runTicks(size_t sessionCount, size_t workers) {
+    std::vector<std::unique_ptr<BenchSession>> sessions;
+    for (size_t i = 0; i < sessionCount; ++i) {
+        sessions.push_back(std::make_unique<BenchSession>(static_cast<uint32_t>(i + 1)));
+        sessions.back()->stats.symbol = "AAPL";
+        for (int tf : {1, 5, 30, 60, 300}) {
+            sessions.back()->candles[tf] = Candle(1700000000000, Price(180.0), 250);
+        }
+    }
+
+    WorkerPool pool(workers);
+    TickDeadline deadline(std::chrono::milliseconds(50));
+    for (int t = 0; t < TICKS; ++t) {
+        auto start = bench::Clock::now();
+        pool.run(sessions.size(), [&](size_t i) {
+            int repeats = (i % 8 == 0) ? 4 : 1;  // Uneven session cost
+            for (int r = 0; r < repeats; ++r) {
+                sessions[i]->step(1700000000000 + t);
+            }
+        });
+        deadline.record(bench::Clock::now() - start, sessions.size());
+    }
+    for (const auto& session : sessions) {
+        bench::consume(session->frame.size());
+    }
+
+    TickDeadlineStats stats = deadline.window();
+    std::cout << "  " << std::left << std::setw(6) << sessionCount << " sessions, "
+              << std::setw(2) << pool.size() << " workers" << std::right
+              << std::fixed << std::setprecision(2)
+              << "   avg " << std::setw(8) << stats.avgMs << " ms"
+              << "   max " << std::setw(8) << stats.maxMs << " ms"
+              << "   over 50ms " << stats.overruns << "/" << stats.ticks
+              << "   steals " << pool.getStats().steals << "\n";
+}
+
+} // namespace
+
+int main() {
+    size_t cores = std::max(1u, std::thread::hardware_concurrency());
+    bench::printHeader("Tick latency - session stepping on a worker pool (" +
+                       std::to_string(cores) + " cores)");
+
+    std::vector<size_t> workerCounts = {1, 2, 4};
+    if (cores > 4) workerCounts.push_back(cores);
+
+    for (size_t sessions : {100, 300, 1000}) {
+        for (size_t workers : workerCounts) {
+            runTicks(sessions, workers);
+        }
+    }
+    return 0;
+}
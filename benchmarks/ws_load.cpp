@@ -0,0 +1,267 @@
+// ============================================================================
+// WS_LOAD.CPP - WebSocket load generator for the simulation server
+// ============================================================================
+// Opens many client sessions against a running server, starts each one and
+// counts what comes back. Run it against the server at different
+// --ws-threads settings to see how clients and msgs/sec scale:
+//
+//   ./orderbook --headless --ws-threads 4 &
+//   ./bin/ws_load --clients 500 --threads 4 --duration 30
+//
+// Clients are spread over --threads client contexts, each serviced by its
+// own thread, so the load generator is not the bottleneck.
+// Only built when libwebsockets is available.
+// ============================================================================
+
+#include <libwebsockets.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstdint>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <functional>
+#include <vector>
+
+namespace {
+
+struct LoadOptions {
+    std::string host = "127.0.0.1";
+    int port = 8080;
+    int clients = 100;
+    int threads = 1;
+    int durationSec = 20;
+    bool binary = false;
+};
+
+// Counters for one client context (reached through lws_context_user)
+struct LoadContext {
+    const LoadOptions* options = nullptr;
+    std::atomic<uint64_t> messages{0};
+    std::atomic<uint64_t> bytes{0};
+    std::atomic<int> connected{0};
+    std::atomic<int> failed{0};
+    std::atomic<int> closed{0};
+};
+
+// Per-connection state
+struct ClientSession {
+    int commandsSent;
+};
+
+// ============================================================================
+// CLIENT CALLBACK
+// ============================================================================
+
+int loadCallback(struct lws* wsi, enum lws_callback_reasons reason,
+                 void* user, void* in, size_t len) {
+    (void)in;
+    ClientSession* session = static_cast<ClientSession*>(user);
+    struct lws_context* context = lws_get_context(wsi);
+    LoadContext* load = context ? static_cast<LoadContext*>(lws_context_user(context)) : nullptr;
+    if (!load) return 0;
+
+    switch (reason) {
+        case LWS_CALLBACK_CLIENT_ESTABLISHED:
+            session->commandsSent = 0;
+            load->connected++;
+            lws_callback_on_writable(wsi);
+            break;
+
+        case LWS_CALLBACK_CLIENT_WRITEABLE: {
+            // Pick the encoding first, then start the session
+            std::vector<std::string> commands;
+            if (load->options->binary) {
+                commands.emplace_back(R"({"type":"encoding","value":"binary"})");
+            }
+            commands.emplace_back(R"({"type":"start"})");
+            if (session->commandsSent >= static_cast<int>(commands.size())) break;
+
+            const std::string& command = commands[session->commandsSent++];
+            std::vector<unsigned char> buffer(LWS_PRE + command.size());
+            memcpy(buffer.data() + LWS_PRE, command.data(), command.size());
+            if (lws_write(wsi, buffer.data() + LWS_PRE, command.size(), LWS_WRITE_TEXT) < 0) {
+                return -1;
+            }
+            if (session->commandsSent < static_cast<int>(commands.size())) {
+                lws_callback_on_writable(wsi);
+            }
+            break;
+        }
+
+        case LWS_CALLBACK_CLIENT_RECEIVE:
+            load->bytes += len;
+            if (lws_is_final_fragment(wsi)) {
+                load->messages++;
+            }
+            break;
+
+        case LWS_CALLBACK_CLIENT_CONNECTION_ERROR:
+            load->failed++;
+            break;
+
+        case LWS_CALLBACK_CLIENT_CLOSED:
+            load->connected--;
+            load->closed++;
+            break;
+
+        default:
+            break;
+    }
+    return 0;
+}
+
+const struct lws_protocols loadProtocols[] = {
+    {
+        "lws-minimal",  // Must match the server's protocol name
+        loadCallback,
+        sizeof(ClientSession),
+        65536,
+        0, NULL, 0
+    },
+    {
+        NULL, NULL, 0, 0, 0, NULL, 0  // Terminator
+    }
+};
+
+// ============================================================================
+// CLIENT CONTEXT THREAD
+// ============================================================================
+
+void runContext(LoadContext& load, int clients, const std::atomic<bool>& running) {
+    struct lws_context_creation_info info;
+    memset(&info, 0, sizeof(info));
+    info.port = CONTEXT_PORT_NO_LISTEN;
+    info.protocols = loadProtocols;
+    info.gid = -1;
+    info.uid = -1;
+    info.user = &load;
+
+    struct lws_context* context = lws_create_context(&info);
+    if (!context) {
+        std::cerr << "[ws_load] Failed to create client context\n";
+        load.failed += clients;
+        return;
+    }
+
+    const LoadOptions& options = *load.options;
+    for (int i = 0; i < clients; ++i) {
+        struct lws_client_connect_info connect;
+        memset(&connect, 0, sizeof(connect));
+        connect.context = context;
+        connect.address = options.host.c_str();
+        connect.port = options.port;
+        connect.path = "/";
+        connect.host = options.host.c_str();
+        connect.origin = options.host.c_str();
+        connect.protocol = loadProtocols[0].name;
+        if (!lws_client_connect_via_info(&connect)) {
+            load.failed++;
+        }
+    }
+
+    while (running) {
+        lws_service(context, 50);
+    }
+    lws_context_destroy(context);
+}
+
+void printUsage(const char* program) {
+    std::cout << "Usage: " << program << " [options]\n"
+              << "  --host <addr>       Server address (default: 127.0.0.1)\n"
+              << "  --port <n>          Server port (default: 8080)\n"
+              << "  --clients <n>       Concurrent sessions (default: 100)\n"
+              << "  --threads <n>       Client contexts/threads (default: 1)\n"
+              << "  --duration <sec>    Measurement time (default: 20)\n"
+              << "  --binary            Request binary tick encoding\n";
+}
+
+} // namespace
+
+// ============================================================================
+// MAIN
+// ============================================================================
+
+int main(int argc, char* argv[]) {
+    LoadOptions options;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--host" && i + 1 < argc) options.host = argv[++i];
+        else if (arg == "--port" && i + 1 < argc) options.port = std::atoi(argv[++i]);
+        else if (arg == "--clients" && i + 1 < argc) options.clients = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "--threads" && i + 1 < argc) options.threads = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "--duration" && i + 1 < argc) options.durationSec = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "--binary") options.binary = true;
+        else {
+            printUsage(argv[0]);
+            return arg == "--help" || arg == "-h" ? 0 : 1;
+        }
+    }
+    options.threads = std::min(options.threads, options.clients);
+    lws_set_log_level(LLL_ERR | LLL_WARN, NULL);
+
+    std::vector<LoadContext> contexts(options.threads);
+    std::vector<std::thread> threads;
+    std::atomic<bool> running{true};
+    for (int t = 0; t < options.threads; ++t) {
+        contexts[t].options = &options;
+        int clients = options.clients / options.threads + (t < options.clients % options.threads ? 1 : 0);
+        threads.emplace_back(runContext, std::ref(contexts[t]), clients, std::cref(running));
+    }
+
+    std::cout << "[ws_load] " << options.clients << " clients -> " << options.host << ":" << options.port
+              << " (" << options.threads << " threads, " << (options.binary ? "binary" : "json") << ")\n";
+
+    // Report once a second; totals exclude the first second (connect ramp)
+    uint64_t startMessages = 0, startBytes = 0;
+    uint64_t lastMessages = 0, lastBytes = 0;
+    int minConnected = options.clients;
+    auto startTime = std::chrono::steady_clock::now();
+    for (int second = 0; second <= options.durationSec; ++second) {
+        std::this_thread::sleep_until(startTime + std::chrono::seconds(second + 1));
+
+        uint64_t messages = 0, bytes = 0;
+        int connected = 0;
+        for (const LoadContext& load : contexts) {
+            messages += load.messages;
+            bytes += load.bytes;
+            connected += load.connected;
+        }
+        if (second == 0) {
+            startMessages = messages;
+            startBytes = bytes;
+        } else {
+            minConnected = std::min(minConnected, connected);
+            std::cout << "  t=" << std::setw(3) << second << "s  connected " << std::setw(6) << connected
+                      << "  msgs/s " << std::setw(9) << (messages - lastMessages) << "\n";
+        }
+        lastMessages = messages;
+        lastBytes = bytes;
+    }
+
+    running = false;
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    int failed = 0, closed = 0;
+    for (const LoadContext& load : contexts) {
+        failed += load.failed;
+        closed += load.closed;
+    }
+    double seconds = static_cast<double>(options.durationSec);
+    double msgsPerSec = static_cast<double>(lastMessages - startMessages) / seconds;
+    double mbPerSec = static_cast<double>(lastBytes - startBytes) / seconds / (1024.0 * 1024.0);
+
+    std::cout << std::fixed << std::setprecision(1)
+              << "\n[ws_load] sustained clients " << minConnected << "/" << options.clients
+              << "  failed " << failed << "  closed " << closed << "\n"
+              << "[ws_load] " << msgsPerSec << " msgs/s total, "
+              << (minConnected > 0 ? msgsPerSec / minConnected : 0.0) << " msgs/s per client, "
+              << mbPerSec << " MB/s\n";
+    return 0;
+}
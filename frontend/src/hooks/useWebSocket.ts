@@ -24,6 +24,127 @@ const createEmptyCurrentCandles = (): CurrentCandles => ({
   300: null
 });
 
+// Wire encoding requested from the server: 'json' (default) or 'binary'
+// (compact frames, opt in with VITE_WS_ENCODING=binary)
+const WS_ENCODING: string = import.meta.env.VITE_WS_ENCODING || 'json';
+
+// ============================================================================
+// Binary frame decoder - mirrors include/BinaryEncoder.h (format version 1)
+// Returns the same message shape the JSON path produces, or null if the
+// frame is from an unknown format version.
+// ============================================================================
+
+const BINARY_FORMAT_VERSION = 1;
+
+export function decodeBinaryMessage(buffer: ArrayBuffer): any | null {
+  const view = new DataView(buffer);
+  let pos = 0;
+  const u8 = () => view.getUint8(pos++);
+  const u16 = () => { const v = view.getUint16(pos, true); pos += 2; return v; };
+  const u32 = () => { const v = view.getUint32(pos, true); pos += 4; return v; };
+  const i32 = () => { const v = view.getInt32(pos, true); pos += 4; return v; };
+  const u64 = () => { const v = Number(view.getBigUint64(pos, true)); pos += 8; return v; };
+  const i64 = () => { const v = Number(view.getBigInt64(pos, true)); pos += 8; return v; };
+  const price = () => i32() / 100;  // Cents on the wire
+  const str = () => {
+    const length = u8();
+    const s = new TextDecoder().decode(new Uint8Array(buffer, pos, length));
+    pos += length;
+    return s;
+  };
+  const candle = () => ({
+    timestamp: i64(), open: price(), high: price(), low: price(), close: price(), volume: u32()
+  });
+  const trade = () => ({
+    id: i64(), price: price(), quantity: u32(), side: u8() === 1 ? 'SELL' : 'BUY', timestamp: i64()
+  });
+  const levels = () => {
+    const count = u16();
+    const out = [];
+    for (let i = 0; i < count; i++) out.push({ price: price(), quantity: u32() });
+    return out;
+  };
+  const levelPairs = () => levels().map(l => [l.price, l.quantity]);
+
+  const version = u8();
+  if (version !== BINARY_FORMAT_VERSION) {
+    console.warn('Unsupported binary frame version', version);
+    return null;
+  }
+  const type = u8();
+
+  if (type === 2) {
+    return { type: 'trade', data: trade() };
+  }
+  if (type === 3) {
+    const timeframe = u16();
+    const count = u32();
+    const candles = [];
+    for (let i = 0; i < count; i++) candles.push(candle());
+    const current = u8() === 1 ? candle() : null;
+    return { type: 'candleHistory', data: { timeframe, candles, current } };
+  }
+  if (type !== 1) return null;
+
+  // Tick
+  const timestamp = i64();
+  const tickPrice = price();
+  const volume = u32();
+  const data: any = { price: { timestamp, price: tickPrice, volume } };
+
+  const bookKind = u8();
+  if (bookKind === 0) {
+    const bids = levels();
+    const asks = levels();
+    data.orderbook = { bids, asks, bestBid: price(), bestAsk: price(), spread: price() };
+  } else {
+    const seq = u32();
+    const checksum = u32();
+    data.book = { seq, snapshot: bookKind === 2, bids: levelPairs(), asks: levelPairs(), checksum };
+  }
+
+  const symbol = str();
+  const currentPrice = price();
+  const openPrice = price();
+  const highPrice = price();
+  const lowPrice = price();
+  const totalOrders = u64();
+  const totalTrades = u64();
+  const totalVolume = u64();
+  const marketOrderPct = u8();
+  const sentiment = str();
+  const intensity = str();
+  const spread = price();
+  const speed = u16() / 100;
+  const flags = u8();
+  data.stats = {
+    symbol, currentPrice, openPrice, highPrice, lowPrice, totalOrders, totalTrades, totalVolume,
+    marketOrderPct, sentiment, intensity, spread, speed,
+    paused: (flags & 1) !== 0,
+    newsShockEnabled: (flags & 2) !== 0,
+    newsShockCooldown: (flags & 4) !== 0,
+    newsShockCooldownRemaining: i32(),
+    newsShockActiveRemaining: i32(),
+  };
+
+  const currentCandles: Record<number, any> = {};
+  for (let n = u8(); n > 0; n--) {
+    const tf = u16();
+    currentCandles[tf] = candle();
+  }
+  data.currentCandles = currentCandles;
+
+  const completed = [];
+  for (let n = u8(); n > 0; n--) {
+    const tf = u16();
+    completed.push({ timeframe: tf, candle: candle() });
+  }
+  data.completedCandles = completed.length > 0 ? completed : null;
+
+  data.trade = u8() === 1 ? trade() : null;
+  return { type: 'tick', data };
+}
+
 export interface SimulationConfig {
   symbol: string;
   price: number;
@@ -94,12 +215,18 @@ export function useWebSocket(): UseWebSocketReturn {
 
     // Connect with the protocol name that the server expects
     const ws = new WebSocket(WS_URL, 'lws-minimal');
+    ws.binaryType = 'arraybuffer';
 
     ws.onopen = () => {
       setConnected(true);
       setConnecting(false);
       setSessionStartTime(Date.now());  // Track session start for countdown timer
       
+      // Pick the wire encoding before the first tick arrives
+      if (WS_ENCODING === 'binary') {
+        ws.send(JSON.stringify({ type: 'encoding', value: 'binary' }));
+      }
+      
       // Send start command with configuration
       if (configRef.current) {
         const startCommand = {
@@ -160,31 +287,45 @@ export function useWebSocket(): UseWebSocketReturn {
     };
 
     ws.onmessage = (event) => {
-      // Handle potentially concatenated JSON messages from C++ server
-      const rawData = event.data as string;
+      const messages: any[] = [];
       
-      // Split concatenated JSON objects (e.g., "{}{}{}") into individual ones
-      const jsonStrings: string[] = [];
-      let depth = 0;
-      let start = 0;
-      
-      for (let i = 0; i < rawData.length; i++) {
-        if (rawData[i] === '{') {
-          if (depth === 0) start = i;
-          depth++;
-        } else if (rawData[i] === '}') {
-          depth--;
-          if (depth === 0) {
-            jsonStrings.push(rawData.substring(start, i + 1));
+      if (event.data instanceof ArrayBuffer) {
+        // Binary frame (requested with the 'encoding' command)
+        try {
+          const decoded = decodeBinaryMessage(event.data);
+          if (decoded) messages.push(decoded);
+        } catch (e) {
+          console.error('Failed to decode binary message:', e, 'Bytes:', event.data.byteLength);
+        }
+      } else {
+        // Handle potentially concatenated JSON messages from C++ server
+        const rawData = event.data as string;
+        
+        // Split concatenated JSON objects (e.g., "{}{}{}") into individual ones
+        let depth = 0;
+        let start = 0;
+        
+        for (let i = 0; i < rawData.length; i++) {
+          if (rawData[i] === '{') {
+            if (depth === 0) start = i;
+            depth++;
+          } else if (rawData[i] === '}') {
+            depth--;
+            if (depth === 0) {
+              const msgStr = rawData.substring(start, i + 1);
+              try {
+                messages.push(JSON.parse(msgStr));
+              } catch (e) {
+                console.error('Failed to parse message:', e, 'Raw data:', msgStr.substring(0, 200));
+              }
+            }
           }
         }
       }
       
       // Process each message
-      for (const msgStr of jsonStrings) {
+      for (const message of messages) {
         try {
-          const message = JSON.parse(msgStr);
-          
           switch (message.type) {
             // OPTIMIZED: Single batched message for all tick data
             case 'tick': {
@@ -331,7 +472,7 @@ export function useWebSocket(): UseWebSocketReturn {
               break;
           }
         } catch (e) {
-          console.error('Failed to parse message:', e, 'Raw data:', msgStr.substring(0, 200));
+          console.error('Failed to handle message:', e, 'Type:', message.type);
         }
       }
     };
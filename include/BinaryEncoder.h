@@ -0,0 +1,105 @@
+// ============================================================================
+// BINARY ENCODER - Compact binary alternative to the JSON messages
+// ============================================================================
+// Clients that send {"type":"encoding","value":"binary"} get tick,
+// candleHistory and trade messages as binary WebSocket frames instead of
+// JSON text. Same information, no number formatting, roughly a quarter of
+// the size. The decoder lives in frontend/src/hooks/useWebSocket.ts.
+//
+// FORMAT (version 1, all integers little-endian)
+//
+//   Header     u8 version, u8 type (1 = tick, 2 = trade, 3 = candleHistory)
+//   price      i32, cents
+//   string     u8 length, then that many UTF-8 bytes
+//   levels     u16 count, then count x (price, u32 quantity)
+//   candle     i64 timestamp (ms), price open, high, low, close, u32 volume
+//   trade      i64 id, price, u32 quantity, u8 side (0 = BUY, 1 = SELL),
+//              i64 timestamp (ms)
+//
+//   tick       i64 timestamp, price, u32 volume
+//              u8 book kind:
+//                0 = levels:   levels bids, levels asks,
+//                              price bestBid, price bestAsk, price spread
+//                1 = delta,
+//                2 = snapshot: u32 seq, u32 checksum, levels bids, levels asks
+//                              (see the delta book feed; quantity 0 = removed)
+//              stats: string symbol, price current, open, high, low,
+//                     u64 totalOrders, totalTrades, totalVolume,
+//                     u8 marketOrderPct, string sentiment, string intensity,
+//                     price spread, u16 speed x 100,
+//                     u8 flags (1 = paused, 2 = newsShockEnabled,
+//                               4 = newsShockCooldown),
+//                     i32 newsShockCooldownRemaining, i32 newsShockActiveRemaining
+//              u8 count, count x (u16 timeframe, candle)   current candles
+//              u8 count, count x (u16 timeframe, candle)   completed candles
+//              u8 hasTrade, then trade if 1
+//
+//   trade          trade
+//   candleHistory  u16 timeframe, u32 count, count x candle,
+//                  u8 hasCurrent, then candle if 1
+//
+// New fields are only ever appended; anything else bumps the version.
+// ============================================================================
+
+#ifndef BINARY_ENCODER_H
+#define BINARY_ENCODER_H
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+#include "CandleManager.h"
+#include "OrderBook.h"
+#include "SessionState.h"
+
+namespace orderbook {
+
+class BinaryEncoder {
+public:
+    static constexpr uint8_t VERSION = 1;
+
+    enum class MessageType : uint8_t {
+        TICK = 1,
+        TRADE = 2,
+        CANDLE_HISTORY = 3
+    };
+
+    // Same content as JsonBuilder::tickToJson (stats given as fields)
+    static std::string tick(
+        const OrderBook& book,
+        const SessionStats& stats,
+        Price price,
+        int volume,
+        int64_t timestamp,
+        const TradeData* trade,  // nullptr if no trade this tick
+        const std::map<int, orderbook::Candle>& currentCandles,
+        const std::vector<orderbook::CompletedCandle>& completedCandles,
+        const BookFrame* bookFrame = nullptr  // DELTA-mode clients
+    );
+
+    // Same message, appended to out (an OutboundFrame's storage)
+    static void tick(
+        std::string& out,
+        const OrderBook& book,
+        const SessionStats& stats,
+        Price price,
+        int volume,
+        int64_t timestamp,
+        const TradeData* trade,
+        const std::map<int, orderbook::Candle>& currentCandles,
+        const std::vector<orderbook::CompletedCandle>& completedCandles,
+        const BookFrame* bookFrame = nullptr
+    );
+
+    static std::string trade(const TradeData& trade);
+
+    static std::string candleHistory(
+        int timeframe,
+        const std::vector<orderbook::Candle>& candles,
+        const orderbook::Candle* current
+    );
+};
+
+} // namespace orderbook
+
+#endif // BINARY_ENCODER_H
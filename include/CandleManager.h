@@ -7,6 +7,7 @@
 #ifndef CANDLE_MANAGER_H
 #define CANDLE_MANAGER_H
 
+#include "Common.h"
 #include <map>
 #include <vector>
 #include <cstdint>
@@ -28,15 +29,15 @@ constexpr int MAX_CACHED_CANDLES = 500;
 
 struct Candle {
     int64_t timestamp;  // Period start timestamp (ms)
-    double open;
-    double high;
-    double low;
-    double close;
+    Price open;
+    Price high;
+    Price low;
+    Price close;
     int volume;
     
     Candle() : timestamp(0), open(0), high(0), low(0), close(0), volume(0) {}
     
-    Candle(int64_t ts, double price, int vol)
+    Candle(int64_t ts, Price price, int vol)
         : timestamp(ts), open(price), high(price), low(price), close(price), volume(vol) {}
 };
 
@@ -71,7 +72,7 @@ public:
      * @param timestamp - Tick timestamp (ms)
      * @returns Vector of completed candles
      */
-    std::vector<CompletedCandle> updateCandles(double price, int volume, int64_t timestamp) {
+    std::vector<CompletedCandle> updateCandles(Price price, int volume, int64_t timestamp) {
         std::vector<CompletedCandle> completedCandles;
         
         for (int tf : TIMEFRAMES) {
@@ -0,0 +1,143 @@
+// ============================================================================
+// CLIENT REGISTRY - Sharded id lookup plus a lock-free client snapshot
+// ============================================================================
+// The tick loop visits every client every tick while connects and
+// disconnects are rare, so the registry is built for readers:
+//
+//   - snapshot(): the current client list as an immutable, refcounted
+//     vector. Taking it is one atomic shared_ptr load; iterating it takes
+//     no lock at all, however many clients there are. Connect/disconnect
+//     publish a new vector (copy-on-write, RCU style).
+//   - find(id): lookup by id (commands, replies) locks one of SHARDS
+//     shards, so lookups for different clients rarely contend.
+//
+// Entries are handed out as shared_ptr handles: a client removed while a
+// reader still holds it (in a snapshot or from find) stays alive until the
+// reader lets go. Entries guard their own mutable state.
+//
+//   auto clients = registry.snapshot();  // Hold it: the loop borrows from it
+//   for (const auto& client : *clients) { ... }
+// ============================================================================
+
+#ifndef CLIENT_REGISTRY_H
+#define CLIENT_REGISTRY_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace orderbook {
+
+template <typename Client>
+class ClientRegistry {
+public:
+    using Handle = std::shared_ptr<Client>;
+    using Snapshot = std::shared_ptr<const std::vector<Handle>>;
+
+    static constexpr size_t SHARDS = 16;
+
+    ClientRegistry() : m_snapshot(std::make_shared<const std::vector<Handle>>()) {}
+
+    ClientRegistry(const ClientRegistry&) = delete;
+    ClientRegistry& operator=(const ClientRegistry&) = delete;
+
+    // ========================================================================
+    // WRITERS (connect / disconnect)
+    // ========================================================================
+
+    /**
+     * @brief Add a client; false if the id is already registered
+     */
+    bool insert(uint32_t id, Handle client) {
+        std::lock_guard<std::mutex> writeLock(m_writeMutex);
+        {
+            Shard& shard = shardFor(id);
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            if (!shard.clients.emplace(id, client).second) {
+                return false;
+            }
+        }
+        auto next = std::make_shared<std::vector<Handle>>(*loadSnapshot());
+        next->push_back(std::move(client));
+        publish(std::move(next));
+        return true;
+    }
+
+    /**
+     * @brief Remove a client; returns its handle (empty if unknown)
+     */
+    Handle erase(uint32_t id) {
+        std::lock_guard<std::mutex> writeLock(m_writeMutex);
+        Handle removed;
+        {
+            Shard& shard = shardFor(id);
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            auto it = shard.clients.find(id);
+            if (it == shard.clients.end()) {
+                return removed;
+            }
+            removed = std::move(it->second);
+            shard.clients.erase(it);
+        }
+        auto next = std::make_shared<std::vector<Handle>>();
+        Snapshot current = loadSnapshot();
+        next->reserve(current->size());
+        for (const Handle& client : *current) {
+            if (client != removed) next->push_back(client);
+        }
+        publish(std::move(next));
+        return removed;
+    }
+
+    // ========================================================================
+    // READERS
+    // ========================================================================
+
+    /**
+     * @brief Client by id (empty handle if not connected)
+     */
+    Handle find(uint32_t id) const {
+        const Shard& shard = shardFor(id);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto it = shard.clients.find(id);
+        return it != shard.clients.end() ? it->second : Handle();
+    }
+
+    /**
+     * @brief Every client at this moment, in connection order
+     */
+    Snapshot snapshot() const { return loadSnapshot(); }
+
+    size_t size() const { return m_size.load(std::memory_order_relaxed); }
+    bool empty() const { return size() == 0; }
+
+private:
+    struct Shard {
+        mutable std::mutex mutex;
+        std::unordered_map<uint32_t, Handle> clients;
+    };
+
+    Shard& shardFor(uint32_t id) { return m_shards[id % SHARDS]; }
+    const Shard& shardFor(uint32_t id) const { return m_shards[id % SHARDS]; }
+
+    Snapshot loadSnapshot() const { return std::atomic_load(&m_snapshot); }
+
+    void publish(std::shared_ptr<std::vector<Handle>> next) {
+        m_size.store(next->size(), std::memory_order_relaxed);
+        std::atomic_store(&m_snapshot, Snapshot(std::move(next)));
+    }
+
+    std::array<Shard, SHARDS> m_shards;
+    Snapshot m_snapshot;          // Replaced, never modified in place
+    std::atomic<size_t> m_size{0};
+    std::mutex m_writeMutex;      // Serializes insert/erase (snapshot rebuild)
+};
+
+} // namespace orderbook
+
+#endif // CLIENT_REGISTRY_H
@@ -0,0 +1,110 @@
+#ifndef COMMANDMAILBOX_H
+#define COMMANDMAILBOX_H
+
+// ============================================================================
+// COMMANDMAILBOX.H - Lock-free multi-producer single-consumer command queue
+// ============================================================================
+// Client commands arrive on the WebSocket service threads, but a session's
+// state belongs to whichever tick worker steps it. Instead of sharing the
+// session under a lock, the receive side posts commands here and the tick
+// drains them right before stepping - so all session state is touched by
+// one thread at a time and the tick takes no lock.
+//
+// Intrusive linked list with a stub node (Vyukov MPSC): post() is one
+// atomic exchange plus a store, drain() only follows next pointers. A
+// command whose post() is still half done is simply picked up next tick.
+// ============================================================================
+
+#include <atomic>
+#include <cstddef>
+#include <string>
+#include <utility>
+
+namespace orderbook {
+
+/**
+ * @brief One client command ("speed" = "2", "reset" = "true", ...)
+ */
+struct SessionCommand {
+    std::string type;
+    std::string value;
+};
+
+/**
+ * @brief Unbounded MPSC mailbox of session commands
+ *
+ * Any number of threads may post(); only ONE thread may drain() at a time
+ * (the tick worker stepping the session).
+ *
+ * Example:
+ *   mailbox.post({"speed", "2"});              // Receive thread
+ *   mailbox.drain([&](SessionCommand& cmd) {   // Tick
+ *       apply(cmd);
+ *   });
+ */
+class CommandMailbox {
+public:
+    CommandMailbox() : m_head(&m_stub), m_tail(&m_stub) {}
+
+    ~CommandMailbox() {
+        drain([](SessionCommand&) {});
+        if (m_tail != &m_stub) delete m_tail;
+    }
+
+    // Non-copyable
+    CommandMailbox(const CommandMailbox&) = delete;
+    CommandMailbox& operator=(const CommandMailbox&) = delete;
+
+    /**
+     * @brief Queue a command (any thread, never blocks)
+     */
+    void post(SessionCommand command) {
+        Node* node = new Node;
+        node->command = std::move(command);
+        Node* prev = m_head.exchange(node, std::memory_order_acq_rel);
+        prev->next.store(node, std::memory_order_release);
+    }
+
+    /**
+     * @brief Hand every queued command to fn, oldest first (consumer only)
+     * @return Number of commands applied
+     */
+    template <typename Fn>
+    size_t drain(Fn&& fn) {
+        size_t count = 0;
+        Node* tail = m_tail;
+        Node* next = tail->next.load(std::memory_order_acquire);
+        while (next) {
+            // next becomes the new stub once its command is taken
+            fn(next->command);
+            next->command = SessionCommand();
+            if (tail != &m_stub) delete tail;
+            tail = next;
+            next = tail->next.load(std::memory_order_acquire);
+            ++count;
+        }
+        m_tail = tail;
+        return count;
+    }
+
+    /**
+     * @brief True if nothing is queued (consumer only)
+     */
+    bool empty() const {
+        return m_tail->next.load(std::memory_order_acquire) == nullptr;
+    }
+
+private:
+    struct Node {
+        std::atomic<Node*> next{nullptr};
+        SessionCommand command;
+    };
+
+    Node m_stub;                          // First stub; later ones are heap nodes
+    alignas(64) std::atomic<Node*> m_head;  // Last node posted (producers)
+    alignas(64) Node* m_tail;             // Current stub (consumer)
+};
+
+} // namespace orderbook
+
+#endif // COMMANDMAILBOX_H
@@ -11,6 +11,9 @@
 #include <cstdint>
 #include <string>
 #include <chrono>
+#include <ostream>
+#include <functional>
+#include <type_traits>
 
 namespace orderbook {
 
@@ -20,10 +23,113 @@ namespace orderbook {
 // These make our code more readable and meaningful
 
 using OrderId   = uint64_t;    // Unique identifier for each order
-using Price     = double;       // Price in dollars (e.g., 150.25)
 using Quantity  = uint32_t;     // Number of shares
 using Timestamp = std::chrono::steady_clock::time_point;
 
+// ============================================================================
+// PRICE - Fixed-point dollars
+// ============================================================================
+
+/**
+ * @brief Price in dollars, stored as an integer number of 1/10000ths
+ * 
+ * Comparisons, hashing and map keys are plain integer operations, so two
+ * prices that print the same always compare equal (no 0.1 + 0.2 surprises).
+ * 
+ * A double converts to a Price implicitly (rounded to the nearest 1/10000),
+ * so literals like 150.25 work everywhere a Price is expected. Going back
+ * to a double is explicit via toDouble() - only the JSON/display edge and
+ * the floating-point price models should need it.
+ * 
+ * Example:
+ *   Price p = 150.25;
+ *   p.raw();                  // 1502500
+ *   Price(150.27).roundToTick(0.05);  // 150.25
+ */
+class Price {
+public:
+    using Raw = int64_t;
+    static constexpr Raw SCALE = 10000;   // Raw units per dollar
+    
+    constexpr Price() = default;
+    constexpr Price(double dollars)
+        : m_raw(static_cast<Raw>(dollars * SCALE + (dollars < 0 ? -0.5 : 0.5))) {}
+    
+    static constexpr Price fromRaw(Raw raw) {
+        Price p;
+        p.m_raw = raw;
+        return p;
+    }
+    
+    constexpr Raw    raw()      const { return m_raw; }
+    constexpr double toDouble() const { return static_cast<double>(m_raw) / SCALE; }
+    
+    // ========================================================================
+    // TICK HELPERS
+    // ========================================================================
+    
+    /**
+     * @brief Check whether this price is an exact multiple of tickSize
+     */
+    constexpr bool isOnTick(Price tickSize) const {
+        return m_raw % tickSize.m_raw == 0;
+    }
+    
+    /**
+     * @brief Round to the nearest multiple of tickSize (halves away from zero)
+     */
+    constexpr Price roundToTick(Price tickSize) const {
+        Raw half = tickSize.m_raw / 2;
+        Raw ticks = (m_raw >= 0 ? m_raw + half : m_raw - half) / tickSize.m_raw;
+        return fromRaw(ticks * tickSize.m_raw);
+    }
+    
+    /**
+     * @brief Number of whole ticks in this price (truncating toward zero)
+     */
+    constexpr Raw toTicks(Price tickSize) const { return m_raw / tickSize.m_raw; }
+    
+    // ========================================================================
+    // ARITHMETIC - Exact; scaling is by integers only
+    // ========================================================================
+    
+    constexpr Price& operator+=(Price other) { m_raw += other.m_raw; return *this; }
+    constexpr Price& operator-=(Price other) { m_raw -= other.m_raw; return *this; }
+    
+    friend constexpr Price operator+(Price a, Price b) { return fromRaw(a.m_raw + b.m_raw); }
+    friend constexpr Price operator-(Price a, Price b) { return fromRaw(a.m_raw - b.m_raw); }
+    friend constexpr Price operator-(Price a) { return fromRaw(-a.m_raw); }
+    
+    template <typename I, typename = std::enable_if_t<std::is_integral_v<I>>>
+    friend constexpr Price operator*(Price a, I n) { return fromRaw(a.m_raw * static_cast<Raw>(n)); }
+    template <typename I, typename = std::enable_if_t<std::is_integral_v<I>>>
+    friend constexpr Price operator*(I n, Price a) { return fromRaw(a.m_raw * static_cast<Raw>(n)); }
+    
+    // ========================================================================
+    // COMPARISON
+    // ========================================================================
+    
+    friend constexpr bool operator==(Price a, Price b) { return a.m_raw == b.m_raw; }
+    friend constexpr bool operator!=(Price a, Price b) { return a.m_raw != b.m_raw; }
+    friend constexpr bool operator< (Price a, Price b) { return a.m_raw <  b.m_raw; }
+    friend constexpr bool operator<=(Price a, Price b) { return a.m_raw <= b.m_raw; }
+    friend constexpr bool operator> (Price a, Price b) { return a.m_raw >  b.m_raw; }
+    friend constexpr bool operator>=(Price a, Price b) { return a.m_raw >= b.m_raw; }
+    
+    /**
+     * @brief Stream as decimal dollars (honours std::fixed / setprecision)
+     */
+    friend std::ostream& operator<<(std::ostream& os, Price p) {
+        return os << p.toDouble();
+    }
+
+private:
+    Raw m_raw = 0;
+};
+
+// Default tick size for symbols that don't specify their own ($0.05)
+constexpr Price DEFAULT_TICK_SIZE = Price::fromRaw(500);
+
 // ============================================================================
 // ENUMS
 // ============================================================================
@@ -104,4 +210,13 @@ inline Timestamp now() {
 
 } // namespace orderbook
 
+namespace std {
+template <>
+struct hash<orderbook::Price> {
+    size_t operator()(orderbook::Price p) const noexcept {
+        return hash<orderbook::Price::Raw>()(p.raw());
+    }
+};
+} // namespace std
+
 #endif // COMMON_H
@@ -0,0 +1,122 @@
+#ifndef FASTRNG_H
+#define FASTRNG_H
+
+// ============================================================================
+// FASTRNG.H - Small, explicitly seeded random generator (xoshiro256**)
+// ============================================================================
+// Every session owns one FastRng and hands it to each component that needs
+// randomness (price engine, trade generation, synthetic depth, shocks).
+// Unlike rand() there is no hidden shared state, so sessions stepped on
+// different threads never contend. Unlike a std::mt19937 seeded from
+// std::random_device it is 32 bytes, seeds in a few instructions, and the
+// seed is a plain number - log it and the session can be replayed.
+//
+// FastRng is a UniformRandomBitGenerator, so the <random> distributions
+// work with it; nextDouble() / nextBelow() cover the common cases cheaper.
+//
+// Not thread-safe: one generator per session (per thread).
+// ============================================================================
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <random>
+
+namespace orderbook {
+
+class FastRng {
+public:
+    using result_type = uint64_t;
+
+    explicit FastRng(uint64_t seed = 0x9E3779B97F4A7C15ULL) { reseed(seed); }
+
+    /**
+     * @brief Restart the sequence from `seed` (same seed, same sequence)
+     */
+    void reseed(uint64_t seed) {
+        m_seed = seed;
+        uint64_t x = seed;
+        for (uint64_t& word : m_state) {
+            word = splitMix64(x);
+        }
+    }
+
+    uint64_t seed() const { return m_seed; }
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+    result_type operator()() {
+        const uint64_t result = rotl(m_state[1] * 5, 7) * 9;
+        const uint64_t t = m_state[1] << 17;
+        m_state[2] ^= m_state[0];
+        m_state[3] ^= m_state[1];
+        m_state[1] ^= m_state[2];
+        m_state[0] ^= m_state[3];
+        m_state[2] ^= t;
+        m_state[3] = rotl(m_state[3], 45);
+        return result;
+    }
+
+    /**
+     * @brief Uniform double in [0, 1)
+     */
+    double nextDouble() {
+        return static_cast<double>((*this)() >> 11) * 0x1.0p-53;
+    }
+
+    /**
+     * @brief Uniform integer in [0, bound) (0 if bound is 0)
+     */
+    uint32_t nextBelow(uint32_t bound) {
+        // Lemire's multiply-shift; the bias is negligible for small bounds
+        return static_cast<uint32_t>(((*this)() >> 32) * bound >> 32);
+    }
+
+    /**
+     * @brief Uniform integer in [lo, hi]
+     */
+    int nextInt(int lo, int hi) {
+        return lo + static_cast<int>(nextBelow(static_cast<uint32_t>(hi - lo + 1)));
+    }
+
+    // ========================================================================
+    // SEEDS
+    // ========================================================================
+
+    /**
+     * @brief Seed for stream `stream` (e.g. a session id) under a base seed
+     */
+    static constexpr uint64_t deriveSeed(uint64_t base, uint64_t stream) {
+        uint64_t x = base ^ (stream * 0xD1B54A32D192ED03ULL);
+        return splitMix64(x);
+    }
+
+    /**
+     * @brief A fresh, non-zero seed from std::random_device
+     */
+    static uint64_t randomSeed() {
+        std::random_device device;
+        uint64_t seed = (static_cast<uint64_t>(device()) << 32) | device();
+        return seed ? seed : 1;
+    }
+
+private:
+    static constexpr uint64_t rotl(uint64_t x, int k) {
+        return (x << k) | (x >> (64 - k));
+    }
+
+    static constexpr uint64_t splitMix64(uint64_t& x) {
+        uint64_t z = (x += 0x9E3779B97F4A7C15ULL);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+
+    std::array<uint64_t, 4> m_state{};
+    uint64_t m_seed = 0;
+};
+
+} // namespace orderbook
+
+#endif // FASTRNG_H
@@ -0,0 +1,108 @@
+// ============================================================================
+// JSON BUILDER - Server -> client message encoding
+// ============================================================================
+// Builds the JSON messages the WebSocket server sends. Kept apart from the
+// server itself (no libwebsockets dependency) so the encodings can be
+// tested and measured on their own. Output goes through JsonWriter
+// (include/JsonWriter.h), appending into std::string without streams.
+// ============================================================================
+
+#ifndef JSON_BUILDER_H
+#define JSON_BUILDER_H
+
+#include <string>
+#include <vector>
+#include <map>
+#include <cstdint>
+#include "CandleManager.h"
+#include "OrderBook.h"
+#include "SessionState.h"
+
+namespace orderbook {
+
+// ============================================================================
+// JSON Builder Helper
+// ============================================================================
+
+class JsonBuilder {
+public:
+    static std::string orderBookToJson(const OrderBook& book);
+    static std::string tradeToJson(Price price, int quantity, const std::string& side);
+    static std::string statsToJson(
+        const std::string& symbol,
+        Price currentPrice,
+        Price openPrice,
+        Price highPrice,
+        Price lowPrice,
+        size_t totalOrders,
+        size_t totalTrades,
+        size_t totalVolume,
+        int marketOrderPct,
+        const std::string& sentiment,
+        const std::string& intensity,
+        double spread,
+        double speed,
+        bool paused,
+        bool newsShockEnabled = false,
+        bool newsShockCooldown = false,
+        int newsShockCooldownRemaining = 0,
+        int newsShockActiveRemaining = 0
+    );
+    static std::string statsToJson(const SessionStats& stats);
+    static std::string priceToJson(Price price, int volume);
+    
+    // New batched tick message format (matching Node.js)
+    static std::string tickToJson(
+        const OrderBook& book,
+        const SessionStats& stats,
+        Price price,
+        int volume,
+        int64_t timestamp,
+        const TradeData* trade,  // nullptr if no trade this tick
+        const std::map<int, orderbook::Candle>& currentCandles,
+        const std::vector<orderbook::CompletedCandle>& completedCandles,
+        const BookFrame* bookFrame = nullptr  // DELTA-mode clients: replaces "orderbook"
+    );
+    
+    /**
+     * @brief Same message, appended to out
+     * 
+     * For buffers reused every tick (an OutboundFrame's storage): once out
+     * has grown to a tick's size, building a tick allocates nothing.
+     */
+    static void tickToJson(
+        std::string& out,
+        const OrderBook& book,
+        const SessionStats& stats,
+        Price price,
+        int volume,
+        int64_t timestamp,
+        const TradeData* trade,
+        const std::map<int, orderbook::Candle>& currentCandles,
+        const std::vector<orderbook::CompletedCandle>& completedCandles,
+        const BookFrame* bookFrame = nullptr
+    );
+    
+    /**
+     * @brief Checksum of the top BOOK_DEPTH levels a DELTA client must hold
+     * 
+     * 32-bit FNV-1a over 32-bit words: bid count, then (price in cents,
+     * quantity) per bid best first, then the same for asks. Clients
+     * recompute it after applying a frame; a mismatch means "resync".
+     */
+    static uint32_t bookChecksum(const BookSnapshot& snap);
+    
+    // Levels per side in book payloads (full ticks, snapshots, checksum)
+    static constexpr size_t BOOK_DEPTH = 15;
+    
+    // Candle history response
+    static std::string candleHistoryToJson(
+        int timeframe,
+        const std::vector<orderbook::Candle>& candles,
+        const orderbook::Candle* current
+    );
+};
+
+} // namespace orderbook
+
+#endif // JSON_BUILDER_H
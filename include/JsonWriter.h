@@ -0,0 +1,169 @@
+// ============================================================================
+// JSON WRITER - Append-only JSON output into a caller-owned buffer
+// ============================================================================
+// JsonBuilder used to stream every message through std::ostringstream:
+// a fresh stream and string per message, locale-aware number formatting,
+// and virtual calls per field. JsonWriter appends straight into a
+// std::string the caller keeps between messages (so its capacity is reused),
+// and formats numbers with std::to_chars.
+//
+// Commas are inserted automatically: key() and every value written inside
+// an array start with one unless they are the first element.
+//
+//   std::string buffer;            // Reused across ticks
+//   JsonWriter w(buffer);
+//   w.beginObject();
+//   w.key("price").value(Price(100.05));
+//   w.key("levels").beginArray().value(1).value(2).endArray();
+//   w.endObject();                 // {"price":100.05,"levels":[1,2]}
+// ============================================================================
+
+#ifndef JSON_WRITER_H
+#define JSON_WRITER_H
+
+#include "Common.h"
+#include <charconv>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace orderbook {
+
+class JsonWriter {
+public:
+    /**
+     * @brief Append to out (existing contents are kept)
+     */
+    explicit JsonWriter(std::string& out) : m_out(out) {}
+
+    // ========================================================================
+    // STRUCTURE
+    // ========================================================================
+
+    JsonWriter& beginObject() { separate(); m_out.push_back('{'); m_needComma = false; return *this; }
+    JsonWriter& endObject()   { m_out.push_back('}'); m_needComma = true; return *this; }
+    JsonWriter& beginArray()  { separate(); m_out.push_back('['); m_needComma = false; return *this; }
+    JsonWriter& endArray()    { m_out.push_back(']'); m_needComma = true; return *this; }
+
+    /**
+     * @brief "name": - the next call writes its value
+     * @param name Must not need escaping (keys are compile-time literals)
+     */
+    JsonWriter& key(std::string_view name) {
+        separate();
+        m_out.push_back('"');
+        m_out.append(name);
+        m_out.append("\":", 2);
+        m_needComma = false;
+        return *this;
+    }
+
+    // ========================================================================
+    // VALUES
+    // ========================================================================
+
+    /**
+     * @brief Integer value (any width, signed or unsigned)
+     */
+    template <typename T, typename = std::enable_if_t<std::is_integral_v<T> && !std::is_same_v<T, bool>>>
+    JsonWriter& value(T number) {
+        separate();
+        char buf[24];
+        auto result = std::to_chars(buf, buf + sizeof(buf), number);
+        m_out.append(buf, result.ptr);
+        m_needComma = true;
+        return *this;
+    }
+
+    /**
+     * @brief Price with exactly two decimals (exact: formatted from the raw integer)
+     */
+    JsonWriter& value(Price price) {
+        separate();
+        // Whole cents, rounded half away from zero like Price::roundToTick
+        Price::Raw cents = price.roundToTick(Price::fromRaw(Price::SCALE / 100)).raw() / (Price::SCALE / 100);
+        if (cents < 0) {
+            m_out.push_back('-');
+            cents = -cents;
+        }
+        char buf[24];
+        auto result = std::to_chars(buf, buf + sizeof(buf), cents / 100);
+        m_out.append(buf, result.ptr);
+        int fraction = static_cast<int>(cents % 100);
+        m_out.push_back('.');
+        m_out.push_back(static_cast<char>('0' + fraction / 10));
+        m_out.push_back(static_cast<char>('0' + fraction % 10));
+        m_needComma = true;
+        return *this;
+    }
+
+    /**
+     * @brief Floating-point value with fixed decimals (like std::fixed << setprecision)
+     */
+    JsonWriter& value(double number, int decimals = 2) {
+        separate();
+        char buf[64];
+        auto result = std::to_chars(buf, buf + sizeof(buf), number, std::chars_format::fixed, decimals);
+        m_out.append(buf, result.ptr);
+        m_needComma = true;
+        return *this;
+    }
+
+    JsonWriter& value(bool flag) {
+        separate();
+        m_out.append(flag ? "true" : "false");
+        m_needComma = true;
+        return *this;
+    }
+
+    /**
+     * @brief Quoted string, escaping quotes, backslashes and control characters
+     */
+    JsonWriter& value(std::string_view text) {
+        separate();
+        m_out.push_back('"');
+        for (char c : text) {
+            switch (c) {
+                case '"':  m_out.append("\\\"", 2); break;
+                case '\\': m_out.append("\\\\", 2); break;
+                case '\n': m_out.append("\\n", 2); break;
+                case '\r': m_out.append("\\r", 2); break;
+                case '\t': m_out.append("\\t", 2); break;
+                default:
+                    if (static_cast<unsigned char>(c) < 0x20) {
+                        static const char hex[] = "0123456789abcdef";
+                        m_out.append("\\u00", 4);
+                        m_out.push_back(hex[(c >> 4) & 0xF]);
+                        m_out.push_back(hex[c & 0xF]);
+                    } else {
+                        m_out.push_back(c);
+                    }
+            }
+        }
+        m_out.push_back('"');
+        m_needComma = true;
+        return *this;
+    }
+    JsonWriter& value(const char* text) { return value(std::string_view(text)); }
+    JsonWriter& value(const std::string& text) { return value(std::string_view(text)); }
+
+    JsonWriter& null() {
+        separate();
+        m_out.append("null", 4);
+        m_needComma = true;
+        return *this;
+    }
+
+private:
+    void separate() {
+        if (m_needComma) m_out.push_back(',');
+    }
+
+    std::string& m_out;
+    bool m_needComma = false;
+};
+
+} // namespace orderbook
+
+#endif // JSON_WRITER_H
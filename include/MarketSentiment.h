@@ -4,6 +4,8 @@
 #include "Common.h"  // For Side enum
 #include "Order.h"   // For Order class
 #include "OrderBook.h" // For OrderBook class
+#include "FastRng.h"
+#include <array>
 #include <string>
 #include <map>
 #include <random>
@@ -41,6 +43,15 @@ enum class Intensity {
     EXTREME     // 💥 Very dramatic effects (2.5x multiplier)
 };
 
+// Parameter tables (PriceEngine.h) are indexed by these
+constexpr size_t SENTIMENT_COUNT = 6;
+constexpr size_t INTENSITY_COUNT = 5;
+
+constexpr size_t sentimentIndex(Sentiment s) { return static_cast<size_t>(s); }
+constexpr size_t intensityIndex(Intensity i) { return static_cast<size_t>(i); }
+static_assert(sentimentIndex(Sentiment::NEUTRAL) == SENTIMENT_COUNT - 1, "Sentiment tables");
+static_assert(intensityIndex(Intensity::EXTREME) == INTENSITY_COUNT - 1, "Intensity tables");
+
 // ============================================================================
 // MARKET PARAMETERS
 // ============================================================================
@@ -85,7 +96,7 @@ struct MarketParameters {
 class MarketSentimentController {
 public:
     // Tick size - all prices must be multiples of this
-    static constexpr double TICK_SIZE = 0.05;
+    static constexpr double TICK_SIZE = orderbook::DEFAULT_TICK_SIZE.toDouble();
     
     // Spread limits (must be multiples of TICK_SIZE)
     static constexpr double MIN_SPREAD = 0.05;
@@ -94,7 +105,7 @@ public:
     
     // Helper: Round any price to nearest tick
     static double roundToTick(double price) {
-        return std::round(price / TICK_SIZE) * TICK_SIZE;
+        return orderbook::Price(price).roundToTick(orderbook::DEFAULT_TICK_SIZE).toDouble();
     }
     
     MarketSentimentController() 
@@ -206,7 +217,7 @@ public:
     }
     
     // Get simple sentiment name for WebSocket (matches frontend types)
-    static std::string getSentimentNameSimple(Sentiment s) {
+    static constexpr const char* getSentimentNameSimple(Sentiment s) {
         switch (s) {
             case Sentiment::BULLISH:  return "BULLISH";
             case Sentiment::BEARISH:  return "BEARISH";
@@ -219,7 +230,7 @@ public:
     }
     
     // Get simple intensity name for WebSocket (matches frontend types)
-    static std::string getIntensityNameSimple(Intensity i) {
+    static constexpr const char* getIntensityNameSimple(Intensity i) {
         switch (i) {
             case Intensity::MILD:       return "MILD";
             case Intensity::MODERATE:   return "MODERATE";
@@ -443,13 +454,15 @@ private:
 
 class SentimentOrderGenerator {
 public:
-    SentimentOrderGenerator(MarketSentimentController& controller, double basePrice = 100.0)
+    // rng: the owner's generator (a session's, or the global generator's)
+    SentimentOrderGenerator(MarketSentimentController& controller, orderbook::FastRng& rng,
+                            double basePrice = 100.0)
         : controller_(controller)
         , basePrice_(MarketSentimentController::roundToTick(basePrice))
         , lastTradePrice_(MarketSentimentController::roundToTick(basePrice))
         , bestBid_(MarketSentimentController::roundToTick(basePrice) - MarketSentimentController::TICK_SIZE)
         , bestAsk_(MarketSentimentController::roundToTick(basePrice) + MarketSentimentController::TICK_SIZE)
-        , gen_(std::random_device{}())
+        , rng_(rng)
     {}
     
     struct GeneratedOrder {
@@ -475,7 +488,7 @@ public:
         double buyProb = params.buyProbability;
         buyProb = std::clamp(buyProb, 0.25, 0.75);  // Ensure 25-75% range for limit orders
         
-        order.side = (prob(gen_) < buyProb) ? orderbook::Side::BUY : orderbook::Side::SELL;
+        order.side = (prob(rng_) < buyProb) ? orderbook::Side::BUY : orderbook::Side::SELL;
         
         // Use spread from controller
         double spreadValue = controller_.getSpread();
@@ -489,7 +502,7 @@ public:
         
         // How many ticks away from the spread? (0 = at best, 1-5 = deeper in book)
         std::uniform_int_distribution<> ticksAway(0, 5);
-        double offset = ticksAway(gen_) * MarketSentimentController::TICK_SIZE;
+        double offset = ticksAway(rng_) * MarketSentimentController::TICK_SIZE;
         
         if (order.side == orderbook::Side::BUY) {
             // BID: at or below the mid - half spread
@@ -505,7 +518,7 @@ public:
         
         // Limit order sizes (smaller, providing liquidity)
         std::uniform_int_distribution<> qtyDist(params.minQuantity / 2, params.maxQuantity / 2);
-        order.quantity = qtyDist(gen_);
+        order.quantity = qtyDist(rng_);
         
         return order;
     }
@@ -534,7 +547,7 @@ public:
         }
         buyBias = std::clamp(buyBias, 0.15, 0.85);
         
-        order.side = (prob(gen_) < buyBias) ? orderbook::Side::BUY : orderbook::Side::SELL;
+        order.side = (prob(rng_) < buyBias) ? orderbook::Side::BUY : orderbook::Side::SELL;
         
         // Market orders: price set to GUARANTEE crossing the spread
         // Use last trade price as reference if book side is empty
@@ -552,10 +565,10 @@ public:
         // Market order SIZE is key to price movement!
         // Larger orders = consume more levels = bigger price moves
         std::uniform_int_distribution<> qtyDist(params.minQuantity, params.maxQuantity);
-        order.quantity = qtyDist(gen_);
+        order.quantity = qtyDist(rng_);
         
         // Whale orders (large) have bigger market impact
-        if (prob(gen_) < params.largOrderProbability) {
+        if (prob(rng_) < params.largOrderProbability) {
             order.quantity *= params.largeOrderMultiplier;
         }
         
@@ -573,7 +586,7 @@ public:
         // Market order probability can increase with volatility/intensity
         double marketProb = params.marketOrderProbability;  // Base: 0.1-0.3 depending on sentiment
         
-        if (prob(gen_) < marketProb) {
+        if (prob(rng_) < marketProb) {
             return generateMarketOrder();
         } else {
             return generateLimitOrder();
@@ -606,7 +619,7 @@ public:
     int getNextDelay() {
         MarketParameters params = controller_.getParameters();
         std::uniform_int_distribution<> delayDist(params.minDelayMs, params.maxDelayMs);
-        return delayDist(gen_);
+        return delayDist(rng_);
     }
     
     // Getters
@@ -630,68 +643,28 @@ public:
         // Clear all existing orders first
         book.clear();
         
-        // Ensure minimum spread is at least one tick
-        double effectiveSpread = std::max(spread, MarketSentimentController::TICK_SIZE);
-        double halfSpread = effectiveSpread / 2.0;
-        
-        double bestBidPrice = MarketSentimentController::roundToTick(currentPrice - halfSpread);
-        double bestAskPrice = MarketSentimentController::roundToTick(currentPrice + halfSpread);
-        
-        // CRITICAL: Ensure bid and ask are never the same price (spread > 0)
-        // This can happen when halfSpread < TICK_SIZE/2 due to rounding
-        if (bestBidPrice >= bestAskPrice) {
-            // Center around current price with minimum 1 tick spread
-            double midPrice = MarketSentimentController::roundToTick(currentPrice);
-            bestBidPrice = midPrice - MarketSentimentController::TICK_SIZE;
-            bestAskPrice = midPrice + MarketSentimentController::TICK_SIZE;
-        }
-        
-        // Generate 15 levels on each side
-        const int levels = 15;
-        std::uniform_int_distribution<> qtyDist(50, 500);
-        static orderbook::OrderId orderId = 1000000; // Start with high IDs to avoid conflicts
+        double bestBidPrice, bestAskPrice;
+        touchPrices(currentPrice, spread, bestBidPrice, bestAskPrice);
         
         // Get sentiment for depth bias
         Sentiment s = controller_.getSentiment();
+        orderbook::OrderId orderId = reserveOrderIds(2 * DEPTH_LEVELS);
         
         // Bids (descending from best bid)
-        for (int i = 0; i < levels; i++) {
+        for (int i = 0; i < DEPTH_LEVELS; i++) {
             double price = bestBidPrice - (i * MarketSentimentController::TICK_SIZE);
             if (price > 0) {
-                // Quantity tapers off further from touch
-                int baseQty = qtyDist(gen_);
-                int qty = baseQty * (levels - i) / levels;
-                qty = std::max(10, qty);
-                
-                // Sentiment affects depth - bullish = more bid depth
-                if (s == Sentiment::BULLISH) {
-                    qty = static_cast<int>(qty * 1.3);
-                } else if (s == Sentiment::BEARISH) {
-                    qty = static_cast<int>(qty * 0.7);
-                }
-                
                 orderbook::Order order(orderId++, orderbook::Side::BUY, 
-                    orderbook::OrderType::LIMIT, price, qty);
+                    orderbook::OrderType::LIMIT, price, depthQuantity(orderbook::Side::BUY, i, s));
                 book.addOrder(order);
             }
         }
         
         // Asks (ascending from best ask)
-        for (int i = 0; i < levels; i++) {
+        for (int i = 0; i < DEPTH_LEVELS; i++) {
             double price = bestAskPrice + (i * MarketSentimentController::TICK_SIZE);
-            int baseQty = qtyDist(gen_);
-            int qty = baseQty * (levels - i) / levels;
-            qty = std::max(10, qty);
-            
-            // Sentiment affects depth - bearish = more ask depth
-            if (s == Sentiment::BEARISH) {
-                qty = static_cast<int>(qty * 1.3);
-            } else if (s == Sentiment::BULLISH) {
-                qty = static_cast<int>(qty * 0.7);
-            }
-            
             orderbook::Order order(orderId++, orderbook::Side::SELL,
-                orderbook::OrderType::LIMIT, price, qty);
+                orderbook::OrderType::LIMIT, price, depthQuantity(orderbook::Side::SELL, i, s));
             book.addOrder(order);
         }
         
@@ -700,6 +673,56 @@ public:
         bestAsk_ = bestAskPrice;
         lastTradePrice_ = currentPrice;
     }
+    
+    // ========================================================================
+    // REFRESH ORDER BOOK - Same depth profile, updated in place
+    // Levels that stay inside the window keep their size (re-drawn now and
+    // then so the book still breathes); only levels that appear, vanish or
+    // get re-drawn touch the book. Per-tick cost follows what moved.
+    // ========================================================================
+    void refreshOrderBook(orderbook::OrderBook& book, double currentPrice, double spread) {
+        double bestBidPrice, bestAskPrice;
+        touchPrices(currentPrice, spread, bestBidPrice, bestAskPrice);
+        
+        book.snapshot(DEPTH_LEVELS, current_);
+        Sentiment s = controller_.getSentiment();
+        std::uniform_real_distribution<> prob(0.0, 1.0);
+        orderbook::OrderId orderId = reserveOrderIds(2 * DEPTH_LEVELS);
+        
+        // Target depth for one side: reuse a live level's size unless re-drawn
+        auto buildSide = [&](orderbook::Side side, double bestPrice,
+                             const orderbook::BookSnapshot::Level* live, size_t liveCount) {
+            bool isBuy = (side == orderbook::Side::BUY);
+            size_t count = 0;
+            for (int i = 0; i < DEPTH_LEVELS; i++) {
+                double price = isBuy ? bestPrice - (i * MarketSentimentController::TICK_SIZE)
+                                     : bestPrice + (i * MarketSentimentController::TICK_SIZE);
+                if (price <= 0) break;
+                
+                orderbook::Price target(price);
+                orderbook::Quantity qty = 0;
+                for (size_t j = 0; j < liveCount; j++) {
+                    if (live[j].price == target) {
+                        qty = live[j].quantity;
+                        break;
+                    }
+                }
+                if (qty == 0 || prob(rng_) < REDRAW_PROBABILITY) {
+                    qty = depthQuantity(side, i, s);
+                }
+                targets_[count++] = {target, qty};
+            }
+            book.updateLevels(side, targets_.data(), count, orderId);
+        };
+        
+        buildSide(orderbook::Side::BUY, bestBidPrice, current_.bids.data(), current_.bidCount);
+        buildSide(orderbook::Side::SELL, bestAskPrice, current_.asks.data(), current_.askCount);
+        
+        // Update our tracking
+        bestBid_ = bestBidPrice;
+        bestAsk_ = bestAskPrice;
+        lastTradePrice_ = currentPrice;
+    }
 
 private:
     MarketSentimentController& controller_;
@@ -707,7 +730,60 @@ private:
     double lastTradePrice_;
     double bestBid_;   // Current best bid from the ACTUAL order book
     double bestAsk_;   // Current best ask from the ACTUAL order book
-    std::mt19937 gen_;
+    orderbook::FastRng& rng_;
+    
+    // Synthetic depth: levels per side, and how often refreshOrderBook
+    // re-draws the size of a level that is still in the window
+    static constexpr int DEPTH_LEVELS = 15;
+    static constexpr double REDRAW_PROBABILITY = 0.3;
+    
+    // Scratch for refreshOrderBook (kept to avoid per-tick allocation)
+    orderbook::BookSnapshot current_;
+    std::array<orderbook::BookSnapshot::Level, DEPTH_LEVELS> targets_;
+    
+    // Ids for synthetic depth orders, unique across every generator. Sessions
+    // step on several threads, so each call reserves a block of ids at once
+    static orderbook::OrderId reserveOrderIds(size_t count) {
+        static std::atomic<orderbook::OrderId> nextId{1000000}; // Start with high IDs to avoid conflicts
+        return nextId.fetch_add(count, std::memory_order_relaxed);
+    }
+    
+    // Best bid/ask for a synthetic book around currentPrice
+    static void touchPrices(double currentPrice, double spread, double& bestBid, double& bestAsk) {
+        // Ensure minimum spread is at least one tick
+        double effectiveSpread = std::max(spread, MarketSentimentController::TICK_SIZE);
+        double halfSpread = effectiveSpread / 2.0;
+        
+        bestBid = MarketSentimentController::roundToTick(currentPrice - halfSpread);
+        bestAsk = MarketSentimentController::roundToTick(currentPrice + halfSpread);
+        
+        // CRITICAL: Ensure bid and ask are never the same price (spread > 0)
+        // This can happen when halfSpread < TICK_SIZE/2 due to rounding
+        if (bestBid >= bestAsk) {
+            // Center around current price with minimum 1 tick spread
+            double midPrice = MarketSentimentController::roundToTick(currentPrice);
+            bestBid = midPrice - MarketSentimentController::TICK_SIZE;
+            bestAsk = midPrice + MarketSentimentController::TICK_SIZE;
+        }
+    }
+    
+    // Size of the level `depth` ticks from the touch: tapers away from the
+    // touch, and the side the sentiment favours is deeper
+    orderbook::Quantity depthQuantity(orderbook::Side side, int depth, Sentiment s) {
+        std::uniform_int_distribution<> qtyDist(50, 500);
+        int baseQty = qtyDist(rng_);
+        int qty = baseQty * (DEPTH_LEVELS - depth) / DEPTH_LEVELS;
+        qty = std::max(10, qty);
+        
+        Sentiment deeper = (side == orderbook::Side::BUY) ? Sentiment::BULLISH : Sentiment::BEARISH;
+        Sentiment thinner = (side == orderbook::Side::BUY) ? Sentiment::BEARISH : Sentiment::BULLISH;
+        if (s == deeper) {
+            qty = static_cast<int>(qty * 1.3);
+        } else if (s == thinner) {
+            qty = static_cast<int>(qty * 0.7);
+        }
+        return static_cast<orderbook::Quantity>(qty);
+    }
 };
 
 #endif // MARKET_SENTIMENT_H
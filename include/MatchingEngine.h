@@ -73,11 +73,58 @@ public:
      * 2. Execute any trades
      * 3. Add remaining quantity to the book (for LIMIT orders)
      * 
+     * Steps 1-3 happen inside OrderBook::matchOrder under one lock; each
+     * trade names the real resting order on the other side.
+     * 
      * @param order The order to process
      * @return Vector of trades that occurred
      */
     std::vector<Trade> processOrder(Order& order);
     
+    /**
+     * @brief Process an incoming order into a caller-owned trade buffer
+     * 
+     * Clears @p trades and writes this order's trades into it. Reusing one
+     * buffer across calls means no allocation once it has grown to the
+     * largest sweep seen. Registered onTrade callbacks still fire.
+     * 
+     * @return Number of trades written
+     */
+    size_t processOrder(Order& order, std::vector<Trade>& trades);
+    
+    /**
+     * @brief Same as above, and also hands each trade to @p listener
+     * 
+     * The listener is any callable taking const Trade&. It is called
+     * directly rather than through std::function, so it can be inlined.
+     * It runs after the book lock is released, before registered callbacks.
+     */
+    template <typename Listener>
+    size_t processOrder(Order& order, std::vector<Trade>& trades, Listener&& listener);
+    
+    /**
+     * @brief Process a run of incoming orders with one book lock
+     * 
+     * Orders are matched in vector order, exactly as if processOrder were
+     * called on each, but OrderBook is locked once for the whole run. The
+     * trades of all orders are written to @p trades (cleared first), in
+     * order, and share one timestamp. Callbacks fire after the lock is
+     * released.
+     * 
+     * @return Number of trades written
+     */
+    size_t processBatch(std::vector<Order>& orders, std::vector<Trade>& trades);
+    
+    /**
+     * @brief Same as above, and also hands each trade to @p listener
+     * 
+     * The listener is called as listener(const Order& incoming, const Trade&)
+     * so it can tell which order of the batch produced each trade.
+     */
+    template <typename Listener>
+    size_t processBatch(std::vector<Order>& orders, std::vector<Trade>& trades,
+                        Listener&& listener);
+    
     /**
      * @brief Cancel an existing order
      * @param orderId Order to cancel
@@ -114,25 +161,32 @@ private:
     std::vector<TradeCallback> m_tradeCallbacks;
     size_t m_tradeCount = 0;
     Quantity m_totalVolume = 0;
+    std::vector<Fill> m_fills;        // Reused across orders to avoid reallocating
+    std::vector<size_t> m_fillEnds;   // Per-order fill boundaries of a batch
     
     // ========================================================================
     // INTERNAL MATCHING LOGIC
     // ========================================================================
     
     /**
-     * @brief Try to match a BUY order against ASKs
+     * @brief Match an order and write its trades into @p trades
+     * 
+     * All trades from one incoming order share a single timestamp.
      */
-    std::vector<Trade> matchBuyOrder(Order& order);
+    void matchInto(Order& order, std::vector<Trade>& trades);
     
     /**
-     * @brief Try to match a SELL order against BIDs
+     * @brief Match a batch and write its trades into @p trades
+     * 
+     * Afterwards m_fillEnds[i] is the end of order i's trades in @p trades.
      */
-    std::vector<Trade> matchSellOrder(Order& order);
+    void matchBatchInto(std::vector<Order>& orders, std::vector<Trade>& trades);
     
     /**
-     * @brief Execute a trade between two orders
+     * @brief Append one trade per fill in [first, last) of the incoming order
      */
-    Trade executeTrade(Order& buyOrder, Order& sellOrder, Price price, Quantity qty);
+    void appendTrades(const Order& order, size_t first, size_t last,
+                      Timestamp timestamp, std::vector<Trade>& trades);
     
     /**
      * @brief Notify all callbacks of a trade
@@ -140,6 +194,35 @@ private:
     void notifyTrade(const Trade& trade);
 };
 
+// ============================================================================
+// TEMPLATE IMPLEMENTATION
+// ============================================================================
+
+template <typename Listener>
+size_t MatchingEngine::processOrder(Order& order, std::vector<Trade>& trades,
+                                    Listener&& listener) {
+    matchInto(order, trades);
+    for (const Trade& trade : trades) {
+        listener(trade);
+        notifyTrade(trade);
+    }
+    return trades.size();
+}
+
+template <typename Listener>
+size_t MatchingEngine::processBatch(std::vector<Order>& orders, std::vector<Trade>& trades,
+                                    Listener&& listener) {
+    matchBatchInto(orders, trades);
+    size_t next = 0;
+    for (size_t i = 0; i < orders.size(); ++i) {
+        for (; next < m_fillEnds[i]; ++next) {
+            listener(orders[i], trades[next]);
+            notifyTrade(trades[next]);
+        }
+    }
+    return trades.size();
+}
+
 } // namespace orderbook
 
 #endif // MATCHINGENGINE_H
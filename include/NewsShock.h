@@ -8,7 +8,7 @@
 #ifndef NEWS_SHOCK_H
 #define NEWS_SHOCK_H
 
-#include <random>
+#include "FastRng.h"
 #include <atomic>
 #include <chrono>
 #include <string>
@@ -44,7 +44,6 @@ public:
         , m_ticksSinceLastShock(0)
         , m_activeUntil(0)
         , m_cooldownUntil(0)
-        , m_gen(std::random_device{}())
     {}
     
     // Enable/disable shock window
@@ -116,7 +115,7 @@ public:
         std::string type;        // "bullish" or "bearish"
     };
     
-    ShockResult tryApplyShock() {
+    ShockResult tryApplyShock(FastRng& rng) {
         ShockResult result{false, 1.0, ""};
         
         if (!m_enabled) return result;
@@ -129,8 +128,7 @@ public:
         }
         
         // Random chance
-        std::uniform_real_distribution<> prob(0.0, 1.0);
-        if (prob(m_gen) >= NewsShockConfig::TRIGGER_CHANCE) {
+        if (rng.nextDouble() >= NewsShockConfig::TRIGGER_CHANCE) {
             return result;
         }
         
@@ -138,15 +136,12 @@ public:
         result.applied = true;
         
         // Random direction (50/50)
-        int direction = prob(m_gen) < 0.5 ? 1 : -1;
+        int direction = rng.nextDouble() < 0.5 ? 1 : -1;
         result.type = direction > 0 ? "bullish" : "bearish";
         
         // Fixed shock percentage: 1-3%
-        std::uniform_real_distribution<> shockDist(
-            NewsShockConfig::MIN_SHOCK_PERCENT,
-            NewsShockConfig::MAX_SHOCK_PERCENT
-        );
-        double shockPercent = shockDist(m_gen);
+        double shockPercent = NewsShockConfig::MIN_SHOCK_PERCENT + rng.nextDouble() *
+            (NewsShockConfig::MAX_SHOCK_PERCENT - NewsShockConfig::MIN_SHOCK_PERCENT);
         
         result.priceMultiplier = 1.0 + direction * shockPercent;
         
@@ -167,7 +162,6 @@ private:
     int m_ticksSinceLastShock;
     int64_t m_activeUntil;
     int64_t m_cooldownUntil;
-    std::mt19937 m_gen;
 };
 
 } // namespace orderbook
@@ -10,29 +10,97 @@
 
 #include "Common.h"
 #include "Order.h"
-#include <map>
-#include <unordered_map>
+#include "PriceLevelIndex.h"
+#include "OrderPool.h"
+#include "OrderIdIndex.h"
+#include "TopOfBook.h"
+#include <array>
+#include <cstdint>
 #include <vector>
-#include <list>
+#include <memory>
 #include <mutex>
 #include <optional>
 
 namespace orderbook {
 
 /**
- * @brief Represents all orders at a single price level
+ * @brief Construction options for an OrderBook
  * 
- * Multiple orders can exist at the same price. This class groups them
- * and maintains FIFO (first-in-first-out) order.
+ * The default is the original std::map layout. TICK_ARRAY keeps levels in
+ * a contiguous array indexed by tick offset; it only accepts prices that are
+ * exact multiples of tickSize and close enough to the live levels to fit
+ * the largest window (tickLevels * maxTickLevelsFactor).
  */
-struct PriceLevel {
-    Price price = 0.0;
-    Quantity totalQuantity = 0;
-    std::list<Order*> orders;  // List for efficient insert/remove
-    
-    void addOrder(Order* order);
-    void removeOrder(Order* order);
-    bool isEmpty() const { return orders.empty(); }
+struct OrderBookConfig {
+    BookBackend backend = BookBackend::MAP;
+    Price tickSize = DEFAULT_TICK_SIZE;  // Grid spacing for TICK_ARRAY
+    size_t tickLevels = 4096;            // Initial array window per side for TICK_ARRAY
+    size_t maxTickLevelsFactor = 16;     // Window never grows past tickLevels * this;
+                                         // prices that would need more are rejected
+    size_t orderCapacity = 1024;         // Resting-order slots preallocated by the pool
+    bool trackLevelChanges = false;      // Record touched levels for takeLevelChanges()
+};
+
+/**
+ * @brief One execution against a resting order, reported by matchOrder()
+ * 
+ * The incoming (taker) order is the one passed to matchOrder; the fill
+ * names the resting (maker) order it traded with.
+ */
+struct Fill {
+    OrderId  makerOrderId;
+    Price    price;        // The resting order's price level
+    Quantity quantity;
+};
+
+/**
+ * @brief How a price level differs from the last takeLevelChanges() call
+ */
+enum class LevelChangeType {
+    ADDED,      // Level did not exist before
+    CHANGED,    // Level existed; its total quantity is different now
+    REMOVED     // Level no longer exists (quantity is 0)
+};
+
+/**
+ * @brief One entry of a book change set (see OrderBook::takeLevelChanges)
+ */
+struct LevelChange {
+    Side            side;
+    Price           price;
+    Quantity        quantity;   // New total at this price (0 when REMOVED)
+    LevelChangeType type;
+};
+
+/**
+ * @brief Everything a publisher needs from the book, taken under one lock
+ * 
+ * Fixed capacity (no heap storage), so one instance can be reused for
+ * every frame. Both sides, the best prices and the counts all describe the
+ * same instant; sequence identifies that instant (it goes up by at least
+ * one on every change to the book).
+ */
+struct BookSnapshot {
+    static constexpr size_t MAX_DEPTH = 32;
+    
+    struct Level {
+        Price    price;
+        Quantity quantity = 0;
+    };
+    
+    std::array<Level, MAX_DEPTH> bids;   // Highest price first
+    std::array<Level, MAX_DEPTH> asks;   // Lowest price first
+    size_t bidCount = 0;                 // Valid entries in bids
+    size_t askCount = 0;                 // Valid entries in asks
+    
+    std::optional<Price> bestBid;
+    std::optional<Price> bestAsk;
+    std::optional<Price> spread;         // Set only when both sides exist
+    
+    size_t bidLevels = 0;                // Total levels per side, not just copied ones
+    size_t askLevels = 0;
+    size_t orderCount = 0;
+    uint64_t sequence = 0;
 };
 
 /**
@@ -44,6 +112,9 @@ struct PriceLevel {
  * 
  * Thread-safe: All public methods are protected by mutex.
  * 
+ * The level storage is chosen at construction (see OrderBookConfig); the
+ * public API is identical for both backends.
+ * 
  * Example usage:
  *   OrderBook book;
  *   book.addOrder(Order(1, Side::BUY, OrderType::LIMIT, 100.0, 50));
@@ -55,7 +126,8 @@ public:
     // CONSTRUCTORS
     // ========================================================================
     
-    OrderBook() = default;
+    OrderBook() : OrderBook(OrderBookConfig()) {}
+    explicit OrderBook(const OrderBookConfig& config);
     ~OrderBook();
     
     // Non-copyable (due to mutex and pointers)
@@ -74,7 +146,8 @@ public:
     /**
      * @brief Add a new order to the book
      * @param order The order to add
-     * @return true if successfully added
+     * @return true if successfully added (false on duplicate ID, or for
+     *         TICK_ARRAY books when the price is off the tick grid)
      */
     bool addOrder(const Order& order);
     
@@ -148,6 +221,37 @@ public:
      */
     Quantity fillQuantityAtPrice(Side side, Price price, Quantity quantity);
     
+    /**
+     * @brief Match an incoming order against the opposite side, in place
+     * 
+     * Under a single lock: walks the opposite side from the best level,
+     * filling resting orders FIFO until the incoming order is filled or
+     * the next level no longer crosses its limit price. Any LIMIT
+     * remainder then rests in the book. MARKET remainders are dropped.
+     * 
+     * Cost is proportional to the number of resting orders touched; no
+     * level snapshot is built.
+     * 
+     * @param order Incoming order (its fill state is updated)
+     * @param fills One entry per resting order traded against (appended)
+     * @return Total quantity filled
+     */
+    Quantity matchOrder(Order& order, std::vector<Fill>& fills);
+    
+    /**
+     * @brief Match a run of incoming orders, in arrival order, under one lock
+     * 
+     * Same as calling matchOrder on each order in turn, but the book lock is
+     * taken once for the whole run.
+     * 
+     * @param orders   First incoming order
+     * @param count    Number of orders
+     * @param fills    Fills of every order, in order (appended)
+     * @param fillEnds fills.size() after each order (appended, one per order)
+     */
+    void matchOrders(Order* orders, size_t count, std::vector<Fill>& fills,
+                     std::vector<size_t>& fillEnds);
+    
     // ========================================================================
     // BOOK SNAPSHOTS - For visualization
     // ========================================================================
@@ -166,6 +270,65 @@ public:
      */
     std::vector<std::pair<Price, Quantity>> getTopAsks(size_t n = 10) const;
     
+    /**
+     * @brief Copy a consistent view of the book under a single lock
+     * 
+     * Prefer this over separate getTopBids/getTopAsks/getBestBid/getBestAsk
+     * calls, which lock once each and can observe different book states.
+     * 
+     * @param depth Levels per side to copy (capped at BookSnapshot::MAX_DEPTH)
+     * @param out   Overwritten with the snapshot
+     */
+    void snapshot(size_t depth, BookSnapshot& out) const;
+    
+    /**
+     * @brief Change counter; increases on every modification of the book
+     */
+    uint64_t getSequence() const;
+    
+    // ========================================================================
+    // CHANGE SETS - For incremental publishing
+    // ========================================================================
+    
+    /**
+     * @brief Collect the levels that changed since the previous call
+     * 
+     * Needs OrderBookConfig::trackLevelChanges (otherwise always empty).
+     * Several changes to one level collapse into a single entry carrying
+     * its current total; a level that ends up where it started is left
+     * out. Bids come first (best first), then asks (best first).
+     * 
+     * @param out Replaced with the change set
+     */
+    void takeLevelChanges(std::vector<LevelChange>& out);
+    
+    /**
+     * @brief Make one side hold exactly the given levels, in place
+     * 
+     * Each target level ends up with the given total quantity; levels not
+     * in the list are removed. Levels whose total already matches are not
+     * touched, so the cost follows the number of levels that differ rather
+     * than the depth. New levels get one order with id nextOrderId++; a
+     * resized level is trimmed to its first order, which takes the new
+     * quantity. Meant for books whose depth is synthesized (one aggregate
+     * order per level), like the per-session books.
+     * 
+     * @param side        BUY or SELL
+     * @param levels      Target levels (price, total quantity); quantity 0 removes
+     * @param count       Number of target levels
+     * @param nextOrderId Id source for orders this creates
+     */
+    void updateLevels(Side side, const BookSnapshot::Level* levels, size_t count,
+                      OrderId& nextOrderId);
+    
+    /**
+     * @brief Best bid/ask, their sizes and the last trade - lock-free
+     * 
+     * Reads the copy the book publishes (through a seqlock) at the end of
+     * every change, so polling threads never wait on, or delay, matching.
+     */
+    TopOfBook getTopOfBook() const { return m_top.read(); }
+    
     // ========================================================================
     // STATISTICS
     // ========================================================================
@@ -173,22 +336,54 @@ public:
     size_t getBidLevelCount() const;
     size_t getAskLevelCount() const;
     size_t getTotalOrderCount() const;
+    
+    /**
+     * @brief Get resting-order pool occupancy (in use, high-water mark, capacity)
+     */
+    OrderPool::Stats getPoolStats() const;
+    
+    /**
+     * @brief Get the level storage this book was built with
+     */
+    BookBackend getBackend() const { return m_config.backend; }
 
 private:
     // ========================================================================
     // INTERNAL DATA STRUCTURES
     // ========================================================================
     
-    // Bids: sorted by price DESCENDING (highest first)
-    // We use std::greater<Price> for descending order
-    std::map<Price, PriceLevel, std::greater<Price>> m_bids;
+    OrderBookConfig m_config;
+    
+    // Bids: visited by price DESCENDING (highest first)
+    std::unique_ptr<PriceLevelIndex> m_bids;
+    
+    // Asks: visited by price ASCENDING (lowest first)
+    std::unique_ptr<PriceLevelIndex> m_asks;
+    
+    // Storage for every resting order (no per-order new/delete)
+    OrderPool m_pool;
     
-    // Asks: sorted by price ASCENDING (lowest first)
-    // Default std::map uses std::less (ascending)
-    std::map<Price, PriceLevel> m_asks;
+    // Fast lookup: OrderId -> resting node (the node's links give O(1)
+    // removal from its price level)
+    OrderIdIndex m_orderMap;
     
-    // Fast lookup: OrderId -> Order pointer
-    std::unordered_map<OrderId, Order*> m_orderMap;
+    // Bumped under m_mutex by every successful modification
+    uint64_t m_sequence = 0;
+    
+    // Levels touched since the last takeLevelChanges() (when tracking)
+    struct DirtyLevel {
+        Side     side;
+        Price    price;
+        Quantity before;   // Total when first touched
+    };
+    std::vector<DirtyLevel> m_dirtyLevels;
+    std::vector<Price> m_scratchPrices;   // Reused by updateLevels
+    
+    // Lock-free copy of the top of book for pollers (see TopOfBook.h)
+    TopOfBookSeqlock m_top;
+    uint64_t m_publishedSequence = 0;
+    Price m_lastTradePrice;
+    Quantity m_lastTradeQuantity = 0;
     
     // Thread safety
     mutable std::mutex m_mutex;
@@ -197,8 +392,20 @@ private:
     // INTERNAL HELPERS
     // ========================================================================
     
-    void addToBook(Order* order);
-    void removeFromBook(Order* order);
+    PriceLevelIndex& levelsFor(Side side) { return (side == Side::BUY) ? *m_bids : *m_asks; }
+    const PriceLevelIndex& levelsFor(Side side) const { return (side == Side::BUY) ? *m_bids : *m_asks; }
+    std::vector<std::pair<Price, Quantity>> topLevels(const PriceLevelIndex& levels, size_t n) const;
+    
+    bool insertOrder(const Order& order);
+    Quantity matchLocked(Order& order, std::vector<Fill>& fills);
+    Quantity fillLevel(PriceLevelIndex& levels, PriceLevel& level, Quantity quantity,
+                       std::vector<Fill>* fills);
+    void publishTopOfBook();
+    void markDirty(Side side, Price price, Quantity before);
+    void removeLevel(Side side, PriceLevel& level);
+    Side sideOf(const PriceLevelIndex& levels) const { return &levels == m_bids.get() ? Side::BUY : Side::SELL; }
+    void addToBook(RestingOrder* node);
+    void removeFromBook(RestingOrder* node);
 };
 
 } // namespace orderbook
@@ -0,0 +1,102 @@
+#ifndef ORDERIDINDEX_H
+#define ORDERIDINDEX_H
+
+// ============================================================================
+// ORDERIDINDEX.H - Flat hash index from OrderId to resting order node
+// ============================================================================
+// Replaces std::unordered_map<OrderId, RestingOrder*> inside the OrderBook.
+// All entries live in one contiguous array (open addressing, linear
+// probing), so lookups touch one or two cache lines and inserts never
+// allocate unless the table has to grow.
+//
+// Order IDs are mostly sequential. A plain "id & mask" hash gives great
+// locality for them but piles up when a long-lived block of old ids
+// aliases the block currently being inserted. Hashing small blocks of
+// consecutive ids with Fibonacci hashing keeps most of the locality while
+// scattering unrelated id ranges over the table.
+//
+// Deletion uses backward shifting rather than tombstones, so the table
+// never silts up with dead slots on a long-running cancel-heavy book.
+// ============================================================================
+
+#include "Common.h"
+#include <vector>
+
+namespace orderbook {
+
+struct RestingOrder;
+
+/**
+ * @brief Open-addressing hash index OrderId -> RestingOrder*
+ *
+ * A slot is empty when its value is nullptr, so any OrderId (including 0)
+ * can be used as a key. The table keeps its load factor at or below 1/2.
+ *
+ * Not thread-safe: the owning OrderBook serializes access with its mutex.
+ */
+class OrderIdIndex {
+public:
+    explicit OrderIdIndex(size_t expectedSize = 0);
+
+    /**
+     * @brief Find the node for an id
+     * @return The node, or nullptr if the id is not present
+     */
+    RestingOrder* find(OrderId id) const;
+
+    /**
+     * @brief Insert a new id
+     * @return false (and no change) if the id is already present
+     */
+    bool insert(OrderId id, RestingOrder* node);
+
+    /**
+     * @brief Remove an id
+     * @return true if the id was present
+     */
+    bool erase(OrderId id);
+
+    /**
+     * @brief Make room for at least n entries without growing
+     */
+    void reserve(size_t n);
+
+    /**
+     * @brief Remove all entries (keeps the allocated table)
+     */
+    void clear();
+
+    size_t size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+    size_t capacity() const { return m_slots.size(); }
+
+private:
+    struct Slot {
+        OrderId key = 0;
+        RestingOrder* value = nullptr;   // nullptr = empty slot
+    };
+
+    std::vector<Slot> m_slots;   // Size is always a power of two
+    size_t m_mask = 0;           // m_slots.size() - 1
+    unsigned m_shift = 0;        // 64 - log2(number of blocks)
+    size_t m_size = 0;
+
+    // Runs of 16 consecutive ids share a block of adjacent slots; blocks are
+    // placed by Fibonacci hashing (multiply by 2^64 / golden ratio, keep
+    // the top bits). Sequential ids therefore walk memory in order, while
+    // unrelated id ranges land in unrelated parts of the table.
+    static constexpr unsigned BLOCK_BITS = 4;
+    static constexpr OrderId BLOCK_MASK = (OrderId(1) << BLOCK_BITS) - 1;
+    static constexpr size_t MIN_CAPACITY = size_t(4) << BLOCK_BITS;  // >= 2 blocks
+
+    size_t homeSlot(OrderId id) const {
+        OrderId block = (id >> BLOCK_BITS) * 11400714819323198485ull;
+        return static_cast<size_t>(((block >> m_shift) << BLOCK_BITS) | (id & BLOCK_MASK));
+    }
+
+    void rehash(size_t newCapacity);
+};
+
+} // namespace orderbook
+
+#endif // ORDERIDINDEX_H
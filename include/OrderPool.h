@@ -0,0 +1,77 @@
+#ifndef ORDERPOOL_H
+#define ORDERPOOL_H
+
+// ============================================================================
+// ORDERPOOL.H - Slab allocator for resting order nodes
+// ============================================================================
+// The OrderBook takes a RestingOrder from this pool for every order that
+// rests and gives it back when the order fills or is cancelled. Nodes are
+// carved out of large slabs and recycled through a free list, so once the
+// pool has grown to the book's working size, add/fill/cancel never touch
+// the heap.
+// ============================================================================
+
+#include "PriceLevelIndex.h"
+#include <memory>
+#include <vector>
+
+namespace orderbook {
+
+/**
+ * @brief Free-list pool of RestingOrder nodes owned by one OrderBook
+ *
+ * The first slab holds capacityHint nodes. When the free list runs dry a
+ * new slab is added that doubles the total capacity. Slabs are only
+ * released when the pool is destroyed.
+ *
+ * Not thread-safe: the owning OrderBook serializes access with its mutex.
+ */
+class OrderPool {
+public:
+    /**
+     * @brief Occupancy counters, exposed through OrderBook::getPoolStats()
+     */
+    struct Stats {
+        size_t inUse = 0;       // Nodes currently handed out
+        size_t highWater = 0;   // Largest inUse seen over the pool's lifetime
+        size_t capacity = 0;    // Nodes allocated across all slabs
+        size_t slabs = 0;       // Number of slab allocations made
+    };
+
+    explicit OrderPool(size_t capacityHint);
+
+    // Non-copyable (nodes are referenced by address)
+    OrderPool(const OrderPool&) = delete;
+    OrderPool& operator=(const OrderPool&) = delete;
+
+    /**
+     * @brief Take a node and copy the order into it
+     * @return Unlinked node (prev/next are nullptr)
+     */
+    RestingOrder* acquire(const Order& order);
+
+    /**
+     * @brief Return a node to the free list
+     * @note The node must have come from this pool and be unlinked
+     */
+    void release(RestingOrder* node);
+
+    /**
+     * @brief Return every node to the free list (keeps the slabs)
+     */
+    void reset();
+
+    Stats getStats() const { return m_stats; }
+
+private:
+    std::vector<std::unique_ptr<RestingOrder[]>> m_slabs;
+    std::vector<size_t> m_slabSizes;
+    RestingOrder* m_freeList = nullptr;   // Singly linked through ->next
+    Stats m_stats;
+
+    void addSlab(size_t count);
+};
+
+} // namespace orderbook
+
+#endif // ORDERPOOL_H
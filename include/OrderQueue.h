@@ -15,6 +15,7 @@
 #include <condition_variable>
 #include <optional>
 #include <atomic>
+#include <vector>
 
 namespace orderbook {
 
@@ -92,6 +93,17 @@ public:
      */
     std::optional<Order> popWithTimeout(int timeoutMs);
     
+    /**
+     * @brief Drain up to maxCount orders in one operation
+     * 
+     * Waits up to timeoutMs for the first order, then takes whatever else
+     * is already queued (up to maxCount) without waiting again.
+     * 
+     * @param out Replaced with the drained orders, oldest first
+     * @return Number of orders drained (0 on timeout/shutdown)
+     */
+    size_t popBatch(std::vector<Order>& out, size_t maxCount, int timeoutMs);
+    
     // ========================================================================
     // QUEUE STATUS
     // ========================================================================
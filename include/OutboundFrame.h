@@ -0,0 +1,140 @@
+// ============================================================================
+// OUTBOUND FRAME - Refcounted WebSocket payload with LWS_PRE headroom
+// ============================================================================
+// lws_write() needs LWS_PRE writable bytes in front of the payload for the
+// frame header. An OutboundFrame reserves that headroom when it is created,
+// so encoders append the payload straight into it and the write callback
+// hands it to lws_write() as is: no staging buffer, no memcpy.
+//
+// Frames are shared through FrameRef (an intrusive reference count), so a
+// broadcast queues one frame for every client instead of a copy each. The
+// payload is not modified once queued; lws_write() does rewrite the
+// headroom, so with several service threads each thread gets its own copy
+// (WebSocketServer::broadcastFrame). A producer that keeps a FrameRef
+// can tell when every queue has let go (isShared() == false) and rebuild
+// the next message in the same storage.
+//
+//   FrameRef frame = FrameRef::create(false);      // Text frame
+//   JsonBuilder::tickToJson(frame->buffer(), ...); // Appends after headroom
+//   server.sendFrame(clientId, frame);
+// ============================================================================
+
+#ifndef OUTBOUND_FRAME_H
+#define OUTBOUND_FRAME_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace orderbook {
+
+class FrameRef;
+
+// ============================================================================
+// OUTBOUND FRAME
+// ============================================================================
+
+class OutboundFrame {
+public:
+    // Bytes reserved in front of the payload (>= LWS_PRE, checked where
+    // libwebsockets is included)
+    static constexpr size_t HEADROOM = 32;
+
+    /**
+     * @brief Storage to append the payload to (starts with HEADROOM bytes)
+     */
+    std::string& buffer() { return m_bytes; }
+
+    /**
+     * @brief Drop the payload, keeping the allocation
+     */
+    void reset(bool binary) {
+        m_bytes.assign(HEADROOM, '\0');
+        m_binary = binary;
+    }
+
+    const char* data() const { return m_bytes.data() + HEADROOM; }
+    size_t size() const { return m_bytes.size() - HEADROOM; }
+    std::string_view payload() const { return {data(), size()}; }
+    bool empty() const { return size() == 0; }
+    bool isBinary() const { return m_binary; }
+
+    /**
+     * @brief Payload start for lws_write(), which fills the headroom before it
+     *
+     * Every client of a shared frame gets the same header bytes (same
+     * length and opcode; server frames are not masked).
+     */
+    unsigned char* wireData() { return reinterpret_cast<unsigned char*>(&m_bytes[HEADROOM]); }
+
+    /**
+     * @brief True while any FrameRef besides the caller's one exists
+     */
+    bool isShared() const { return m_refs.load(std::memory_order_acquire) > 1; }
+
+private:
+    friend class FrameRef;
+
+    explicit OutboundFrame(bool binary) { reset(binary); }
+
+    std::string m_bytes;
+    bool m_binary = false;
+    std::atomic<uint32_t> m_refs{1};
+};
+
+// ============================================================================
+// FRAME REF
+// ============================================================================
+
+/**
+ * @brief Owning handle to an OutboundFrame (copy = share, last one frees)
+ */
+class FrameRef {
+public:
+    FrameRef() = default;
+
+    static FrameRef create(bool binary) { return FrameRef(new OutboundFrame(binary)); }
+
+    /**
+     * @brief Frame holding a copy of payload (for messages built elsewhere)
+     */
+    static FrameRef copyOf(std::string_view payload, bool binary) {
+        FrameRef frame = create(binary);
+        frame->buffer().append(payload);
+        return frame;
+    }
+
+    FrameRef(const FrameRef& other) : m_frame(other.m_frame) { retain(); }
+    FrameRef(FrameRef&& other) noexcept : m_frame(std::exchange(other.m_frame, nullptr)) {}
+    FrameRef& operator=(FrameRef other) noexcept {
+        std::swap(m_frame, other.m_frame);
+        return *this;
+    }
+    ~FrameRef() { release(); }
+
+    OutboundFrame* operator->() const { return m_frame; }
+    OutboundFrame& operator*() const { return *m_frame; }
+    explicit operator bool() const { return m_frame != nullptr; }
+
+private:
+    explicit FrameRef(OutboundFrame* frame) : m_frame(frame) {}
+
+    void retain() {
+        if (m_frame) m_frame->m_refs.fetch_add(1, std::memory_order_relaxed);
+    }
+    void release() {
+        // acq_rel: the last owner sees every other owner's reads finished
+        if (m_frame && m_frame->m_refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            delete m_frame;
+        }
+    }
+
+    OutboundFrame* m_frame = nullptr;
+};
+
+} // namespace orderbook
+
+#endif // OUTBOUND_FRAME_H
@@ -0,0 +1,122 @@
+// ============================================================================
+// OUTBOUND QUEUE - Per-client send queue that conflates superseded ticks
+// ============================================================================
+// A tick carries the whole current state (book, stats, candles), so when a
+// client has not yet been sent the previous tick, that tick is worthless:
+// the new one replaces it instead of queueing behind it. Everything else
+// (candleHistory, timeout, replies, ticks that complete a candle) is
+// delivered in order.
+//
+// Slow-consumer policy:
+//   - lag: ticks superseded in a row without the client taking one. A
+//     client that reaches OutboundQueueConfig::slowConsumerTicks is
+//     chronically slow and should be disconnected.
+//   - the queue never holds more than maxFrames; a must-deliver frame that
+//     does not fit is dropped (counted) and also marks the client slow.
+//
+// Not thread-safe: the server guards it with the owning client's mutex.
+// ============================================================================
+
+#ifndef OUTBOUND_QUEUE_H
+#define OUTBOUND_QUEUE_H
+
+#include "OutboundFrame.h"
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+
+namespace orderbook {
+
+// ============================================================================
+// CONFIGURATION
+// ============================================================================
+
+struct OutboundQueueConfig {
+    size_t maxFrames = 256;           // Hard cap on queued frames
+    uint32_t slowConsumerTicks = 100; // Lag that marks a client slow (0 = never)
+};
+
+/**
+ * @brief How a frame may be treated while it waits
+ */
+enum class FrameDelivery : uint8_t {
+    CONFLATE,   // Replaced by the next CONFLATE frame if still queued (ticks)
+    ALWAYS      // Must be delivered, in order
+};
+
+/**
+ * @brief Per-client counters (snapshot)
+ */
+struct OutboundQueueStats {
+    size_t queuedFrames = 0;
+    size_t queuedBytes = 0;
+    uint64_t conflated = 0;   // Ticks replaced before they were sent
+    uint64_t dropped = 0;     // Frames refused because the queue was full
+    uint32_t lagTicks = 0;    // Ticks superseded since the client last took one
+};
+
+// ============================================================================
+// OUTBOUND QUEUE
+// ============================================================================
+
+class OutboundQueue {
+public:
+    enum class PushResult : uint8_t {
+        QUEUED,      // Appended
+        CONFLATED,   // Appended, replacing a queued tick
+        DROPPED      // Queue full, frame discarded
+    };
+
+    explicit OutboundQueue(const OutboundQueueConfig& config = OutboundQueueConfig())
+        : m_config(config) {}
+
+    /**
+     * @brief Queue a frame; a CONFLATE frame replaces the queued one, if any
+     */
+    PushResult push(FrameRef frame, FrameDelivery delivery);
+
+    /**
+     * @brief True if the push cost the client a tick: one was replaced while
+     * queued, or the new one was dropped. A DELTA-feed client then misses
+     * level changes and needs a snapshot next.
+     */
+    static bool tickLost(PushResult result, FrameDelivery delivery) {
+        return result == PushResult::CONFLATED ||
+               (result == PushResult::DROPPED && delivery == FrameDelivery::CONFLATE);
+    }
+
+    /**
+     * @brief Next frame to send (empty FrameRef when there is none)
+     */
+    FrameRef pop();
+
+    bool empty() const { return m_entries.empty(); }
+    size_t size() const { return m_entries.size(); }
+
+    /**
+     * @brief True once the client has fallen behind the configured limits
+     */
+    bool isSlowConsumer() const;
+
+    OutboundQueueStats getStats() const;
+
+private:
+    struct Entry {
+        FrameRef frame;
+        FrameDelivery delivery;
+    };
+
+    OutboundQueueConfig m_config;
+    std::deque<Entry> m_entries;
+    size_t m_queuedBytes = 0;
+    bool m_hasConflatable = false;   // At most one CONFLATE entry is queued
+    bool m_overflowed = false;       // A must-deliver frame was dropped
+
+    uint64_t m_conflated = 0;
+    uint64_t m_dropped = 0;
+    uint32_t m_lagTicks = 0;
+};
+
+} // namespace orderbook
+
+#endif // OUTBOUND_QUEUE_H
@@ -7,9 +7,12 @@
 #ifndef PRICE_ENGINE_H
 #define PRICE_ENGINE_H
 
+#include "Common.h"
+#include "FastRng.h"
+#include "MarketSentiment.h"
+#include <array>
 #include <string>
 #include <cmath>
-#include <random>
 
 namespace orderbook {
 
@@ -38,6 +41,11 @@ struct PriceEngineConfig {
 // ============================================================================
 // Sentiment Parameters - Fine-tuned for realistic market behavior
 // ============================================================================
+// Every parameter of the price model lives in a constexpr table indexed by
+// the Sentiment / Intensity enums. Names are parsed once, when a command
+// arrives (MarketSentimentController::parseSentiment); the tick only
+// indexes arrays.
+// ============================================================================
 
 struct SentimentParams {
     double upProbability;      // Base probability of price going up (0.0-1.0)
@@ -46,101 +54,116 @@ struct SentimentParams {
     double reversalChance;     // Chance of sudden direction change (0.0-1.0)
     int maxConsecutive;        // Max consecutive moves before forced reversal
     bool meanReversion;        // Whether price tends to revert to a mean
+    double spikeChance;        // Chance of a double-sized move
+    bool erratic;              // Random up-probability and magnitude every tick
 };
 
-inline SentimentParams getSentimentParams(const std::string& sentiment) {
+// Indexed by Sentiment
+inline constexpr std::array<SentimentParams, SENTIMENT_COUNT> SENTIMENT_PARAMS = {{
     // BULLISH: Strong upward bias, moderate volatility, persistent trends
     // Price should steadily climb with occasional small pullbacks
-    if (sentiment == "BULLISH") return { 
+    {
         0.62,    // 62% chance of up move (was 68%)
         0.0004,  // 0.04% base volatility (was 0.06%)
         0.80,    // Strong trend persistence
         0.08,    // 8% chance of sudden reversal (was 5%)
         10,      // Allow up to 10 consecutive moves (was 12)
-        false    // No mean reversion
-    };
+        false,   // No mean reversion
+        0.0,
+        false
+    },
     
     // BEARISH: Strong downward bias, moderate volatility, persistent trends
     // Price should steadily decline with occasional small bounces
-    if (sentiment == "BEARISH") return { 
+    {
         0.38,    // 38% chance of up move (62% down, was 68%)
         0.0004,  // 0.04% base volatility (was 0.06%)
         0.80,    // Strong trend persistence
         0.08,    // 8% chance of sudden reversal (was 5%)
         10,      // Allow up to 10 consecutive moves (was 12)
-        false    // No mean reversion
-    };
+        false,   // No mean reversion
+        0.0,
+        false
+    },
     
     // VOLATILE: No directional bias, HIGH volatility, big swings both ways
     // Large price movements, can go either direction dramatically
-    if (sentiment == "VOLATILE") return { 
+    {
         0.50,    // 50% up/down (no bias)
         0.0012,  // 0.12% base volatility (was 0.20%)
         0.65,    // Moderate trend persistence
         0.18,    // 18% chance of sudden reversal
         6,       // Shorter consecutive limit (was 8)
-        false    // No mean reversion
-    };
+        false,   // No mean reversion
+        0.15,    // Double-sized move 15% of the time
+        false
+    },
     
-    // SIDEWAYS: No bias, VERY LOW volatility, mean-reverting
+    // CALM (SIDEWAYS): No bias, VERY LOW volatility, mean-reverting
     // Price stays in a tight range, always pulls back toward center
-    if (sentiment == "SIDEWAYS") return { 
+    {
         0.50,    // 50% up/down
         0.0002,  // 0.02% base volatility (VERY LOW)
         0.30,    // Weak trend persistence
         0.10,    // 10% reversal chance
         5,       // Short consecutive limit
-        true     // MEAN REVERSION enabled
-    };
+        true,    // MEAN REVERSION enabled
+        0.0,
+        false
+    },
     
     // CHOPPY: Frequent direction changes, medium volatility, erratic
     // Unpredictable, rapid reversals, no clear trend
-    if (sentiment == "CHOPPY") return { 
+    {
         0.50,    // 50% base (but modified per-tick)
         0.0010,  // 0.10% base volatility
         0.20,    // Very weak trend persistence (lots of reversals)
         0.35,    // 35% chance of sudden reversal (HIGH)
         3,       // Only 3 consecutive moves allowed (VERY SHORT)
-        false    // No mean reversion
-    };
+        false,   // No mean reversion
+        0.0,
+        true     // Up-probability 35-65%, magnitude 50-150% each tick
+    },
     
     // NEUTRAL: Balanced, low volatility, moderate behavior
-    return { 
+    {
         0.50,    // 50% up/down
         0.0004,  // 0.04% base volatility
         0.50,    // Moderate trend persistence
         0.10,    // 10% reversal chance
         8,       // Standard consecutive limit
-        false    // No mean reversion
-    };
+        false,   // No mean reversion
+        0.0,
+        false
+    },
+}};
+
+constexpr const SentimentParams& getSentimentParams(Sentiment sentiment) {
+    return SENTIMENT_PARAMS[sentimentIndex(sentiment)];
 }
 
 // Intensity affects how strong the price movements are
-inline double getIntensityMultiplier(const std::string& intensity) {
-    if (intensity == "MILD") return 0.4;       // Subdued moves
-    if (intensity == "MODERATE") return 0.7;   // Calmer than normal
-    if (intensity == "AGGRESSIVE") return 1.0; // Slightly amplified (was 1.2)
-    if (intensity == "EXTREME") return 1.25;   // Noticeably larger (was 1.6)
-    return 0.85; // NORMAL - baseline slightly reduced
-}
+struct IntensityParams {
+    double priceMultiplier;    // Scales price moves and news shocks
+    double volumeMultiplier;   // Scales trade sizes
+};
 
-// Volume multiplier for trade generation
-inline double getVolumeMultiplier(const std::string& intensity) {
-    if (intensity == "MILD") return 0.5;
-    if (intensity == "MODERATE") return 0.8;
-    if (intensity == "AGGRESSIVE") return 1.2;
-    if (intensity == "EXTREME") return 1.5;
-    return 1.0; // NORMAL
+// Indexed by Intensity
+inline constexpr std::array<IntensityParams, INTENSITY_COUNT> INTENSITY_PARAMS = {{
+    {0.4, 0.5},    // MILD - subdued moves
+    {0.7, 0.8},    // MODERATE - calmer than normal
+    {0.85, 1.0},   // NORMAL - baseline slightly reduced
+    {1.0, 1.2},    // AGGRESSIVE - slightly amplified (was 1.2)
+    {1.25, 1.5},   // EXTREME - noticeably larger (was 1.6)
+}};
+
+constexpr double getIntensityMultiplier(Intensity intensity) {
+    return INTENSITY_PARAMS[intensityIndex(intensity)].priceMultiplier;
 }
 
-// Buy probability for trade generation (affects trade ticker)
-inline double getBuyProbability(const std::string& sentiment) {
-    if (sentiment == "BULLISH") return 0.72;   // More buyers
-    if (sentiment == "BEARISH") return 0.28;   // More sellers
-    if (sentiment == "VOLATILE") return 0.50;  // Balanced chaos
-    if (sentiment == "SIDEWAYS") return 0.50;  // Balanced
-    if (sentiment == "CHOPPY") return 0.40 + (rand() / (double)RAND_MAX) * 0.20; // Random 40-60%
-    return 0.50; // NEUTRAL
+// Volume multiplier for trade generation
+constexpr double getVolumeMultiplier(Intensity intensity) {
+    return INTENSITY_PARAMS[intensityIndex(intensity)].volumeMultiplier;
 }
 
 struct DepthMultipliers {
@@ -148,17 +171,37 @@ struct DepthMultipliers {
     double askMultiplier;
 };
 
-inline DepthMultipliers getDepthMultipliers(const std::string& sentiment) {
-    if (sentiment == "BULLISH") return { 1.5, 0.7 };
-    if (sentiment == "BEARISH") return { 0.7, 1.5 };
-    if (sentiment == "VOLATILE") return { 0.6, 0.6 };
-    if (sentiment == "SIDEWAYS") return { 1.3, 1.3 };
-    if (sentiment == "CHOPPY") {
-        double r1 = 0.8 + (rand() / (double)RAND_MAX) * 0.6;
-        double r2 = 0.8 + (rand() / (double)RAND_MAX) * 0.6;
-        return { r1, r2 };
-    }
-    return { 1.0, 1.0 }; // NEUTRAL
+// Who trades and how deep each side of the book is, per sentiment
+struct TradeFlowParams {
+    double buyProbability;     // Share of trades that are buys
+    double buyJitter;          // Plus up to this much, at random
+    DepthMultipliers depth;
+    double depthJitter;        // Plus up to this much per side, at random
+};
+
+// Indexed by Sentiment
+inline constexpr std::array<TradeFlowParams, SENTIMENT_COUNT> TRADE_FLOW_PARAMS = {{
+    {0.72, 0.0, {1.5, 0.7}, 0.0},   // BULLISH - more buyers
+    {0.28, 0.0, {0.7, 1.5}, 0.0},   // BEARISH - more sellers
+    {0.50, 0.0, {0.6, 0.6}, 0.0},   // VOLATILE - balanced chaos
+    {0.50, 0.0, {1.3, 1.3}, 0.0},   // CALM (SIDEWAYS) - balanced
+    {0.40, 0.20, {0.8, 0.8}, 0.6},  // CHOPPY - random 40-60%
+    {0.50, 0.0, {1.0, 1.0}, 0.0},   // NEUTRAL
+}};
+
+// Buy probability for trade generation (affects trade ticker)
+inline double getBuyProbability(Sentiment sentiment, FastRng& rng) {
+    const TradeFlowParams& flow = TRADE_FLOW_PARAMS[sentimentIndex(sentiment)];
+    if (flow.buyJitter == 0.0) return flow.buyProbability;
+    return flow.buyProbability + rng.nextDouble() * flow.buyJitter;
+}
+
+inline DepthMultipliers getDepthMultipliers(Sentiment sentiment, FastRng& rng) {
+    const TradeFlowParams& flow = TRADE_FLOW_PARAMS[sentimentIndex(sentiment)];
+    if (flow.depthJitter == 0.0) return flow.depth;
+    double r1 = flow.depth.bidMultiplier + rng.nextDouble() * flow.depthJitter;
+    double r2 = flow.depth.askMultiplier + rng.nextDouble() * flow.depthJitter;
+    return { r1, r2 };
 }
 
 // ============================================================================
@@ -178,7 +221,8 @@ struct PriceResult {
 
 class PriceEngine {
 public:
-    PriceEngine() : m_rng(std::random_device{}()) {
+    // Draws from the owning session's generator
+    explicit PriceEngine(FastRng& rng) : m_rng(rng) {
         reset();
     }
     
@@ -187,12 +231,12 @@ public:
      */
     PriceResult calculateNextPrice(
         double currentPrice,
-        const std::string& sentiment,
-        const std::string& intensity,
+        Sentiment sentiment,
+        Intensity intensity,
         bool newsShockEnabled
     ) {
         double intensityMult = getIntensityMultiplier(intensity);
-        auto params = getSentimentParams(sentiment);
+        const SentimentParams& params = getSentimentParams(sentiment);
         
         PriceResult result;
         result.newPrice = currentPrice;
@@ -220,9 +264,7 @@ public:
                                       PriceEngineConfig::NEWS_SHOCK_MIN_PERCENT)) * intensityMult;
                 
                 // Apply shock directly
-                result.newPrice = currentPrice * (1.0 + shockDirection * result.shockPercent);
-                // Round to nearest 0.05 (tick size)
-                result.newPrice = std::round(result.newPrice * 20.0) / 20.0;
+                result.newPrice = roundToTick(currentPrice * (1.0 + shockDirection * result.shockPercent));
                 
                 // Record shock
                 result.shockType = shockDirection > 0 ? "bullish" : "bearish";
@@ -243,15 +285,13 @@ public:
         }
         
         // Normal price movement using full sentiment params
-        auto moveResult = calculateNormalMove(currentPrice, params, intensityMult, sentiment);
-        result.newPrice = currentPrice * (1.0 + moveResult.change);
-        // Round to nearest 0.05 (tick size)
-        result.newPrice = std::round(result.newPrice * 20.0) / 20.0;
+        auto moveResult = calculateNormalMove(currentPrice, params, intensityMult);
+        result.newPrice = roundToTick(currentPrice * (1.0 + moveResult.change));
         
         // CRITICAL: Ensure price actually moves (prevent stagnation at low prices)
         // If rounding caused no change, force a 1-tick move in the calculated direction
-        if (result.newPrice == currentPrice) {
-            result.newPrice = currentPrice + (moveResult.direction * 0.05);
+        if (Price(result.newPrice) == Price(currentPrice)) {
+            result.newPrice = (Price(currentPrice) + m_tickSize * moveResult.direction).toDouble();
         }
         
         // Enforce minimum price
@@ -269,6 +309,14 @@ public:
         m_anchorPrice = price;
     }
     
+    /**
+     * Tick size that every generated price is rounded to
+     */
+    Price getTickSize() const { return m_tickSize; }
+    void setTickSize(Price tickSize) {
+        if (tickSize > Price()) m_tickSize = tickSize;
+    }
+    
     /**
      * Reset engine state
      */
@@ -293,8 +341,7 @@ private:
     MoveResult calculateNormalMove(
         double currentPrice,
         const SentimentParams& params,
-        double intensityMult,
-        const std::string& sentiment
+        double intensityMult
     ) {
         int direction;
         double effectiveUpProb = params.upProbability;
@@ -311,7 +358,7 @@ private:
         }
         
         // === CHOPPY: Random probability variation per tick ===
-        if (sentiment == "CHOPPY") {
+        if (params.erratic) {
             // Add random noise to probability each tick
             effectiveUpProb = 0.35 + randomDouble() * 0.30; // Range: 35-65%
         }
@@ -374,12 +421,12 @@ private:
         double magnitude = baseMagnitude * intensityMult * pullbackFactor;
         
         // VOLATILE sentiment: occasionally spike the magnitude
-        if (sentiment == "VOLATILE" && randomDouble() < 0.15) {
-            magnitude *= 2.0; // Double-sized move 15% of the time
+        if (params.spikeChance > 0.0 && randomDouble() < params.spikeChance) {
+            magnitude *= 2.0; // Double-sized move
         }
         
         // CHOPPY sentiment: vary magnitude randomly
-        if (sentiment == "CHOPPY") {
+        if (params.erratic) {
             magnitude *= (0.5 + randomDouble()); // 50-150% of normal
         }
         
@@ -388,14 +435,16 @@ private:
     }
     
     double randomDouble() {
-        std::uniform_real_distribution<double> dist(0.0, 1.0);
-        return dist(m_rng);
+        return m_rng.nextDouble();
+    }
+    
+    double roundToTick(double price) const {
+        return Price(price).roundToTick(m_tickSize).toDouble();
     }
     
     int randomInt(int max) {
         if (max <= 0) return 0;
-        std::uniform_int_distribution<int> dist(0, max - 1);
-        return dist(m_rng);
+        return static_cast<int>(m_rng.nextBelow(static_cast<uint32_t>(max)));
     }
     
     // Trend tracking
@@ -410,8 +459,11 @@ private:
     int m_ticksSinceLastShock = 0;
     std::string m_lastShockType;
     
-    // Random number generator
-    std::mt19937 m_rng;
+    // Price grid for this symbol
+    Price m_tickSize = DEFAULT_TICK_SIZE;
+    
+    // Random number generator (the session's)
+    FastRng& m_rng;
 };
 
 } // namespace orderbook
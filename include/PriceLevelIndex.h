@@ -0,0 +1,222 @@
+#ifndef PRICELEVELINDEX_H
+#define PRICELEVELINDEX_H
+
+// ============================================================================
+// PRICELEVELINDEX.H - Storage backends for one side of the order book
+// ============================================================================
+// The OrderBook keeps its bids and asks in a PriceLevelIndex. Two backends
+// exist:
+//   - MapLevelIndex:  std::map keyed by price (any price, O(log n) lookups)
+//   - TickLevelIndex: contiguous array indexed by tick offset from a movable
+//                     base price (on-grid prices within a bounded window,
+//                     O(1) lookups)
+// ============================================================================
+
+#include "Common.h"
+#include "Order.h"
+#include <map>
+#include <vector>
+#include <memory>
+#include <functional>
+
+namespace orderbook {
+
+/**
+ * @brief An order resting in the book, linked into its price level's queue
+ *
+ * The links live in the node itself (an intrusive list), so an order that
+ * is found through the id map can be unlinked from its level in O(1)
+ * without searching the queue.
+ */
+struct RestingOrder {
+    Order order;
+    RestingOrder* prev = nullptr;
+    RestingOrder* next = nullptr;
+
+    RestingOrder() = default;
+    explicit RestingOrder(const Order& o) : order(o) {}
+};
+
+/**
+ * @brief Represents all orders at a single price level
+ *
+ * Multiple orders can exist at the same price. This class groups them
+ * and maintains FIFO (first-in-first-out) order as an intrusive doubly
+ * linked list of RestingOrder nodes. The level does not own the nodes.
+ */
+struct PriceLevel {
+    Price price;
+    Quantity totalQuantity = 0;
+    RestingOrder* head = nullptr;  // Oldest order (first to fill)
+    RestingOrder* tail = nullptr;  // Newest order
+    size_t orderCount = 0;
+
+    void addOrder(RestingOrder* node);     // Append at the back - O(1)
+    void removeOrder(RestingOrder* node);  // Unlink from anywhere - O(1)
+    bool isEmpty() const { return head == nullptr; }
+    void reset();                          // Drop all links (nodes untouched)
+};
+
+/**
+ * @brief Which data structure backs the price levels of an OrderBook
+ */
+enum class BookBackend {
+    MAP,        // std::map<Price, PriceLevel> - handles arbitrary prices
+    TICK_ARRAY  // Array indexed by tick offset - prices must be on the tick grid
+};
+
+/**
+ * @brief Interface for the price levels of ONE side of the book
+ *
+ * Levels are visited in priority order: highest price first for bids,
+ * lowest price first for asks.
+ */
+class PriceLevelIndex {
+public:
+    virtual ~PriceLevelIndex() = default;
+
+    /**
+     * @brief Check whether this index can hold a level at the given price
+     */
+    virtual bool accepts(Price price) const = 0;
+
+    /**
+     * @brief Find the level at a price
+     * @return Pointer to the level, or nullptr if no such level
+     */
+    virtual PriceLevel* find(Price price) = 0;
+    const PriceLevel* find(Price price) const {
+        return const_cast<PriceLevelIndex*>(this)->find(price);
+    }
+
+    /**
+     * @brief Find the level at a price, creating an empty one if needed
+     * @note Precondition: accepts(price) is true
+     */
+    virtual PriceLevel& getOrCreate(Price price) = 0;
+
+    /**
+     * @brief Remove the level at a price (no-op if absent)
+     */
+    virtual void erase(Price price) = 0;
+
+    /**
+     * @brief Get the best level (highest bid / lowest ask)
+     * @return Pointer to the best level, or nullptr if the side is empty
+     */
+    virtual PriceLevel* best() = 0;
+    const PriceLevel* best() const {
+        return const_cast<PriceLevelIndex*>(this)->best();
+    }
+
+    virtual size_t size() const = 0;
+    bool empty() const { return size() == 0; }
+
+    /**
+     * @brief Remove all levels
+     */
+    virtual void clear() = 0;
+
+    /**
+     * @brief Visit levels in priority order until fn returns false
+     * @param fn Callable taking (const PriceLevel&) and returning bool
+     */
+    template <typename Fn>
+    void forEachLevel(Fn&& fn) const {
+        std::function<bool(const PriceLevel&)> visitor = std::ref(fn);
+        visitLevels(visitor);
+    }
+
+protected:
+    virtual void visitLevels(const std::function<bool(const PriceLevel&)>& visitor) const = 0;
+};
+
+/**
+ * @brief Price levels stored in a std::map (original OrderBook layout)
+ *
+ * @tparam Compare std::greater<Price> for bids, std::less<Price> for asks
+ */
+template <typename Compare>
+class MapLevelIndex : public PriceLevelIndex {
+public:
+    bool accepts(Price /*price*/) const override { return true; }
+    PriceLevel* find(Price price) override;
+    PriceLevel& getOrCreate(Price price) override;
+    void erase(Price price) override;
+    PriceLevel* best() override;
+    size_t size() const override { return m_levels.size(); }
+    void clear() override { m_levels.clear(); }
+
+protected:
+    void visitLevels(const std::function<bool(const PriceLevel&)>& visitor) const override;
+
+private:
+    std::map<Price, PriceLevel, Compare> m_levels;
+};
+
+/**
+ * @brief Price levels stored in a contiguous array indexed by tick offset
+ *
+ * Slot i holds the level at price (baseTick + i) * tickSize. The best level
+ * is tracked directly, so best() is O(1) and adding/removing a level never
+ * touches the heap unless the window has to grow.
+ *
+ * When a price falls outside the current window the base is moved (and the
+ * array grown if needed) so that the new price and every live level fit.
+ * The window never grows past maxCapacity slots: a price that would need a
+ * wider one (a stray order far from the book) is not accepted, instead of
+ * allocating a level for every tick in between.
+ */
+class TickLevelIndex : public PriceLevelIndex {
+public:
+    /**
+     * @param side      BUY (best = highest) or SELL (best = lowest)
+     * @param tickSize  Price increment between adjacent slots
+     * @param capacity     Initial number of slots in the window
+     * @param maxCapacity  Largest window; at least capacity
+     */
+    TickLevelIndex(Side side, Price tickSize, size_t capacity, size_t maxCapacity);
+
+    bool accepts(Price price) const override;
+    PriceLevel* find(Price price) override;
+    PriceLevel& getOrCreate(Price price) override;
+    void erase(Price price) override;
+    PriceLevel* best() override;
+    size_t size() const override { return m_count; }
+    void clear() override;
+
+    size_t capacity() const { return m_levels.size(); }
+    size_t maxCapacity() const { return m_maxCapacity; }
+
+protected:
+    void visitLevels(const std::function<bool(const PriceLevel&)>& visitor) const override;
+
+private:
+    Side m_side;
+    Price m_tickSize;
+    size_t m_maxCapacity;
+    int64_t m_baseTick = 0;            // Absolute tick number of slot 0
+    std::vector<PriceLevel> m_levels;
+    std::vector<char> m_present;       // 1 if slot holds a live level
+    size_t m_count = 0;                // Number of live levels
+    long long m_best = -1;             // Slot of the best level, -1 if empty
+
+    int64_t toTick(Price price) const;
+    bool slotOf(int64_t tick, size_t& slot) const;
+    bool isBetter(size_t a, size_t b) const;
+    bool fitsWindow(int64_t tick) const;
+    void liveRange(int64_t& lowTick, int64_t& highTick) const;
+    void rebase(int64_t tick);
+    void findNextBest();
+};
+
+/**
+ * @brief Create the level index for one side of a book
+ */
+std::unique_ptr<PriceLevelIndex> makePriceLevelIndex(Side side, BookBackend backend,
+                                                     Price tickSize, size_t tickLevels,
+                                                     size_t maxTickLevels);
+
+} // namespace orderbook
+
+#endif // PRICELEVELINDEX_H
@@ -8,15 +8,18 @@
 #define SESSION_STATE_H
 
 #include <string>
+#include <vector>
 #include <atomic>
 #include <chrono>
 #include <memory>
-#include <cstdlib>
 #include "MarketSentiment.h"
 #include "PriceEngine.h"
 #include "CandleManager.h"
 #include "NewsShock.h"
 #include "OrderBook.h"
+#include "OutboundFrame.h"
+#include "CommandMailbox.h"
+#include "FastRng.h"
 
 namespace orderbook {
 
@@ -26,7 +29,7 @@ namespace orderbook {
 
 struct TradeData {
     int64_t id;
-    double price;
+    Price price;
     int quantity;
     std::string side;  // "BUY" or "SELL"
     int64_t timestamp;
@@ -34,25 +37,78 @@ struct TradeData {
     bool isValid() const { return id > 0; }
 };
 
+// ============================================================================
+// Session Stats (the "stats" part of a tick, whatever the encoding)
+// ============================================================================
+
+struct SessionStats {
+    std::string symbol;
+    Price currentPrice;
+    Price openPrice;
+    Price highPrice;
+    Price lowPrice;
+    size_t totalOrders = 0;
+    size_t totalTrades = 0;
+    size_t totalVolume = 0;
+    int marketOrderPct = 0;
+    std::string sentiment;
+    std::string intensity;
+    double spread = 0.0;
+    double speed = 1.0;
+    bool paused = false;
+    bool newsShockEnabled = false;
+    bool newsShockCooldown = false;
+    int newsShockCooldownRemaining = 0;
+    int newsShockActiveRemaining = 0;
+};
+
+// ============================================================================
+// Wire Format (chosen per client with the "encoding" command)
+// ============================================================================
+
+enum class WireFormat {
+    JSON,     // Text frames (default)
+    BINARY    // Little-endian binary frames, see BinaryEncoder.h
+};
+
+// ============================================================================
+// Order Book Feed (how tick messages carry the book, chosen per client)
+// ============================================================================
+
+enum class BookFeedMode {
+    FULL,   // Every tick carries the top levels ("orderbook" field)
+    DELTA   // Sequence-numbered level changes plus periodic snapshots ("book" field)
+};
+
+// Book payload of one DELTA-mode tick (see JsonBuilder::tickToJson)
+struct BookFrame {
+    uint64_t sequence = 0;                              // +1 per frame; a gap means loss
+    bool snapshot = false;                              // Full levels instead of changes
+    const std::vector<LevelChange>* changes = nullptr;  // Changes since the previous frame
+};
+
 // ============================================================================
 // Session Configuration
 // ============================================================================
 
 struct SessionConfig {
     std::string symbol = "DEMO";
+    Price tickSize = DEFAULT_TICK_SIZE;  // Price grid for this symbol
     double basePrice = 100.0;
     double spread = 0.05;
     Sentiment sentiment = Sentiment::NEUTRAL;
     Intensity intensity = Intensity::NORMAL;
     double speed = 1.0;
+    uint64_t seed = 0;  // Session RNG seed (0 = pick a random one)
     
     void validate() {
         basePrice = std::max(100.0, std::min(500.0, basePrice));
         spread = std::max(0.05, std::min(0.25, spread));
         speed = std::max(0.25, std::min(2.0, speed));
         // Round to tick size
-        basePrice = std::round(basePrice / 0.05) * 0.05;
-        spread = std::round(spread / 0.05) * 0.05;
+        if (tickSize <= Price()) tickSize = DEFAULT_TICK_SIZE;
+        basePrice = Price(basePrice).roundToTick(tickSize).toDouble();
+        spread = Price(spread).roundToTick(tickSize).toDouble();
     }
 };
 
@@ -68,21 +124,40 @@ public:
         , m_config(config)
         , m_running(false)
         , m_paused(false)
+        , m_priceEngine(m_rng)
+        , m_orderGenerator(m_sentimentController, m_rng)
+        , m_orderBook(bookConfig())
     {
         m_config.validate();
+        if (m_config.seed == 0) {
+            m_config.seed = FastRng::randomSeed();
+        }
         reset();
     }
     
     // Session ID
     uint32_t getId() const { return m_sessionId; }
     
+    // The session's only random source: every component draws from it, so
+    // the seed (logged at connect) replays the session
+    FastRng& getRng() { return m_rng; }
+    uint64_t getSeed() const { return m_config.seed; }
+    
     // Configuration
     const SessionConfig& getConfig() const { return m_config; }
     void setConfig(const SessionConfig& config) {
+        uint64_t seed = m_config.seed;
         m_config = config;
         m_config.validate();
+        if (m_config.seed == 0) m_config.seed = seed;
     }
     
+    // Client commands: posted by the receive thread, applied by the tick
+    // right before it steps the session (single owner, no lock)
+    void postCommand(SessionCommand command) { m_commands.post(std::move(command)); }
+    template <typename Fn>
+    size_t drainCommands(Fn&& fn) { return m_commands.drain(std::forward<Fn>(fn)); }
+    
     // Control
     bool isRunning() const { return m_running; }
     void setRunning(bool running) { m_running = running; }
@@ -131,6 +206,7 @@ public:
     
     size_t getTotalTrades() const { return m_totalTrades; }
     void addTrade() { m_totalTrades++; }
+    int64_t getTradeSequence() const { return m_tradeCounter; }  // Trades generated, never reset
     
     // Generate a trade for visualization
     TradeData generateTrade(double currentPrice, int64_t timestamp) {
@@ -141,19 +217,17 @@ public:
         int64_t uniqueId = static_cast<int64_t>(m_sessionId) * 1000000 + m_tradeCounter;
         
         // Buy probability based on sentiment
-        double buyProb = getBuyProbability(MarketSentimentController::getSentimentNameSimple(getSentiment()));
-        bool isBuy = (rand() / (double)RAND_MAX) < buyProb;
+        double buyProb = getBuyProbability(getSentiment(), m_rng);
+        bool isBuy = m_rng.nextDouble() < buyProb;
         
         // Small slippage for realism
-        double slippage = (rand() / (double)RAND_MAX) * 0.02 + 0.01;
-        double price = currentPrice + (isBuy ? slippage : -slippage);
-        // Round to tick size (0.05)
-        price = std::round(price * 20.0) / 20.0;
+        double slippage = m_rng.nextDouble() * 0.02 + 0.01;
+        Price price = Price(currentPrice + (isBuy ? slippage : -slippage))
+                          .roundToTick(m_config.tickSize);
         
         // Quantity based on intensity
-        double volMultiplier = getVolumeMultiplier(
-            MarketSentimentController::getIntensityNameSimple(getIntensity()));
-        int baseQty = 10 + (rand() % 100);
+        double volMultiplier = getVolumeMultiplier(getIntensity());
+        int baseQty = 10 + static_cast<int>(m_rng.nextBelow(100));
         int quantity = static_cast<int>(baseQty * volMultiplier);
         
         return TradeData{
@@ -175,8 +249,46 @@ public:
     void addMarketOrder() { m_marketOrders++; }
     void addLimitOrder() { m_limitOrders++; }
     
+    // Wire format - set from the server thread, read by the tick loop
+    WireFormat getWireFormat() const { return m_wireFormat; }
+    void setWireFormat(WireFormat format) { m_wireFormat = format; }
+    
+    // Book feed - mode and resync requests come from the server thread
+    BookFeedMode getBookFeedMode() const { return m_bookFeedMode; }
+    void setBookFeedMode(BookFeedMode mode) {
+        m_bookFeedMode = mode;
+        m_bookResyncRequested = true;  // A new DELTA client starts from a snapshot
+    }
+    void requestBookResync() { m_bookResyncRequested = true; }
+    
+    // Drain this tick's book changes and decide what the tick carries.
+    // Returns false in FULL mode (the tick sends the levels themselves).
+    bool nextBookFrame(BookFrame& frame) {
+        m_orderBook.takeLevelChanges(m_levelChanges);  // Every tick, used or not
+        if (m_bookFeedMode != BookFeedMode::DELTA) return false;
+        
+        frame.sequence = ++m_bookSequence;
+        frame.snapshot = m_bookResyncRequested.exchange(false) ||
+                         ++m_ticksSinceSnapshot >= BOOK_RESYNC_TICKS;
+        if (frame.snapshot) m_ticksSinceSnapshot = 0;
+        frame.changes = &m_levelChanges;
+        return true;
+    }
+    
+    // Outbound tick frame for the tick loop: the previous one is reused once
+    // the server has written it everywhere (else a fresh one is started), so
+    // encoding a tick neither allocates nor gets copied on the way out
+    FrameRef acquireTickFrame(bool binary) {
+        if (!m_tickFrame || m_tickFrame->isShared()) {
+            m_tickFrame = FrameRef::create(binary);
+        }
+        m_tickFrame->reset(binary);
+        return m_tickFrame;
+    }
+    
     // Components access
     MarketSentimentController& getSentimentController() { return m_sentimentController; }
+    SentimentOrderGenerator& getOrderGenerator() { return m_orderGenerator; }
     PriceEngine& getPriceEngine() { return m_priceEngine; }
     CandleManager& getCandleManager() { return m_candleManager; }
     NewsShockController& getNewsShockController() { return m_newsShockController; }
@@ -190,6 +302,7 @@ public:
     
     // Reset session to initial state
     void reset() {
+        m_rng.reseed(m_config.seed);  // A reset replays from the start
         m_currentPrice = m_config.basePrice;
         m_openPrice = m_config.basePrice;
         m_highPrice = m_config.basePrice;
@@ -203,10 +316,13 @@ public:
         
         m_sentimentController.setMarketCondition(m_config.sentiment, m_config.intensity);
         m_sentimentController.setSpread(m_config.spread);
+        m_orderGenerator.setBasePrice(m_config.basePrice);
         m_priceEngine.reset();
+        m_priceEngine.setTickSize(m_config.tickSize);
         m_candleManager.reset();
         m_newsShockController.reset();
-        // Note: OrderBook doesn't have clear(), and we regenerate it each tick anyway
+        // Note: the order book is refreshed every tick anyway
+        m_bookResyncRequested = true;
     }
     
     // Last update timestamp
@@ -214,11 +330,22 @@ public:
     void setLastUpdateTime(int64_t time) { m_lastUpdateTime = time; }
     
 private:
+    // DELTA clients get a full snapshot at least every this many ticks. Ticks
+    // come every 100ms / speed: ~20s at 1x, ~10s at 2x, ~40s at 0.5x
+    static constexpr int BOOK_RESYNC_TICKS = 200;
+    
+    // Session books feed DELTA clients, so they record level changes
+    static OrderBookConfig bookConfig() {
+        OrderBookConfig config;
+        config.trackLevelChanges = true;
+        return config;
+    }
+    
     uint32_t m_sessionId;
     SessionConfig m_config;
     
     // Control state
-    bool m_running;
+    std::atomic<bool> m_running;  // Also read by the server (getAllSessions)
     bool m_paused;
     
     // Price tracking
@@ -238,12 +365,27 @@ private:
     // Timestamp tracking
     int64_t m_lastUpdateTime = 0;
     
+    CommandMailbox m_commands;
+    FastRng m_rng;  // Before the components that hold a reference to it
+    
     // Per-session components
     MarketSentimentController m_sentimentController;
     PriceEngine m_priceEngine;
+    SentimentOrderGenerator m_orderGenerator;  // Depth refresh; keeps its scratch between ticks
     CandleManager m_candleManager;
     NewsShockController m_newsShockController;
     OrderBook m_orderBook;
+    
+    std::atomic<WireFormat> m_wireFormat{WireFormat::JSON};
+    
+    // Book feed state
+    std::atomic<BookFeedMode> m_bookFeedMode{BookFeedMode::FULL};
+    std::atomic<bool> m_bookResyncRequested{true};
+    uint64_t m_bookSequence = 0;
+    int m_ticksSinceSnapshot = 0;
+    std::vector<LevelChange> m_levelChanges;
+    
+    FrameRef m_tickFrame;
 };
 
 } // namespace orderbook
@@ -0,0 +1,193 @@
+#ifndef SPSCORDERQUEUE_H
+#define SPSCORDERQUEUE_H
+
+// ============================================================================
+// SPSCORDERQUEUE.H - Lock-free single-producer single-consumer order queue
+// ============================================================================
+// Drop-in alternative to OrderQueue for the common case of exactly one
+// producer thread (the order generator) and one consumer thread (the order
+// processor). Orders live in a fixed ring; the two sides only share two
+// indices, each on its own cache line, so a hand-off is a couple of atomic
+// loads and stores instead of a mutex, a condition variable and a futex.
+//
+// Waiting is spin-then-park: a consumer that finds the ring empty spins
+// briefly (most hand-offs arrive within that window), then sleeps on a
+// condition variable. The producer only touches that condition variable
+// when the consumer has announced it is parked.
+// ============================================================================
+
+#include "Order.h"
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+namespace orderbook {
+
+/**
+ * @brief Bounded lock-free SPSC queue for orders
+ *
+ * Same push / pop / tryPop / popWithTimeout / shutdown semantics as
+ * OrderQueue, with two restrictions:
+ * - Only ONE thread may push and only ONE thread may pop at a time
+ * - Capacity is fixed; push() waits for space when the ring is full
+ *
+ * Example:
+ *   SpscOrderQueue queue(4096);
+ *
+ *   // Producer thread
+ *   queue.push(Order(...));
+ *
+ *   // Consumer thread
+ *   auto order = queue.popWithTimeout(100);
+ */
+class SpscOrderQueue {
+public:
+    /**
+     * @brief Create a queue
+     * @param capacity Minimum number of queued orders (rounded up to a power of two)
+     */
+    explicit SpscOrderQueue(size_t capacity = 4096);
+    ~SpscOrderQueue() = default;
+
+    // Non-copyable
+    SpscOrderQueue(const SpscOrderQueue&) = delete;
+    SpscOrderQueue& operator=(const SpscOrderQueue&) = delete;
+
+    // ========================================================================
+    // PRODUCER METHODS (one thread only)
+    // ========================================================================
+
+    /**
+     * @brief Add an order, waiting for space if the ring is full
+     *
+     * Returns without queueing the order if shutdown() is called while
+     * waiting for space.
+     */
+    void push(const Order& order);
+
+    /**
+     * @brief Add an order without waiting
+     * @return false if the ring is full
+     */
+    bool tryPush(const Order& order);
+
+    // ========================================================================
+    // CONSUMER METHODS (one thread only)
+    // ========================================================================
+
+    /**
+     * @brief Remove and return the next order (blocking)
+     * @return The next order, or std::nullopt if shutting down and empty
+     */
+    std::optional<Order> pop();
+
+    /**
+     * @brief Try to remove an order without waiting
+     * @return The next order, or std::nullopt if queue is empty
+     */
+    std::optional<Order> tryPop();
+
+    /**
+     * @brief Wait for an order with a timeout
+     * @param timeoutMs Maximum time to wait in milliseconds
+     * @return The next order, or std::nullopt if timeout/shutdown
+     */
+    std::optional<Order> popWithTimeout(int timeoutMs);
+
+    /**
+     * @brief Drain up to maxCount orders in one operation
+     *
+     * Waits up to timeoutMs for the first order, then takes whatever else
+     * is already queued (up to maxCount) and frees all of their slots with
+     * one index store.
+     *
+     * @param out Replaced with the drained orders, oldest first
+     * @return Number of orders drained (0 on timeout/shutdown)
+     */
+    size_t popBatch(std::vector<Order>& out, size_t maxCount, int timeoutMs);
+
+    /**
+     * @brief Drop all queued orders (consumer side)
+     */
+    void clear();
+
+    // ========================================================================
+    // QUEUE STATUS
+    // ========================================================================
+
+    /**
+     * @brief Check if queue is empty (a snapshot when called concurrently)
+     */
+    bool empty() const { return size() == 0; }
+
+    /**
+     * @brief Get number of orders in queue (a snapshot when called concurrently)
+     */
+    size_t size() const;
+
+    /**
+     * @brief Number of orders the ring can hold
+     */
+    size_t capacity() const { return m_mask + 1; }
+
+    // ========================================================================
+    // LIFECYCLE
+    // ========================================================================
+
+    /**
+     * @brief Signal shutdown - unblocks a waiting consumer and producer
+     *
+     * Orders already queued can still be popped.
+     */
+    void shutdown();
+
+    /**
+     * @brief Check if shutdown was requested
+     */
+    bool isShutdown() const { return m_shutdown.load(std::memory_order_acquire); }
+
+private:
+    static constexpr size_t CACHE_LINE = 64;
+
+    // Ring storage, written by the producer and read by the consumer
+    std::unique_ptr<Order[]> m_ring;
+    size_t m_mask;
+
+    // Consumer-owned: next slot to read, plus its last view of m_tail
+    alignas(CACHE_LINE) std::atomic<size_t> m_head{0};
+    size_t m_cachedTail = 0;
+
+    // Producer-owned: next slot to write, plus its last view of m_head
+    alignas(CACHE_LINE) std::atomic<size_t> m_tail{0};
+    size_t m_cachedHead = 0;
+
+    // Parking - only used once the consumer has given up spinning
+    alignas(CACHE_LINE) std::atomic<bool> m_consumerParked{false};
+    std::atomic<bool> m_shutdown{false};
+    std::mutex m_parkMutex;
+    std::condition_variable m_parkCondition;
+
+    /**
+     * @brief Pop the front order if there is one (no waiting)
+     */
+    bool popInto(Order& out);
+
+    /**
+     * @brief Wake the consumer if it is parked
+     */
+    void wakeConsumer();
+
+    /**
+     * @brief Spin, then park until an order arrives, shutdown, or the deadline
+     * @return true if an order is available
+     */
+    template <typename Deadline>
+    bool waitForOrder(const Deadline& deadline);
+};
+
+} // namespace orderbook
+
+#endif // SPSCORDERQUEUE_H
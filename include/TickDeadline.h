@@ -0,0 +1,76 @@
+#ifndef TICKDEADLINE_H
+#define TICKDEADLINE_H
+
+// ============================================================================
+// TICKDEADLINE.H - How long each tick takes against its time budget
+// ============================================================================
+// Each time the tick loop wakes it steps the sessions that are due.
+// record() is given how long that took; the window counters (reset by the
+// periodic report) say how close the loop runs to its 50ms budget and how
+// many ticks overran.
+//
+// Not thread-safe: owned by the tick loop.
+// ============================================================================
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace orderbook {
+
+/**
+ * @brief Tick timings for one reporting window
+ */
+struct TickDeadlineStats {
+    uint64_t ticks = 0;
+    uint64_t overruns = 0;      // Ticks that took longer than the budget
+    double avgMs = 0.0;
+    double maxMs = 0.0;
+    size_t maxSessions = 0;     // Most sessions stepped in one tick
+};
+
+class TickDeadline {
+public:
+    explicit TickDeadline(std::chrono::milliseconds budget = std::chrono::milliseconds(50))
+        : m_budget(budget) {}
+
+    /**
+     * @brief Account one tick that stepped `sessions` sessions
+     */
+    void record(std::chrono::nanoseconds elapsed, size_t sessions) {
+        ++m_stats.ticks;
+        if (elapsed > m_budget) {
+            ++m_stats.overruns;
+        }
+        double ms = std::chrono::duration<double, std::milli>(elapsed).count();
+        m_totalMs += ms;
+        m_stats.maxMs = std::max(m_stats.maxMs, ms);
+        m_stats.maxSessions = std::max(m_stats.maxSessions, sessions);
+    }
+
+    /**
+     * @brief Timings since the last reset
+     */
+    TickDeadlineStats window() const {
+        TickDeadlineStats stats = m_stats;
+        stats.avgMs = stats.ticks ? m_totalMs / static_cast<double>(stats.ticks) : 0.0;
+        return stats;
+    }
+
+    void reset() {
+        m_stats = TickDeadlineStats();
+        m_totalMs = 0.0;
+    }
+
+    std::chrono::milliseconds budget() const { return m_budget; }
+
+private:
+    std::chrono::milliseconds m_budget;
+    TickDeadlineStats m_stats;
+    double m_totalMs = 0.0;
+};
+
+} // namespace orderbook
+
+#endif // TICKDEADLINE_H
@@ -0,0 +1,199 @@
+#ifndef TICKSCHEDULER_H
+#define TICKSCHEDULER_H
+
+// ============================================================================
+// TICKSCHEDULER.H - Per-session tick deadlines (min-heap)
+// ============================================================================
+// Each session ticks at its own rate (100ms / speed). The scheduler keeps
+// every session's next due time in a min-heap, so the tick loop sleeps
+// exactly until the earliest one and steps only the sessions that are due,
+// instead of polling all of them on a fixed 50ms beat.
+//
+// A due session is handed out once and is "in flight" until complete():
+// the next deadline is then due + interval (fixed rate, so lateness does
+// not accumulate). A session that fell a whole interval behind skips the
+// missed ticks rather than bursting to catch up.
+//
+// Per session, complete() also records:
+//   drift  - how late the step started against its deadline
+//   jitter - how far the time between two steps was from the interval
+//
+// A session may carry an opaque context (the server passes its client
+// handle), handed back with every Due so the tick loop needs no lookup.
+//
+// Thread-safe: commands add sessions and change rates from the WebSocket
+// threads while the tick loop waits and completes.
+// ============================================================================
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <unordered_map>
+#include <vector>
+
+namespace orderbook {
+
+/**
+ * @brief Drift and jitter of one session in the current window
+ */
+struct SessionTiming {
+    uint32_t id = 0;
+    uint64_t steps = 0;
+    double avgDriftMs = 0.0;
+    double maxDriftMs = 0.0;
+    double avgJitterMs = 0.0;
+    double maxJitterMs = 0.0;
+};
+
+/**
+ * @brief Totals over all sessions in the current window
+ */
+struct TickSchedulerStats {
+    size_t sessions = 0;        // Sessions currently scheduled
+    uint64_t steps = 0;
+    uint64_t skipped = 0;       // Ticks dropped by sessions running behind
+    double avgDriftMs = 0.0;
+    double maxDriftMs = 0.0;
+    double avgJitterMs = 0.0;
+    double maxJitterMs = 0.0;
+    uint32_t worstSession = 0;  // Session with the largest drift
+};
+
+class TickScheduler {
+public:
+    using Clock = std::chrono::steady_clock;
+    using Context = std::shared_ptr<void>;
+
+    /**
+     * @brief A session whose deadline has passed
+     */
+    struct Due {
+        uint32_t id;
+        Clock::time_point at;   // The deadline, not when it was noticed
+        uint64_t version;       // Matches complete() to this hand-out
+        Context context;        // As given to add()
+    };
+
+    TickScheduler() = default;
+
+    // Non-copyable
+    TickScheduler(const TickScheduler&) = delete;
+    TickScheduler& operator=(const TickScheduler&) = delete;
+
+    // ========================================================================
+    // SESSIONS
+    // ========================================================================
+
+    /**
+     * @brief Schedule a session; its first tick is due at `firstDue`
+     *
+     * `context` is kept until the session is removed and returned in each
+     * Due. Adding a session that is already scheduled only updates its
+     * interval.
+     */
+    void add(uint32_t id, Clock::duration interval, Clock::time_point firstDue,
+             Context context = nullptr);
+
+    /**
+     * @brief Change a session's rate; the next tick moves to last step + interval
+     */
+    void setInterval(uint32_t id, Clock::duration interval);
+
+    /**
+     * @brief Stop scheduling a session (also drops a step still in flight)
+     */
+    void remove(uint32_t id);
+
+    size_t size() const;
+
+    // ========================================================================
+    // TICK LOOP
+    // ========================================================================
+
+    /**
+     * @brief Sleep until a session is due, `until` passes, or wake()
+     *
+     * Appends the sessions due by then to `due`, earliest first. Sessions
+     * added or sped up meanwhile are taken into account.
+     */
+    void waitDue(Clock::time_point until, std::vector<Due>& due);
+
+    /**
+     * @brief Append the sessions due at `now` without waiting
+     */
+    void popDue(Clock::time_point now, std::vector<Due>& due);
+
+    /**
+     * @brief A due session was stepped at `started`: record it and reschedule
+     */
+    void complete(const Due& due, Clock::time_point started);
+
+    /**
+     * @brief Make waitDue() return now, even with nothing due (shutdown)
+     */
+    void wake();
+
+    /**
+     * @brief Earliest deadline (Clock::time_point::max() if none)
+     */
+    Clock::time_point nextDue();
+
+    // ========================================================================
+    // STATISTICS (window since the last resetWindow())
+    // ========================================================================
+
+    TickSchedulerStats window() const;
+    std::vector<SessionTiming> sessionTimings() const;
+    void resetWindow();
+
+private:
+    struct Session {
+        Clock::duration interval{};
+        Clock::time_point due{};
+        Clock::time_point lastStarted{};  // Epoch until the first step
+        uint64_t version = 0;             // Of the deadline in the heap / in flight
+        bool inFlight = false;
+        Context context;
+
+        // Window counters
+        uint64_t steps = 0;
+        double driftSumMs = 0.0;
+        double driftMaxMs = 0.0;
+        uint64_t jitterSamples = 0;
+        double jitterSumMs = 0.0;
+        double jitterMaxMs = 0.0;
+    };
+
+    struct HeapEntry {
+        Clock::time_point due;
+        uint32_t id;
+        uint64_t version;
+        bool operator>(const HeapEntry& other) const { return due > other.due; }
+    };
+
+    // Push the session's current deadline (m_mutex held)
+    void pushLocked(uint32_t id, Session& session);
+
+    // Drop heap entries that no longer match a waiting session (m_mutex held)
+    void pruneLocked();
+
+    void popDueLocked(Clock::time_point now, std::vector<Due>& due);
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_wake;
+    bool m_woken = false;
+
+    std::unordered_map<uint32_t, Session> m_sessions;
+    std::priority_queue<HeapEntry, std::vector<HeapEntry>, std::greater<HeapEntry>> m_heap;
+    uint64_t m_nextVersion = 0;
+    uint64_t m_skipped = 0;
+};
+
+} // namespace orderbook
+
+#endif // TICKSCHEDULER_H
@@ -0,0 +1,106 @@
+#ifndef TOPOFBOOK_H
+#define TOPOFBOOK_H
+
+// ============================================================================
+// TOPOFBOOK.H - Seqlock-published best prices and last trade
+// ============================================================================
+// The order generator asks for the best bid/ask before every order, and the
+// display threads poll the book too. Taking OrderBook's mutex for that puts
+// every poller in the matching thread's way.
+//
+// Instead the book publishes a small TopOfBook record through a seqlock
+// after every change. The (single, already mutex-serialized) writer bumps
+// a sequence counter to odd, stores the fields, then bumps it to even.
+// Readers copy the fields and retry if the counter was odd or moved while
+// they copied. Readers never take a lock and never make the writer wait.
+// ============================================================================
+
+#include "Common.h"
+#include <atomic>
+#include <cstdint>
+
+namespace orderbook {
+
+/**
+ * @brief Best bid/ask with their sizes, plus the most recent execution
+ *
+ * A size of 0 means that side of the book is empty (its price is then
+ * meaningless). lastTradeQuantity is 0 until the first trade.
+ */
+struct TopOfBook {
+    Price    bestBid;
+    Quantity bidSize = 0;
+    Price    bestAsk;
+    Quantity askSize = 0;
+    Price    lastTradePrice;
+    Quantity lastTradeQuantity = 0;
+    uint64_t sequence = 0;   // OrderBook change counter this view belongs to
+
+    bool hasBid() const { return bidSize > 0; }
+    bool hasAsk() const { return askSize > 0; }
+};
+
+/**
+ * @brief Single-writer, many-reader seqlock cell holding a TopOfBook
+ *
+ * publish() must not be called concurrently with itself (OrderBook calls
+ * it while holding its mutex). publish() never waits for readers; read()
+ * takes no lock and only retries while a publish is in progress.
+ *
+ * Every field is stored in its own relaxed atomic, so concurrent access is
+ * well defined; the sequence counter's acquire/release ordering plus the
+ * fences make a successful read a consistent copy of one publish.
+ */
+class alignas(64) TopOfBookSeqlock {
+public:
+    void publish(const TopOfBook& top) {
+        uint64_t seq = m_seq.load(std::memory_order_relaxed);
+        m_seq.store(seq + 1, std::memory_order_relaxed);       // Odd: writing
+        std::atomic_thread_fence(std::memory_order_release);
+
+        m_bestBid.store(top.bestBid.raw(), std::memory_order_relaxed);
+        m_bidSize.store(top.bidSize, std::memory_order_relaxed);
+        m_bestAsk.store(top.bestAsk.raw(), std::memory_order_relaxed);
+        m_askSize.store(top.askSize, std::memory_order_relaxed);
+        m_lastTradePrice.store(top.lastTradePrice.raw(), std::memory_order_relaxed);
+        m_lastTradeQuantity.store(top.lastTradeQuantity, std::memory_order_relaxed);
+        m_bookSequence.store(top.sequence, std::memory_order_relaxed);
+
+        m_seq.store(seq + 2, std::memory_order_release);       // Even: stable
+    }
+
+    TopOfBook read() const {
+        TopOfBook top;
+        uint64_t before;
+        uint64_t after;
+        do {
+            before = m_seq.load(std::memory_order_acquire);
+            top.bestBid = Price::fromRaw(m_bestBid.load(std::memory_order_relaxed));
+            top.bidSize = m_bidSize.load(std::memory_order_relaxed);
+            top.bestAsk = Price::fromRaw(m_bestAsk.load(std::memory_order_relaxed));
+            top.askSize = m_askSize.load(std::memory_order_relaxed);
+            top.lastTradePrice = Price::fromRaw(m_lastTradePrice.load(std::memory_order_relaxed));
+            top.lastTradeQuantity = m_lastTradeQuantity.load(std::memory_order_relaxed);
+            top.sequence = m_bookSequence.load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            after = m_seq.load(std::memory_order_relaxed);
+        } while ((before & 1) || before != after);
+        return top;
+    }
+
+private:
+    // The whole record fits one cache line (the class is line-aligned), so
+    // a reader pulls it in once and shares it with nothing else
+    std::atomic<uint64_t> m_seq{0};
+    std::atomic<int64_t>  m_bestBid{0};
+    std::atomic<Quantity> m_bidSize{0};
+    std::atomic<Quantity> m_askSize{0};
+    std::atomic<int64_t>  m_bestAsk{0};
+    std::atomic<int64_t>  m_lastTradePrice{0};
+    std::atomic<Quantity> m_lastTradeQuantity{0};
+    std::atomic<uint64_t> m_bookSequence{0};
+};
+
+} // namespace orderbook
+
+#endif // TOPOFBOOK_H
@@ -148,16 +148,19 @@ private:
     mutable std::vector<TradeRecord> m_recentTrades;
     static constexpr size_t MAX_TRADE_HISTORY = 50;
     
-    // Price history for chart
-    mutable std::vector<Price> m_priceHistory;
+    // Price history for chart (plain doubles - only used for drawing)
+    mutable std::vector<double> m_priceHistory;
     static constexpr size_t MAX_PRICE_HISTORY = 60;  // 60 data points for chart
     
     // Price tracking for change display
-    mutable Price m_lastPrice = 0.0;
-    mutable Price m_sessionOpenPrice = 0.0;
-    mutable Price m_sessionHighPrice = 0.0;
-    mutable Price m_sessionLowPrice = 999999.0;
-    mutable Price m_previousPrice = 0.0;  // For tick direction
+    mutable double m_lastPrice = 0.0;
+    mutable double m_sessionOpenPrice = 0.0;
+    mutable double m_sessionHighPrice = 0.0;
+    mutable double m_sessionLowPrice = 999999.0;
+    mutable double m_previousPrice = 0.0;  // For tick direction
+    
+    // Book view for the frame being drawn (taken with one lock per frame)
+    mutable BookSnapshot m_snapshot;
     
     // Display settings
     int m_priceWidth = 10;
@@ -172,7 +175,12 @@ private:
     std::string formatQuantity(Quantity qty) const;
     std::string colorize(const std::string& text, const std::string& color) const;
     void printLine(char c = '=', int width = 60) const;
-    void updatePriceTracking(Price price) const;
+    void updatePriceTracking(double price) const;
+    
+    // Draw from m_snapshot (the public print* methods refresh it first)
+    void drawOrderBook(size_t levels) const;
+    void drawFooter() const;
+    void drawPriceTicker() const;
 };
 
 } // namespace orderbook
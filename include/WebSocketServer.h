@@ -20,7 +20,10 @@
 #include <iomanip>
 #include <memory>
 #include <chrono>
-#include "CandleManager.h"
+#include "ClientRegistry.h"
+#include "JsonBuilder.h"
+#include "OutboundFrame.h"
+#include "OutboundQueue.h"
 #include "SessionState.h"
 
 namespace orderbook {
@@ -28,56 +31,6 @@ namespace orderbook {
 // Forward declarations
 class OrderBook;
 
-// ============================================================================
-// JSON Builder Helper
-// ============================================================================
-
-class JsonBuilder {
-public:
-    static std::string orderBookToJson(const OrderBook& book);
-    static std::string tradeToJson(double price, int quantity, const std::string& side);
-    static std::string statsToJson(
-        const std::string& symbol,
-        double currentPrice,
-        double openPrice,
-        double highPrice,
-        double lowPrice,
-        size_t totalOrders,
-        size_t totalTrades,
-        size_t totalVolume,
-        int marketOrderPct,
-        const std::string& sentiment,
-        const std::string& intensity,
-        double spread,
-        double speed,
-        bool paused,
-        bool newsShockEnabled = false,
-        bool newsShockCooldown = false,
-        int newsShockCooldownRemaining = 0,
-        int newsShockActiveRemaining = 0
-    );
-    static std::string priceToJson(double price, int volume);
-    
-    // New batched tick message format (matching Node.js)
-    static std::string tickToJson(
-        const OrderBook& book,
-        const std::string& statsJson,
-        double price,
-        int volume,
-        int64_t timestamp,
-        const TradeData* trade,  // nullptr if no trade this tick
-        const std::map<int, orderbook::Candle>& currentCandles,
-        const std::vector<orderbook::CompletedCandle>& completedCandles
-    );
-    
-    // Candle history response
-    static std::string candleHistoryToJson(
-        int timeframe,
-        const std::vector<orderbook::Candle>& candles,
-        const orderbook::Candle* current
-    );
-};
-
 // ============================================================================
 // WebSocket Server
 // ============================================================================
@@ -90,6 +43,9 @@ struct ConnectionMetrics {
     std::atomic<size_t> totalBytesReceived{0};
     std::atomic<size_t> totalMessagesIn{0};
     std::atomic<size_t> totalMessagesOut{0};
+    std::atomic<size_t> totalConflated{0};       // Ticks replaced before sending
+    std::atomic<size_t> totalDropped{0};         // Frames refused by full queues
+    std::atomic<size_t> slowConsumerDisconnects{0};
     int64_t serverStartTime{0};
 };
 
@@ -98,7 +54,39 @@ public:
     // Callback now includes client ID for session-specific handling
     using CommandCallback = std::function<void(uint32_t clientId, const std::string& type, const std::string& value)>;
 
-    WebSocketServer(int port = 8080);
+    // Per-client data structure with session state and metrics. Callers
+    // only use id and session; the rest belongs to the server
+    struct ClientData {
+        // Set at connect, then never changed
+        uint32_t id = 0;
+        int tsi = 0;                 // Service thread owning the connection
+        std::unique_ptr<SessionState> session;
+        std::string ipAddress;
+        int64_t connectedAt = 0;
+        
+        // Guards everything below
+        mutable std::mutex mutex;
+        struct lws* wsi = nullptr;   // nullptr once the connection closed
+        OutboundQueue messageQueue;  // Frames may be shared with other clients
+        bool writePending = false;   // Listed in m_pendingWrites[tsi]
+        bool slowConsumer = false;   // Over the lag limit: nothing more is queued
+        bool closeRequested = false; // Disconnect issued by the service thread
+        bool closeAfterDrain = false; // Session expired: close once the queue is sent
+        
+        // Per-session metrics
+        size_t bytesSent = 0;
+        size_t bytesReceived = 0;
+        size_t messagesSent = 0;
+        size_t messagesReceived = 0;
+    };
+    
+    // Stable handle: stays valid after the client disconnects
+    using ClientHandle = std::shared_ptr<ClientData>;
+    using ClientSnapshot = ClientRegistry<ClientData>::Snapshot;
+
+    // serviceThreads > 1 partitions connections across that many lws
+    // service threads (needs libwebsockets built with LWS_MAX_SMP > 1)
+    WebSocketServer(int port = 8080, int serviceThreads = 1);
     ~WebSocketServer();
 
     // Start/stop server
@@ -106,8 +94,9 @@ public:
     void stop();
     bool isRunning() const { return m_running; }
 
-    // Broadcast messages to all connected clients
+    // Broadcast messages to all connected clients (one shared frame)
     void broadcast(const std::string& message);
+    void broadcastFrame(const FrameRef& frame, FrameDelivery delivery = FrameDelivery::ALWAYS);
     void broadcastOrderBook(const std::string& json);
     void broadcastTrade(const std::string& json);
     void broadcastStats(const std::string& json);
@@ -115,6 +104,20 @@ public:
     
     // Send to specific client
     void sendToClient(uint32_t clientId, const std::string& message);
+    void sendBinaryToClient(uint32_t clientId, const std::string& bytes);  // Binary frame
+    void sendFrame(uint32_t clientId, FrameRef frame,   // Built in place, no copy
+                   FrameDelivery delivery = FrameDelivery::ALWAYS);
+    void sendFrame(const ClientHandle& client, FrameRef frame,  // No id lookup
+                   FrameDelivery delivery = FrameDelivery::ALWAYS);
+    
+    // Outbound queue limits for clients that connect from now on
+    void setOutboundQueueConfig(const OutboundQueueConfig& config);
+    
+    // Sessions created from now on seed their RNG with deriveSeed(base, id)
+    void setSessionSeed(uint64_t base);
+    
+    // Per-client queue depth, lag and drop counters
+    OutboundQueueStats getOutboundStats(uint32_t clientId) const;
 
     // Set callback for received commands
     void setCommandCallback(CommandCallback callback) { m_commandCallback = callback; }
@@ -137,6 +140,16 @@ public:
     // Get list of connected client IDs
     std::vector<uint32_t> getClientIds() const;
     
+    // Every connected client, without taking a lock (see ClientRegistry).
+    // Iterate it once per tick instead of looking clients up by id
+    ClientSnapshot getClients() const { return m_clients.snapshot(); }
+    
+    // One client by ID (empty handle if it disconnected)
+    ClientHandle findClient(uint32_t clientId) const { return m_clients.find(clientId); }
+    
+    // False once the handle's connection has closed (takes only its mutex)
+    static bool isConnected(const ClientHandle& client);
+    
     // Session management - each client has its own session
     SessionState* getSession(uint32_t clientId);
     const SessionState* getSession(uint32_t clientId) const;
@@ -147,41 +160,44 @@ public:
                        void* user, void* in, size_t len);
 
 private:
-    // Server thread function
-    void serverThread();
+    // Service loop for one lws thread; thread 0 also runs housekeeping
+    void serviceThread(int tsi);
+    
+    // Request writes and disconnects queued for this thread's connections
+    void servicePending(int tsi);
 
     // Process incoming message (with client ID)
     void processMessage(uint32_t clientId, const std::string& message);
 
     int m_port;
+    int m_requestedThreads;
     std::atomic<bool> m_running{false};
     std::atomic<bool> m_hasData{false};
     std::atomic<size_t> m_connectionCount{0};
-    std::thread m_serverThread;
+    std::vector<std::thread> m_serviceThreads;  // Index is the lws tsi
     
     struct lws_context* m_context = nullptr;
     
-    // Per-client data structure with session state and metrics
-    struct ClientData {
-        struct lws* wsi;
-        std::queue<std::string> messageQueue;
-        std::unique_ptr<SessionState> session;
-        
-        // Connection info
-        std::string ipAddress;
-        std::string userAgent;
-        int64_t connectedAt;
-        
-        // Per-session metrics
-        size_t bytesSent = 0;
-        size_t bytesReceived = 0;
-        size_t messagesSent = 0;
-        size_t messagesReceived = 0;
+    // Queue a frame for one client (text or binary)
+    void enqueue(const ClientHandle& client, FrameRef frame, FrameDelivery delivery);
+    
+    // Connected clients: sharded by ID, plus a snapshot for iteration
+    ClientRegistry<ClientData> m_clients;
+    
+    OutboundQueueConfig m_queueConfig;  // For new clients
+    uint64_t m_sessionSeed = 0;         // For new clients (0 = random per session)
+    mutable std::mutex m_configMutex;
+    
+    // Clients with new frames, per service thread.
+    // lws_callback_on_writable() must run on the connection's own thread
+    struct PendingWrites {
+        std::mutex mutex;
+        std::vector<ClientHandle> clients;
     };
+    std::vector<std::unique_ptr<PendingWrites>> m_pendingWrites;  // Sized by start()
     
-    // Connected clients mapped by ID
-    std::map<uint32_t, ClientData> m_clients;
-    mutable std::mutex m_clientsMutex;
+    // Queue one frame for a client (client.mutex held); true if it wants a write
+    bool pushLocked(const ClientHandle& client, const FrameRef& frame, FrameDelivery delivery);
 
     CommandCallback m_commandCallback;
     
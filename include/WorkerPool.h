@@ -0,0 +1,104 @@
+#ifndef WORKERPOOL_H
+#define WORKERPOOL_H
+
+// ============================================================================
+// WORKERPOOL.H - Fixed thread pool with work-stealing batches
+// ============================================================================
+// Runs a batch of independent tasks (one per session each tick) across a
+// fixed set of threads and returns when all of them are done. Each worker
+// has its own deque: it takes tasks from the front of its own deque and,
+// once that is empty, steals from the back of another worker's. A few
+// expensive tasks therefore do not leave the other workers idle.
+//
+// Every index of a batch runs exactly once, on one thread, and batches never
+// overlap - a session stepped by task i is owned by that worker until the
+// batch returns. The calling thread works as worker 0, so a pool of size 1
+// has no extra threads and simply runs the batch inline.
+// ============================================================================
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace orderbook {
+
+/**
+ * @brief Counters since construction (snapshot)
+ */
+struct WorkerPoolStats {
+    uint64_t batches = 0;
+    uint64_t tasks = 0;
+    uint64_t steals = 0;      // Tasks run by a worker other than the one seeded
+};
+
+/**
+ * @brief Fixed-size pool that runs index batches with work stealing
+ *
+ * Example:
+ *   WorkerPool pool;  // One worker per core
+ *   pool.run(sessions.size(), [&](size_t i) { step(sessions[i]); });
+ */
+class WorkerPool {
+public:
+    using Task = std::function<void(size_t index)>;
+
+    /**
+     * @brief Create the pool
+     * @param workers Worker count including the caller (0 = one per core)
+     */
+    explicit WorkerPool(size_t workers = 0);
+    ~WorkerPool();
+
+    // Non-copyable
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    /**
+     * @brief Run task(0) .. task(count - 1) and wait for all of them
+     *
+     * The task must not throw. One batch runs at a time; concurrent callers
+     * wait their turn.
+     */
+    void run(size_t count, const Task& task);
+
+    size_t size() const { return m_workers.size(); }
+    WorkerPoolStats getStats() const;
+
+private:
+    struct alignas(64) WorkerQueue {
+        std::mutex mutex;
+        std::deque<size_t> tasks;
+    };
+
+    void workerLoop(size_t self);
+    void drain(size_t self);
+    bool takeTask(size_t self, size_t& index, bool& stolen);
+
+    std::vector<std::unique_ptr<WorkerQueue>> m_workers;   // [0] is the caller
+    std::vector<std::thread> m_threads;                    // Workers 1..n-1
+
+    std::mutex m_runMutex;               // One batch at a time
+    std::mutex m_mutex;                  // Guards m_generation / m_stop
+    std::condition_variable m_wake;      // New batch or stop
+    std::condition_variable m_done;      // Batch finished
+    uint64_t m_generation = 0;
+    bool m_stop = false;
+
+    const Task* m_task = nullptr;        // Current batch (set before seeding)
+    std::atomic<size_t> m_remaining{0};  // Tasks of the batch not yet finished
+
+    std::atomic<uint64_t> m_batches{0};
+    std::atomic<uint64_t> m_tasks{0};
+    std::atomic<uint64_t> m_steals{0};
+};
+
+} // namespace orderbook
+
+#endif // WORKERPOOL_H
@@ -0,0 +1,224 @@
+// ============================================================================
+// BINARYENCODER.CPP - Compact binary message encoding
+// ============================================================================
+
+#include "BinaryEncoder.h"
+#include "JsonBuilder.h"
+#include <algorithm>
+#include <cmath>
+
+namespace orderbook {
+
+namespace {
+
+// Appends little-endian fields to a byte string, independent of host order
+class Writer {
+public:
+    explicit Writer(std::string& out) : m_out(out) {}
+
+    void u8(uint8_t value)   { m_out.push_back(static_cast<char>(value)); }
+    void u16(uint16_t value) { put(value, 2); }
+    void u32(uint32_t value) { put(value, 4); }
+    void u64(uint64_t value) { put(value, 8); }
+    void i32(int32_t value)  { put(static_cast<uint32_t>(value), 4); }
+    void i64(int64_t value)  { put(static_cast<uint64_t>(value), 8); }
+
+    // Prices travel as whole cents (what the JSON shows with 2 decimals)
+    void price(Price p) {
+        i32(static_cast<int32_t>(p.roundToTick(Price::fromRaw(Price::SCALE / 100)).raw() /
+                                 (Price::SCALE / 100)));
+    }
+
+    void str(const std::string& s) {
+        size_t length = std::min<size_t>(s.size(), 255);
+        u8(static_cast<uint8_t>(length));
+        m_out.append(s, 0, length);
+    }
+
+    void header(BinaryEncoder::MessageType type) {
+        u8(BinaryEncoder::VERSION);
+        u8(static_cast<uint8_t>(type));
+    }
+
+    void candle(const Candle& c) {
+        i64(c.timestamp);
+        price(c.open);
+        price(c.high);
+        price(c.low);
+        price(c.close);
+        u32(static_cast<uint32_t>(c.volume));
+    }
+
+    void trade(const TradeData& t) {
+        i64(t.id);
+        price(t.price);
+        u32(static_cast<uint32_t>(t.quantity));
+        u8(t.side == "SELL" ? 1 : 0);
+        i64(t.timestamp);
+    }
+
+    template <typename Level>
+    void levels(const Level* first, size_t count) {
+        u16(static_cast<uint16_t>(count));
+        for (size_t i = 0; i < count; ++i) {
+            price(first[i].price);
+            u32(first[i].quantity);
+        }
+    }
+
+private:
+    void put(uint64_t value, int bytes) {
+        for (int i = 0; i < bytes; ++i) {
+            m_out.push_back(static_cast<char>((value >> (8 * i)) & 0xFF));
+        }
+    }
+
+    std::string& m_out;
+};
+
+// Changes for one side, pulled out of the (bids-then-asks) change set
+void writeChanges(Writer& w, const std::vector<LevelChange>& changes, Side side) {
+    size_t count = std::count_if(changes.begin(), changes.end(),
+                                 [side](const LevelChange& c) { return c.side == side; });
+    w.u16(static_cast<uint16_t>(count));
+    for (const LevelChange& change : changes) {
+        if (change.side != side) continue;
+        w.price(change.price);
+        w.u32(change.quantity);
+    }
+}
+
+} // namespace
+
+// ============================================================================
+// MESSAGES
+// ============================================================================
+
+std::string BinaryEncoder::tick(
+    const OrderBook& book,
+    const SessionStats& stats,
+    Price price,
+    int volume,
+    int64_t timestamp,
+    const TradeData* trade,
+    const std::map<int, orderbook::Candle>& currentCandles,
+    const std::vector<orderbook::CompletedCandle>& completedCandles,
+    const BookFrame* bookFrame
+) {
+    std::string out;
+    out.reserve(512);
+    tick(out, book, stats, price, volume, timestamp, trade, currentCandles, completedCandles, bookFrame);
+    return out;
+}
+
+void BinaryEncoder::tick(
+    std::string& out,
+    const OrderBook& book,
+    const SessionStats& stats,
+    Price price,
+    int volume,
+    int64_t timestamp,
+    const TradeData* trade,
+    const std::map<int, orderbook::Candle>& currentCandles,
+    const std::vector<orderbook::CompletedCandle>& completedCandles,
+    const BookFrame* bookFrame
+) {
+    Writer w(out);
+    w.header(MessageType::TICK);
+
+    w.i64(timestamp);
+    w.price(price);
+    w.u32(static_cast<uint32_t>(volume));
+
+    // Order book (one lock for a consistent view)
+    BookSnapshot snap;
+    book.snapshot(JsonBuilder::BOOK_DEPTH, snap);
+    if (!bookFrame) {
+        w.u8(0);
+        w.levels(snap.bids.data(), snap.bidCount);
+        w.levels(snap.asks.data(), snap.askCount);
+        w.price(snap.bestBid.value_or(Price()));
+        w.price(snap.bestAsk.value_or(Price()));
+        w.price(snap.spread.value_or(Price()));
+    } else {
+        w.u8(bookFrame->snapshot ? 2 : 1);
+        w.u32(static_cast<uint32_t>(bookFrame->sequence));
+        w.u32(JsonBuilder::bookChecksum(snap));
+        if (bookFrame->snapshot) {
+            w.levels(snap.bids.data(), snap.bidCount);
+            w.levels(snap.asks.data(), snap.askCount);
+        } else {
+            writeChanges(w, *bookFrame->changes, Side::BUY);
+            writeChanges(w, *bookFrame->changes, Side::SELL);
+        }
+    }
+
+    // Stats
+    w.str(stats.symbol);
+    w.price(stats.currentPrice);
+    w.price(stats.openPrice);
+    w.price(stats.highPrice);
+    w.price(stats.lowPrice);
+    w.u64(stats.totalOrders);
+    w.u64(stats.totalTrades);
+    w.u64(stats.totalVolume);
+    w.u8(static_cast<uint8_t>(stats.marketOrderPct));
+    w.str(stats.sentiment);
+    w.str(stats.intensity);
+    w.price(Price(stats.spread));
+    w.u16(static_cast<uint16_t>(std::lround(stats.speed * 100)));
+    w.u8((stats.paused ? 1 : 0) | (stats.newsShockEnabled ? 2 : 0) | (stats.newsShockCooldown ? 4 : 0));
+    w.i32(stats.newsShockCooldownRemaining);
+    w.i32(stats.newsShockActiveRemaining);
+
+    // Candles
+    w.u8(static_cast<uint8_t>(currentCandles.size()));
+    for (const auto& [tf, candle] : currentCandles) {
+        w.u16(static_cast<uint16_t>(tf));
+        w.candle(candle);
+    }
+    w.u8(static_cast<uint8_t>(completedCandles.size()));
+    for (const auto& cc : completedCandles) {
+        w.u16(static_cast<uint16_t>(cc.timeframe));
+        w.candle(cc.candle);
+    }
+
+    // Trade (optional)
+    bool hasTrade = trade && trade->isValid();
+    w.u8(hasTrade ? 1 : 0);
+    if (hasTrade) {
+        w.trade(*trade);
+    }
+}
+
+std::string BinaryEncoder::trade(const TradeData& trade) {
+    std::string out;
+    Writer w(out);
+    w.header(MessageType::TRADE);
+    w.trade(trade);
+    return out;
+}
+
+std::string BinaryEncoder::candleHistory(
+    int timeframe,
+    const std::vector<orderbook::Candle>& candles,
+    const orderbook::Candle* current
+) {
+    std::string out;
+    out.reserve(8 + candles.size() * 32 + 33);
+    Writer w(out);
+    w.header(MessageType::CANDLE_HISTORY);
+
+    w.u16(static_cast<uint16_t>(timeframe));
+    w.u32(static_cast<uint32_t>(candles.size()));
+    for (const Candle& candle : candles) {
+        w.candle(candle);
+    }
+    w.u8(current ? 1 : 0);
+    if (current) {
+        w.candle(*current);
+    }
+    return out;
+}
+
+} // namespace orderbook
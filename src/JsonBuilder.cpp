@@ -0,0 +1,381 @@
+// ============================================================================
+// JSONBUILDER.CPP - Server -> client message encoding
+// ============================================================================
+
+#include "JsonBuilder.h"
+#include "JsonWriter.h"
+#include <algorithm>
+#include <chrono>
+#include <ctime>
+
+namespace orderbook {
+
+namespace {
+
+// Typical message sizes, so a fresh string grows at most once
+constexpr size_t TICK_RESERVE = 2048;
+constexpr size_t SMALL_RESERVE = 256;
+
+// "bids":[...],"asks":[...],"bestBid":..,"bestAsk":..,"spread":..
+void writeBookFields(JsonWriter& w, const BookSnapshot& snap) {
+    // Bids (highest first), then asks (lowest first)
+    auto writeSide = [&w](const char* name, const auto& levels, size_t count) {
+        w.key(name).beginArray();
+        for (size_t i = 0; i < count; ++i) {
+            w.beginObject();
+            w.key("price").value(levels[i].price);
+            w.key("quantity").value(levels[i].quantity);
+            w.endObject();
+        }
+        w.endArray();
+    };
+    writeSide("bids", snap.bids, snap.bidCount);
+    writeSide("asks", snap.asks, snap.askCount);
+    
+    // Best prices and spread (0 when a side is empty)
+    w.key("bestBid").value(snap.bestBid.value_or(Price()));
+    w.key("bestAsk").value(snap.bestAsk.value_or(Price()));
+    w.key("spread").value(snap.spread.value_or(Price()));
+}
+
+// [price,quantity] pairs (quantity 0 = level removed)
+void writeLevelPair(JsonWriter& w, Price price, Quantity quantity) {
+    w.beginArray().value(price).value(quantity).endArray();
+}
+
+// "book":{"seq":..,["snapshot":true,]"bids":[[p,q],..],"asks":[..],"checksum":..}
+void writeBookFrame(JsonWriter& w, const BookSnapshot& snap, const BookFrame& frame) {
+    w.key("book").beginObject();
+    w.key("seq").value(frame.sequence);
+    
+    if (frame.snapshot) {
+        // Replace everything the client holds with the top levels
+        w.key("snapshot").value(true);
+        w.key("bids").beginArray();
+        for (size_t i = 0; i < snap.bidCount; ++i) {
+            writeLevelPair(w, snap.bids[i].price, snap.bids[i].quantity);
+        }
+        w.endArray();
+        w.key("asks").beginArray();
+        for (size_t i = 0; i < snap.askCount; ++i) {
+            writeLevelPair(w, snap.asks[i].price, snap.asks[i].quantity);
+        }
+        w.endArray();
+    } else {
+        // Only the levels that changed since the previous frame
+        auto writeSide = [&](const char* name, Side side) {
+            w.key(name).beginArray();
+            for (const LevelChange& change : *frame.changes) {
+                if (change.side == side) writeLevelPair(w, change.price, change.quantity);
+            }
+            w.endArray();
+        };
+        writeSide("bids", Side::BUY);
+        writeSide("asks", Side::SELL);
+    }
+    
+    w.key("checksum").value(JsonBuilder::bookChecksum(snap));
+    w.endObject();
+}
+
+// The stats object itself (no message wrapper)
+void writeStatsFields(JsonWriter& w, const SessionStats& stats) {
+    w.beginObject();
+    w.key("symbol").value(stats.symbol);
+    w.key("currentPrice").value(stats.currentPrice);
+    w.key("openPrice").value(stats.openPrice);
+    w.key("highPrice").value(stats.highPrice);
+    w.key("lowPrice").value(stats.lowPrice);
+    w.key("totalOrders").value(stats.totalOrders);
+    w.key("totalTrades").value(stats.totalTrades);
+    w.key("totalVolume").value(stats.totalVolume);
+    w.key("marketOrderPct").value(stats.marketOrderPct);
+    w.key("sentiment").value(stats.sentiment);
+    w.key("intensity").value(stats.intensity);
+    w.key("spread").value(stats.spread);
+    w.key("speed").value(stats.speed);
+    w.key("paused").value(stats.paused);
+    w.key("newsShockEnabled").value(stats.newsShockEnabled);
+    w.key("newsShockCooldown").value(stats.newsShockCooldown);
+    w.key("newsShockCooldownRemaining").value(stats.newsShockCooldownRemaining);
+    w.key("newsShockActiveRemaining").value(stats.newsShockActiveRemaining);
+    w.endObject();
+}
+
+void writeCandle(JsonWriter& w, const Candle& candle) {
+    w.beginObject();
+    w.key("timestamp").value(candle.timestamp);
+    w.key("open").value(candle.open);
+    w.key("high").value(candle.high);
+    w.key("low").value(candle.low);
+    w.key("close").value(candle.close);
+    w.key("volume").value(candle.volume);
+    w.endObject();
+}
+
+// Opens {"type":"<type>","data":{ - the caller closes both objects
+void beginMessage(JsonWriter& w, const char* type) {
+    w.beginObject();
+    w.key("type").value(type);
+    w.key("data").beginObject();
+}
+
+void endMessage(JsonWriter& w) {
+    w.endObject().endObject();
+}
+
+} // namespace
+
+uint32_t JsonBuilder::bookChecksum(const BookSnapshot& snap) {
+    // FNV-1a over 32-bit words (cheap to mirror in JavaScript with Math.imul)
+    uint32_t hash = 2166136261u;
+    auto mix = [&hash](uint32_t word) {
+        hash ^= word;
+        hash *= 16777619u;
+    };
+    auto mixSide = [&](const auto& levels, size_t count) {
+        count = std::min(count, BOOK_DEPTH);
+        mix(static_cast<uint32_t>(count));
+        for (size_t i = 0; i < count; ++i) {
+            mix(static_cast<uint32_t>(levels[i].price.raw() / (Price::SCALE / 100)));  // Cents
+            mix(levels[i].quantity);
+        }
+    };
+    mixSide(snap.bids, snap.bidCount);
+    mixSide(snap.asks, snap.askCount);
+    return hash;
+}
+
+std::string JsonBuilder::orderBookToJson(const OrderBook& book) {
+    // One lock: both sides and the best prices describe the same book
+    BookSnapshot snap;
+    book.snapshot(BOOK_DEPTH, snap);
+    
+    std::string out;
+    out.reserve(TICK_RESERVE);
+    JsonWriter w(out);
+    beginMessage(w, "orderbook");
+    writeBookFields(w, snap);
+    endMessage(w);
+    return out;
+}
+
+std::string JsonBuilder::tradeToJson(Price price, int quantity, const std::string& side) {
+    static int tradeId = 0;
+    std::string out;
+    out.reserve(SMALL_RESERVE);
+    JsonWriter w(out);
+    
+    beginMessage(w, "trade");
+    w.key("id").value(++tradeId);
+    w.key("price").value(price);
+    w.key("quantity").value(quantity);
+    w.key("side").value(side);
+    w.key("timestamp").value(static_cast<int64_t>(std::time(nullptr)) * 1000);  // milliseconds
+    endMessage(w);
+    return out;
+}
+
+std::string JsonBuilder::statsToJson(
+    const std::string& symbol,
+    Price currentPrice,
+    Price openPrice,
+    Price highPrice,
+    Price lowPrice,
+    size_t totalOrders,
+    size_t totalTrades,
+    size_t totalVolume,
+    int marketOrderPct,
+    const std::string& sentiment,
+    const std::string& intensity,
+    double spread,
+    double speed,
+    bool paused,
+    bool newsShockEnabled,
+    bool newsShockCooldown,
+    int newsShockCooldownRemaining,
+    int newsShockActiveRemaining
+) {
+    SessionStats stats;
+    stats.symbol = symbol;
+    stats.currentPrice = currentPrice;
+    stats.openPrice = openPrice;
+    stats.highPrice = highPrice;
+    stats.lowPrice = lowPrice;
+    stats.totalOrders = totalOrders;
+    stats.totalTrades = totalTrades;
+    stats.totalVolume = totalVolume;
+    stats.marketOrderPct = marketOrderPct;
+    stats.sentiment = sentiment;
+    stats.intensity = intensity;
+    stats.spread = spread;
+    stats.speed = speed;
+    stats.paused = paused;
+    stats.newsShockEnabled = newsShockEnabled;
+    stats.newsShockCooldown = newsShockCooldown;
+    stats.newsShockCooldownRemaining = newsShockCooldownRemaining;
+    stats.newsShockActiveRemaining = newsShockActiveRemaining;
+    return statsToJson(stats);
+}
+
+std::string JsonBuilder::statsToJson(const SessionStats& stats) {
+    std::string out;
+    out.reserve(SMALL_RESERVE * 2);
+    JsonWriter w(out);
+    w.beginObject();
+    w.key("type").value("stats");
+    w.key("data");
+    writeStatsFields(w, stats);
+    w.endObject();
+    return out;
+}
+
+std::string JsonBuilder::priceToJson(Price price, int volume) {
+    auto now = std::chrono::system_clock::now();
+    auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()).count();
+    
+    std::string out;
+    out.reserve(SMALL_RESERVE);
+    JsonWriter w(out);
+    beginMessage(w, "price");
+    w.key("timestamp").value(static_cast<int64_t>(ms));
+    w.key("price").value(price);
+    w.key("volume").value(volume);
+    endMessage(w);
+    return out;
+}
+
+std::string JsonBuilder::tickToJson(
+    const OrderBook& book,
+    const SessionStats& stats,
+    Price price,
+    int volume,
+    int64_t timestamp,
+    const TradeData* trade,
+    const std::map<int, orderbook::Candle>& currentCandles,
+    const std::vector<orderbook::CompletedCandle>& completedCandles,
+    const BookFrame* bookFrame
+) {
+    std::string out;
+    out.reserve(TICK_RESERVE);
+    tickToJson(out, book, stats, price, volume, timestamp, trade,
+               currentCandles, completedCandles, bookFrame);
+    return out;
+}
+
+void JsonBuilder::tickToJson(
+    std::string& out,
+    const OrderBook& book,
+    const SessionStats& stats,
+    Price price,
+    int volume,
+    int64_t timestamp,
+    const TradeData* trade,
+    const std::map<int, orderbook::Candle>& currentCandles,
+    const std::vector<orderbook::CompletedCandle>& completedCandles,
+    const BookFrame* bookFrame
+) {
+    JsonWriter w(out);
+    
+    // Order book (one lock for a consistent view)
+    BookSnapshot snap;
+    book.snapshot(BOOK_DEPTH, snap);
+    
+    beginMessage(w, "tick");
+    
+    // Order book: the top levels, or a delta frame for clients that asked
+    if (bookFrame) {
+        writeBookFrame(w, snap, *bookFrame);
+    } else {
+        w.key("orderbook").beginObject();
+        writeBookFields(w, snap);
+        w.endObject();
+    }
+    
+    // Stats, written in place
+    w.key("stats");
+    writeStatsFields(w, stats);
+    
+    // Price point
+    w.key("price").beginObject();
+    w.key("timestamp").value(timestamp);
+    w.key("price").value(price);
+    w.key("volume").value(volume);
+    w.endObject();
+    
+    // Current candles (for all timeframes), keyed by timeframe
+    w.key("currentCandles").beginObject();
+    for (const auto& [tf, candle] : currentCandles) {
+        char name[16];
+        auto result = std::to_chars(name, name + sizeof(name), tf);
+        w.key(std::string_view(name, result.ptr - name));
+        writeCandle(w, candle);
+    }
+    w.endObject();
+    
+    // Completed candles (if any)
+    w.key("completedCandles");
+    if (!completedCandles.empty()) {
+        w.beginArray();
+        for (const auto& cc : completedCandles) {
+            w.beginObject();
+            w.key("timeframe").value(cc.timeframe);
+            w.key("candle");
+            writeCandle(w, cc.candle);
+            w.endObject();
+        }
+        w.endArray();
+    } else {
+        w.null();
+    }
+    
+    // Trade (optional)
+    w.key("trade");
+    if (trade && trade->isValid()) {
+        w.beginObject();
+        w.key("id").value(trade->id);
+        w.key("price").value(trade->price);
+        w.key("quantity").value(trade->quantity);
+        w.key("side").value(trade->side);
+        w.key("timestamp").value(trade->timestamp);
+        w.endObject();
+    } else {
+        w.null();
+    }
+    
+    endMessage(w);
+}
+
+// Candle history response (for getCandles command)
+std::string JsonBuilder::candleHistoryToJson(
+    int timeframe,
+    const std::vector<orderbook::Candle>& candles,
+    const orderbook::Candle* current
+) {
+    std::string out;
+    out.reserve(64 + candles.size() * 96);
+    JsonWriter w(out);
+    
+    beginMessage(w, "candleHistory");
+    w.key("timeframe").value(timeframe);
+    
+    // Cached candles
+    w.key("candles").beginArray();
+    for (const Candle& candle : candles) {
+        writeCandle(w, candle);
+    }
+    w.endArray();
+    
+    // Current candle
+    w.key("current");
+    if (current) {
+        writeCandle(w, *current);
+    } else {
+        w.null();
+    }
+    
+    endMessage(w);
+    return out;
+}
+
+} // namespace orderbook
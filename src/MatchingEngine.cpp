@@ -36,20 +36,29 @@ MatchingEngine::MatchingEngine(OrderBook& orderBook)
 
 std::vector<Trade> MatchingEngine::processOrder(Order& order) {
     std::vector<Trade> trades;
+    processOrder(order, trades);
+    return trades;
+}
+
+size_t MatchingEngine::processOrder(Order& order, std::vector<Trade>& trades) {
+    matchInto(order, trades);
     
-    // Try to match the order
-    if (order.getSide() == Side::BUY) {
-        trades = matchBuyOrder(order);
-    } else {
-        trades = matchSellOrder(order);
+    // Notify callbacks once the book lock has been released
+    for (const Trade& trade : trades) {
+        notifyTrade(trade);
     }
     
-    // If there's remaining quantity and it's a LIMIT order, add to book
-    if (order.getRemainingQty() > 0 && order.getType() == OrderType::LIMIT) {
-        m_orderBook.addOrder(order);
+    return trades.size();
+}
+
+size_t MatchingEngine::processBatch(std::vector<Order>& orders, std::vector<Trade>& trades) {
+    matchBatchInto(orders, trades);
+    
+    for (const Trade& trade : trades) {
+        notifyTrade(trade);
     }
     
-    return trades;
+    return trades.size();
 }
 
 bool MatchingEngine::cancelOrder(OrderId orderId) {
@@ -68,111 +77,55 @@ void MatchingEngine::onTrade(TradeCallback callback) {
 // INTERNAL MATCHING LOGIC
 // ============================================================================
 
-std::vector<Trade> MatchingEngine::matchBuyOrder(Order& order) {
-    std::vector<Trade> trades;
+void MatchingEngine::matchInto(Order& order, std::vector<Trade>& trades) {
+    trades.clear();
     
-    // Get the best asks (lowest prices) - these will be matched against
-    auto asks = m_orderBook.getTopAsks(100);  // Get up to 100 levels
+    // Match in place and rest any LIMIT remainder (one book lock)
+    m_fills.clear();
+    m_orderBook.matchOrder(order, m_fills);
+    if (m_fills.empty()) return;
     
-    for (const auto& [askPrice, askQty] : asks) {
-        // Stop if order is filled
-        if (order.getRemainingQty() == 0) break;
-        
-        // For LIMIT orders, stop if ask price is higher than our bid
-        if (order.getType() == OrderType::LIMIT && askPrice > order.getPrice()) {
-            break;
-        }
-        
-        // Match at this price level
-        Quantity matchQty = std::min(order.getRemainingQty(), askQty);
-        
-        // CRITICAL: Actually remove the quantity from the order book!
-        Quantity actualFilled = m_orderBook.fillQuantityAtPrice(Side::SELL, askPrice, matchQty);
-        if (actualFilled == 0) continue;
-        
-        // Fill the incoming order
-        order.fill(actualFilled);
-        
-        // Create trade record
-        Trade trade;
-        trade.buyOrderId = order.getId();
-        trade.sellOrderId = 0;  // Synthetic - matched against book
-        trade.price = askPrice;
-        trade.quantity = actualFilled;
-        trade.timestamp = now();
-        trades.push_back(trade);
-        
-        // Update statistics
-        m_tradeCount++;
-        m_totalVolume += actualFilled;
-        
-        // Notify callbacks
-        notifyTrade(trade);
-    }
-    
-    return trades;
+    // Every fill of one incoming order is the same match event
+    appendTrades(order, 0, m_fills.size(), now(), trades);
 }
 
-std::vector<Trade> MatchingEngine::matchSellOrder(Order& order) {
-    std::vector<Trade> trades;
+void MatchingEngine::matchBatchInto(std::vector<Order>& orders, std::vector<Trade>& trades) {
+    trades.clear();
+    m_fills.clear();
+    m_fillEnds.clear();
     
-    // Get the best bids (highest prices) - these will be matched against
-    auto bids = m_orderBook.getTopBids(100);  // Get up to 100 levels
+    // One book lock for the whole run
+    m_orderBook.matchOrders(orders.data(), orders.size(), m_fills, m_fillEnds);
+    if (m_fills.empty()) return;
     
-    for (const auto& [bidPrice, bidQty] : bids) {
-        // Stop if order is filled
-        if (order.getRemainingQty() == 0) break;
-        
-        // For LIMIT orders, stop if bid price is lower than our ask
-        if (order.getType() == OrderType::LIMIT && bidPrice < order.getPrice()) {
-            break;
-        }
-        
-        // Match at this price level
-        Quantity matchQty = std::min(order.getRemainingQty(), bidQty);
-        
-        // CRITICAL: Actually remove the quantity from the order book!
-        Quantity actualFilled = m_orderBook.fillQuantityAtPrice(Side::BUY, bidPrice, matchQty);
-        if (actualFilled == 0) continue;
-        
-        // Fill the incoming order
-        order.fill(actualFilled);
-        
-        // Create trade record
+    // The batch is matched in one go, so one timestamp covers it
+    Timestamp timestamp = now();
+    size_t first = 0;
+    for (size_t i = 0; i < orders.size(); ++i) {
+        appendTrades(orders[i], first, m_fillEnds[i], timestamp, trades);
+        first = m_fillEnds[i];
+    }
+}
+
+void MatchingEngine::appendTrades(const Order& order, size_t first, size_t last,
+                                  Timestamp timestamp, std::vector<Trade>& trades) {
+    bool isBuy = (order.getSide() == Side::BUY);
+    
+    // Turn each fill into a trade between the incoming and resting orders
+    for (size_t i = first; i < last; ++i) {
+        const Fill& fill = m_fills[i];
         Trade trade;
-        trade.buyOrderId = 0;  // Synthetic - matched against book
-        trade.sellOrderId = order.getId();
-        trade.price = bidPrice;
-        trade.quantity = actualFilled;
-        trade.timestamp = now();
+        trade.buyOrderId = isBuy ? order.getId() : fill.makerOrderId;
+        trade.sellOrderId = isBuy ? fill.makerOrderId : order.getId();
+        trade.price = fill.price;
+        trade.quantity = fill.quantity;
+        trade.timestamp = timestamp;
         trades.push_back(trade);
         
         // Update statistics
         m_tradeCount++;
-        m_totalVolume += actualFilled;
-        
-        // Notify callbacks
-        notifyTrade(trade);
+        m_totalVolume += fill.quantity;
     }
-    
-    return trades;
-}
-
-Trade MatchingEngine::executeTrade(Order& buyOrder, Order& sellOrder, 
-                                    Price price, Quantity qty) {
-    // Fill both orders
-    buyOrder.fill(qty);
-    sellOrder.fill(qty);
-    
-    // Create trade record
-    Trade trade;
-    trade.buyOrderId = buyOrder.getId();
-    trade.sellOrderId = sellOrder.getId();
-    trade.price = price;
-    trade.quantity = qty;
-    trade.timestamp = now();
-    
-    return trade;
 }
 
 void MatchingEngine::notifyTrade(const Trade& trade) {
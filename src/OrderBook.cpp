@@ -8,20 +8,18 @@
 namespace orderbook {
 
 // ============================================================================
-// PRICE LEVEL METHODS
+// CONSTRUCTOR
 // ============================================================================
 
-void PriceLevel::addOrder(Order* order) {
-    orders.push_back(order);
-    totalQuantity += order->getRemainingQty();
-}
-
-void PriceLevel::removeOrder(Order* order) {
-    auto it = std::find(orders.begin(), orders.end(), order);
-    if (it != orders.end()) {
-        totalQuantity -= (*it)->getRemainingQty();
-        orders.erase(it);
-    }
+OrderBook::OrderBook(const OrderBookConfig& config)
+    : m_config(config)
+    , m_bids(makePriceLevelIndex(Side::BUY, config.backend, config.tickSize, config.tickLevels,
+                                 config.tickLevels * config.maxTickLevelsFactor))
+    , m_asks(makePriceLevelIndex(Side::SELL, config.backend, config.tickSize, config.tickLevels,
+                                 config.tickLevels * config.maxTickLevelsFactor))
+    , m_pool(config.orderCapacity)
+    , m_orderMap(config.orderCapacity)
+{
 }
 
 // ============================================================================
@@ -29,15 +27,7 @@ void PriceLevel::removeOrder(Order* order) {
 // ============================================================================
 
 OrderBook::~OrderBook() {
-    std::lock_guard<std::mutex> lock(m_mutex);
-    
-    // Clean up all allocated orders
-    for (auto& [id, order] : m_orderMap) {
-        delete order;
-    }
-    m_orderMap.clear();
-    m_bids.clear();
-    m_asks.clear();
+    // Nodes live in m_pool's slabs and are freed with it
 }
 
 // ============================================================================
@@ -47,13 +37,25 @@ OrderBook::~OrderBook() {
 void OrderBook::clear() {
     std::lock_guard<std::mutex> lock(m_mutex);
     
-    // Clean up all allocated orders
-    for (auto& [id, order] : m_orderMap) {
-        delete order;
+    // Every level disappears (no-op unless change tracking is on)
+    if (m_config.trackLevelChanges) {
+        m_bids->forEachLevel([this](const PriceLevel& level) {
+            markDirty(Side::BUY, level.price, level.totalQuantity);
+            return true;
+        });
+        m_asks->forEachLevel([this](const PriceLevel& level) {
+            markDirty(Side::SELL, level.price, level.totalQuantity);
+            return true;
+        });
     }
+    
+    // Hand every node back to the pool in one pass
     m_orderMap.clear();
-    m_bids.clear();
-    m_asks.clear();
+    m_bids->clear();
+    m_asks->clear();
+    m_pool.reset();
+    m_sequence++;
+    publishTopOfBook();
 }
 
 // ============================================================================
@@ -62,21 +64,33 @@ void OrderBook::clear() {
 
 bool OrderBook::addOrder(const Order& order) {
     std::lock_guard<std::mutex> lock(m_mutex);
+    bool added = insertOrder(order);
+    publishTopOfBook();
+    return added;
+}
+
+bool OrderBook::insertOrder(const Order& order) {
+    // Caller must hold m_mutex
     
     // Check if order ID already exists
-    if (m_orderMap.find(order.getId()) != m_orderMap.end()) {
+    if (m_orderMap.find(order.getId())) {
         return false;  // Duplicate order ID
     }
     
-    // Create a copy of the order on the heap
-    Order* newOrder = new Order(order);
-    newOrder->getStatus();  // Trigger status update if needed
+    // Array-backed books only hold on-grid prices within their window
+    if (!levelsFor(order.getSide()).accepts(order.getPrice())) {
+        return false;
+    }
+    
+    // Copy the order into a pooled node
+    RestingOrder* node = m_pool.acquire(order);
     
     // Add to lookup map
-    m_orderMap[newOrder->getId()] = newOrder;
+    m_orderMap.insert(order.getId(), node);
     
     // Add to the appropriate book (bids or asks)
-    addToBook(newOrder);
+    addToBook(node);
+    m_sequence++;
     
     return true;
 }
@@ -84,22 +98,23 @@ bool OrderBook::addOrder(const Order& order) {
 bool OrderBook::cancelOrder(OrderId orderId) {
     std::lock_guard<std::mutex> lock(m_mutex);
     
-    auto it = m_orderMap.find(orderId);
-    if (it == m_orderMap.end()) {
+    RestingOrder* node = m_orderMap.find(orderId);
+    if (!node) {
         return false;  // Order not found
     }
     
-    Order* order = it->second;
-    
-    if (!order->isActive()) {
+    if (!node->order.isActive()) {
         return false;  // Already cancelled or filled
     }
     
-    // Remove from book
-    removeFromBook(order);
+    // Remove from book - O(1), the node knows its neighbours
+    removeFromBook(node);
     
-    // Mark as cancelled
-    order->cancel();
+    // Cancelled orders leave the book and their node is recycled
+    m_orderMap.erase(orderId);
+    m_pool.release(node);
+    m_sequence++;
+    publishTopOfBook();
     
     return true;
 }
@@ -107,29 +122,31 @@ bool OrderBook::cancelOrder(OrderId orderId) {
 bool OrderBook::modifyOrderPrice(OrderId orderId, Price newPrice) {
     std::lock_guard<std::mutex> lock(m_mutex);
     
-    auto it = m_orderMap.find(orderId);
-    if (it == m_orderMap.end()) {
+    RestingOrder* node = m_orderMap.find(orderId);
+    if (!node) {
         return false;
     }
     
-    Order* order = it->second;
+    Order* order = &node->order;
     
     if (!order->isActive()) {
         return false;
     }
     
     // Remove from current price level
-    removeFromBook(order);
+    removeFromBook(node);
     
-    // Modify price
-    if (!order->modifyPrice(newPrice)) {
+    // Modify price (the new price must fit the level storage too)
+    if (!levelsFor(order->getSide()).accepts(newPrice) || !order->modifyPrice(newPrice)) {
         // If modify failed, add back to original location
-        addToBook(order);
+        addToBook(node);
         return false;
     }
     
     // Add to new price level
-    addToBook(order);
+    addToBook(node);
+    m_sequence++;
+    publishTopOfBook();
     
     return true;
 }
@@ -137,12 +154,12 @@ bool OrderBook::modifyOrderPrice(OrderId orderId, Price newPrice) {
 bool OrderBook::modifyOrderQuantity(OrderId orderId, Quantity newQuantity) {
     std::lock_guard<std::mutex> lock(m_mutex);
     
-    auto it = m_orderMap.find(orderId);
-    if (it == m_orderMap.end()) {
+    RestingOrder* node = m_orderMap.find(orderId);
+    if (!node) {
         return false;
     }
     
-    Order* order = it->second;
+    Order* order = &node->order;
     
     if (!order->isActive()) {
         return false;
@@ -160,16 +177,13 @@ bool OrderBook::modifyOrderQuantity(OrderId orderId, Quantity newQuantity) {
     Quantity newRemaining = order->getRemainingQty();
     Quantity diff = newRemaining - oldRemaining;
     
-    Price price = order->getPrice();
-    if (order->getSide() == Side::BUY) {
-        if (m_bids.count(price)) {
-            m_bids[price].totalQuantity += diff;
-        }
-    } else {
-        if (m_asks.count(price)) {
-            m_asks[price].totalQuantity += diff;
-        }
+    PriceLevel* level = levelsFor(order->getSide()).find(order->getPrice());
+    if (level) {
+        markDirty(order->getSide(), level->price, level->totalQuantity);
+        level->totalQuantity += diff;
     }
+    m_sequence++;
+    publishTopOfBook();
     
     return true;
 }
@@ -177,41 +191,38 @@ bool OrderBook::modifyOrderQuantity(OrderId orderId, Quantity newQuantity) {
 Order* OrderBook::getOrder(OrderId orderId) {
     std::lock_guard<std::mutex> lock(m_mutex);
     
-    auto it = m_orderMap.find(orderId);
-    if (it != m_orderMap.end()) {
-        return it->second;
-    }
-    return nullptr;
+    RestingOrder* node = m_orderMap.find(orderId);
+    return node ? &node->order : nullptr;
 }
 
 // ============================================================================
 // MARKET DATA
 // ============================================================================
 
+// Best prices come from the published top of book: no lock taken
+
 std::optional<Price> OrderBook::getBestBid() const {
-    std::lock_guard<std::mutex> lock(m_mutex);
-    
-    if (m_bids.empty()) {
+    TopOfBook top = m_top.read();
+    if (!top.hasBid()) {
         return std::nullopt;
     }
-    return m_bids.begin()->first;  // Highest price (sorted descending)
+    return top.bestBid;  // Highest price
 }
 
 std::optional<Price> OrderBook::getBestAsk() const {
-    std::lock_guard<std::mutex> lock(m_mutex);
-    
-    if (m_asks.empty()) {
+    TopOfBook top = m_top.read();
+    if (!top.hasAsk()) {
         return std::nullopt;
     }
-    return m_asks.begin()->first;  // Lowest price (sorted ascending)
+    return top.bestAsk;  // Lowest price
 }
 
 std::optional<Price> OrderBook::getSpread() const {
-    auto bid = getBestBid();
-    auto ask = getBestAsk();
+    // One read, so both prices belong to the same book state
+    TopOfBook top = m_top.read();
     
-    if (bid && ask) {
-        return *ask - *bid;
+    if (top.hasBid() && top.hasAsk()) {
+        return top.bestAsk - top.bestBid;
     }
     return std::nullopt;
 }
@@ -219,81 +230,66 @@ std::optional<Price> OrderBook::getSpread() const {
 Quantity OrderBook::getQuantityAtPrice(Side side, Price price) const {
     std::lock_guard<std::mutex> lock(m_mutex);
     
-    if (side == Side::BUY) {
-        auto it = m_bids.find(price);
-        if (it != m_bids.end()) {
-            return it->second.totalQuantity;
-        }
-    } else {
-        auto it = m_asks.find(price);
-        if (it != m_asks.end()) {
-            return it->second.totalQuantity;
-        }
-    }
-    return 0;
+    const PriceLevel* level = levelsFor(side).find(price);
+    return level ? level->totalQuantity : 0;
 }
 
 Quantity OrderBook::fillQuantityAtPrice(Side side, Price price, Quantity quantity) {
     std::lock_guard<std::mutex> lock(m_mutex);
     
+    PriceLevelIndex& levels = levelsFor(side);
+    PriceLevel* level = levels.find(price);
+    if (!level) return 0;
+    
+    Quantity filled = fillLevel(levels, *level, quantity, nullptr);
+    publishTopOfBook();
+    return filled;
+}
+
+Quantity OrderBook::matchOrder(Order& order, std::vector<Fill>& fills) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    Quantity filled = matchLocked(order, fills);
+    publishTopOfBook();
+    return filled;
+}
+
+void OrderBook::matchOrders(Order* orders, size_t count, std::vector<Fill>& fills,
+                            std::vector<size_t>& fillEnds) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    
+    for (size_t i = 0; i < count; ++i) {
+        matchLocked(orders[i], fills);
+        fillEnds.push_back(fills.size());
+    }
+    publishTopOfBook();
+}
+
+Quantity OrderBook::matchLocked(Order& order, std::vector<Fill>& fills) {
+    // Caller must hold m_mutex
+    bool isBuy = (order.getSide() == Side::BUY);
+    bool isLimit = (order.getType() == OrderType::LIMIT);
+    PriceLevelIndex& opposite = isBuy ? *m_asks : *m_bids;
     Quantity filled = 0;
     
-    if (side == Side::BUY) {
-        auto it = m_bids.find(price);
-        if (it == m_bids.end()) return 0;
-        
-        PriceLevel& level = it->second;
-        
-        // Fill orders FIFO until quantity satisfied or level exhausted
-        while (!level.orders.empty() && filled < quantity) {
-            Order* order = level.orders.front();
-            Quantity orderRemaining = order->getRemainingQty();
-            Quantity toFill = std::min(orderRemaining, quantity - filled);
-            
-            order->fill(toFill);
-            level.totalQuantity -= toFill;
-            filled += toFill;
-            
-            // Remove fully filled orders
-            if (order->getRemainingQty() == 0) {
-                level.orders.pop_front();
-                m_orderMap.erase(order->getId());
-                delete order;
-            }
-        }
+    // Walk the opposite side from the best level while it still crosses
+    while (order.getRemainingQty() > 0) {
+        PriceLevel* level = opposite.best();
+        if (!level) break;
         
-        // Remove empty price level
-        if (level.totalQuantity == 0 || level.orders.empty()) {
-            m_bids.erase(it);
+        if (isLimit) {
+            bool crosses = isBuy ? level->price <= order.getPrice()
+                                 : level->price >= order.getPrice();
+            if (!crosses) break;
         }
-    } else {
-        auto it = m_asks.find(price);
-        if (it == m_asks.end()) return 0;
         
-        PriceLevel& level = it->second;
-        
-        // Fill orders FIFO until quantity satisfied or level exhausted
-        while (!level.orders.empty() && filled < quantity) {
-            Order* order = level.orders.front();
-            Quantity orderRemaining = order->getRemainingQty();
-            Quantity toFill = std::min(orderRemaining, quantity - filled);
-            
-            order->fill(toFill);
-            level.totalQuantity -= toFill;
-            filled += toFill;
-            
-            // Remove fully filled orders
-            if (order->getRemainingQty() == 0) {
-                level.orders.pop_front();
-                m_orderMap.erase(order->getId());
-                delete order;
-            }
-        }
-        
-        // Remove empty price level
-        if (level.totalQuantity == 0 || level.orders.empty()) {
-            m_asks.erase(it);
-        }
+        Quantity levelFilled = fillLevel(opposite, *level, order.getRemainingQty(), &fills);
+        order.fill(levelFilled);
+        filled += levelFilled;
+    }
+    
+    // Rest the LIMIT remainder under the same lock
+    if (isLimit && order.getRemainingQty() > 0) {
+        insertOrder(order);
     }
     
     return filled;
@@ -305,34 +301,131 @@ Quantity OrderBook::fillQuantityAtPrice(Side side, Price price, Quantity quantit
 
 std::vector<std::pair<Price, Quantity>> OrderBook::getTopBids(size_t n) const {
     std::lock_guard<std::mutex> lock(m_mutex);
+    return topLevels(*m_bids, n);
+}
+
+std::vector<std::pair<Price, Quantity>> OrderBook::getTopAsks(size_t n) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return topLevels(*m_asks, n);
+}
+
+void OrderBook::snapshot(size_t depth, BookSnapshot& out) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
     
-    std::vector<std::pair<Price, Quantity>> result;
-    result.reserve(n);
+    depth = std::min(depth, BookSnapshot::MAX_DEPTH);
+    auto copySide = [depth](const PriceLevelIndex& levels,
+                            std::array<BookSnapshot::Level, BookSnapshot::MAX_DEPTH>& dest) {
+        size_t count = 0;
+        if (depth == 0) return count;
+        levels.forEachLevel([&](const PriceLevel& level) {
+            dest[count++] = {level.price, level.totalQuantity};
+            return count < depth;
+        });
+        return count;
+    };
+    out.bidCount = copySide(*m_bids, out.bids);
+    out.askCount = copySide(*m_asks, out.asks);
+    
+    const PriceLevel* bestBid = m_bids->best();
+    const PriceLevel* bestAsk = m_asks->best();
+    out.bestBid = bestBid ? std::optional<Price>(bestBid->price) : std::nullopt;
+    out.bestAsk = bestAsk ? std::optional<Price>(bestAsk->price) : std::nullopt;
+    out.spread = (bestBid && bestAsk) ? std::optional<Price>(bestAsk->price - bestBid->price)
+                                      : std::nullopt;
+    
+    out.bidLevels = m_bids->size();
+    out.askLevels = m_asks->size();
+    out.orderCount = m_orderMap.size();
+    out.sequence = m_sequence;
+}
+
+uint64_t OrderBook::getSequence() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_sequence;
+}
+
+// ============================================================================
+// CHANGE SETS
+// ============================================================================
+
+void OrderBook::takeLevelChanges(std::vector<LevelChange>& out) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    out.clear();
     
-    size_t count = 0;
-    for (const auto& [price, level] : m_bids) {
-        if (count >= n) break;
-        result.emplace_back(price, level.totalQuantity);
-        ++count;
+    // Compare each touched level's total now against when it was first touched
+    for (const DirtyLevel& dirty : m_dirtyLevels) {
+        const PriceLevel* level = levelsFor(dirty.side).find(dirty.price);
+        Quantity after = level ? level->totalQuantity : 0;
+        if (after == dirty.before) continue;  // Ended up where it started
+        
+        LevelChangeType type = dirty.before == 0 ? LevelChangeType::ADDED
+                             : after == 0        ? LevelChangeType::REMOVED
+                                                 : LevelChangeType::CHANGED;
+        out.push_back(LevelChange{dirty.side, dirty.price, after, type});
     }
+    m_dirtyLevels.clear();
     
-    return result;
+    // Bids best (highest) first, then asks best (lowest) first
+    std::sort(out.begin(), out.end(), [](const LevelChange& a, const LevelChange& b) {
+        if (a.side != b.side) return a.side == Side::BUY;
+        return a.side == Side::BUY ? a.price > b.price : a.price < b.price;
+    });
 }
 
-std::vector<std::pair<Price, Quantity>> OrderBook::getTopAsks(size_t n) const {
+void OrderBook::updateLevels(Side side, const BookSnapshot::Level* levels, size_t count,
+                             OrderId& nextOrderId) {
     std::lock_guard<std::mutex> lock(m_mutex);
+    PriceLevelIndex& index = levelsFor(side);
     
-    std::vector<std::pair<Price, Quantity>> result;
-    result.reserve(n);
+    auto isTarget = [levels, count](Price price) {
+        for (size_t i = 0; i < count; ++i) {
+            if (levels[i].price == price && levels[i].quantity > 0) return true;
+        }
+        return false;
+    };
+    
+    // Drop the levels that are no longer wanted (collected first: erasing
+    // while visiting would invalidate the walk)
+    m_scratchPrices.clear();
+    index.forEachLevel([&](const PriceLevel& level) {
+        if (!isTarget(level.price)) m_scratchPrices.push_back(level.price);
+        return true;
+    });
+    for (Price price : m_scratchPrices) {
+        removeLevel(side, *index.find(price));
+    }
     
-    size_t count = 0;
-    for (const auto& [price, level] : m_asks) {
-        if (count >= n) break;
-        result.emplace_back(price, level.totalQuantity);
-        ++count;
+    // Create missing levels and resize the ones whose total differs
+    for (size_t i = 0; i < count; ++i) {
+        const BookSnapshot::Level& target = levels[i];
+        if (target.quantity == 0) continue;
+        
+        PriceLevel* level = index.find(target.price);
+        if (!level) {
+            insertOrder(Order(nextOrderId++, side, OrderType::LIMIT, target.price, target.quantity));
+            continue;
+        }
+        if (level->totalQuantity == target.quantity) continue;
+        
+        markDirty(side, level->price, level->totalQuantity);
+        
+        // Keep only the oldest order and give it the whole new total
+        while (level->head != level->tail) {
+            RestingOrder* node = level->tail;
+            level->removeOrder(node);
+            m_orderMap.erase(node->order.getId());
+            m_pool.release(node);
+        }
+        Order& head = level->head->order;
+        head.modifyQuantity(head.getFilledQty() + target.quantity);
+        level->totalQuantity = target.quantity;
+        m_sequence++;
     }
     
-    return result;
+    if (!m_scratchPrices.empty()) {
+        m_sequence++;
+    }
+    publishTopOfBook();
 }
 
 // ============================================================================
@@ -341,12 +434,12 @@ std::vector<std::pair<Price, Quantity>> OrderBook::getTopAsks(size_t n) const {
 
 size_t OrderBook::getBidLevelCount() const {
     std::lock_guard<std::mutex> lock(m_mutex);
-    return m_bids.size();
+    return m_bids->size();
 }
 
 size_t OrderBook::getAskLevelCount() const {
     std::lock_guard<std::mutex> lock(m_mutex);
-    return m_asks.size();
+    return m_asks->size();
 }
 
 size_t OrderBook::getTotalOrderCount() const {
@@ -354,48 +447,139 @@ size_t OrderBook::getTotalOrderCount() const {
     return m_orderMap.size();
 }
 
+OrderPool::Stats OrderBook::getPoolStats() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_pool.getStats();
+}
+
 // ============================================================================
 // INTERNAL HELPERS
 // ============================================================================
 
-void OrderBook::addToBook(Order* order) {
-    Price price = order->getPrice();
+std::vector<std::pair<Price, Quantity>> OrderBook::topLevels(const PriceLevelIndex& levels,
+                                                            size_t n) const {
+    // Caller must hold m_mutex
+    std::vector<std::pair<Price, Quantity>> result;
+    result.reserve(std::min(n, levels.size()));
+    
+    if (n == 0) return result;
+    levels.forEachLevel([&](const PriceLevel& level) {
+        result.emplace_back(level.price, level.totalQuantity);
+        return result.size() < n;
+    });
+    
+    return result;
+}
+
+Quantity OrderBook::fillLevel(PriceLevelIndex& levels, PriceLevel& level, Quantity quantity,
+                              std::vector<Fill>* fills) {
+    // Caller must hold m_mutex. Fills resting orders FIFO until quantity
+    // is satisfied or the level is exhausted; erases the level if empty.
+    Price price = level.price;
+    Quantity filled = 0;
+    markDirty(sideOf(levels), price, level.totalQuantity);
     
-    if (order->getSide() == Side::BUY) {
-        // Add to bids
-        if (m_bids.find(price) == m_bids.end()) {
-            m_bids[price] = PriceLevel{price, 0, {}};
+    while (!level.isEmpty() && filled < quantity) {
+        RestingOrder* node = level.head;
+        Order& resting = node->order;
+        Quantity toFill = std::min(resting.getRemainingQty(), quantity - filled);
+        
+        resting.fill(toFill);
+        level.totalQuantity -= toFill;
+        filled += toFill;
+        
+        if (fills) {
+            fills->push_back(Fill{resting.getId(), price, toFill});
         }
-        m_bids[price].addOrder(order);
-    } else {
-        // Add to asks
-        if (m_asks.find(price) == m_asks.end()) {
-            m_asks[price] = PriceLevel{price, 0, {}};
+        m_lastTradePrice = price;
+        m_lastTradeQuantity = toFill;
+        
+        // Remove fully filled orders
+        if (resting.getRemainingQty() == 0) {
+            level.removeOrder(node);
+            m_orderMap.erase(resting.getId());
+            m_pool.release(node);
         }
-        m_asks[price].addOrder(order);
     }
+    
+    // Remove empty price level
+    if (level.totalQuantity == 0 || level.isEmpty()) {
+        levels.erase(price);
+    }
+    
+    if (filled > 0) {
+        m_sequence++;
+    }
+    return filled;
 }
 
-void OrderBook::removeFromBook(Order* order) {
-    Price price = order->getPrice();
+void OrderBook::publishTopOfBook() {
+    // Caller must hold m_mutex (which also makes us the only seqlock writer)
+    if (m_sequence == m_publishedSequence) return;
     
-    if (order->getSide() == Side::BUY) {
-        auto it = m_bids.find(price);
-        if (it != m_bids.end()) {
-            it->second.removeOrder(order);
-            if (it->second.isEmpty()) {
-                m_bids.erase(it);
-            }
-        }
-    } else {
-        auto it = m_asks.find(price);
-        if (it != m_asks.end()) {
-            it->second.removeOrder(order);
-            if (it->second.isEmpty()) {
-                m_asks.erase(it);
-            }
+    TopOfBook top;
+    if (const PriceLevel* bid = m_bids->best()) {
+        top.bestBid = bid->price;
+        top.bidSize = bid->totalQuantity;
+    }
+    if (const PriceLevel* ask = m_asks->best()) {
+        top.bestAsk = ask->price;
+        top.askSize = ask->totalQuantity;
+    }
+    top.lastTradePrice = m_lastTradePrice;
+    top.lastTradeQuantity = m_lastTradeQuantity;
+    top.sequence = m_sequence;
+    
+    m_top.publish(top);
+    m_publishedSequence = m_sequence;
+}
+
+void OrderBook::addToBook(RestingOrder* node) {
+    // One lookup: creates the level if it does not exist yet
+    const Order& order = node->order;
+    PriceLevel& level = levelsFor(order.getSide()).getOrCreate(order.getPrice());
+    markDirty(order.getSide(), level.price, level.totalQuantity);
+    level.addOrder(node);
+}
+
+void OrderBook::removeFromBook(RestingOrder* node) {
+    // The level lookup is only needed for the head/tail/total bookkeeping;
+    // unlinking itself never walks the queue
+    const Order& order = node->order;
+    PriceLevelIndex& levels = levelsFor(order.getSide());
+    PriceLevel* level = levels.find(order.getPrice());
+    if (level) {
+        markDirty(order.getSide(), level->price, level->totalQuantity);
+        level->removeOrder(node);
+        if (level->isEmpty()) {
+            levels.erase(order.getPrice());
         }
     }
 }
 
+void OrderBook::removeLevel(Side side, PriceLevel& level) {
+    // Caller must hold m_mutex. Drops every order at the level, then the level.
+    Price price = level.price;
+    markDirty(side, price, level.totalQuantity);
+    while (!level.isEmpty()) {
+        RestingOrder* node = level.head;
+        level.removeOrder(node);
+        m_orderMap.erase(node->order.getId());
+        m_pool.release(node);
+    }
+    levelsFor(side).erase(price);
+}
+
+void OrderBook::markDirty(Side side, Price price, Quantity before) {
+    // Caller must hold m_mutex and call this BEFORE changing the level, so
+    // the first touch per level records its starting total
+    if (!m_config.trackLevelChanges) return;
+    
+    // A tick touches a handful of levels: a scan beats hashing here
+    for (const DirtyLevel& dirty : m_dirtyLevels) {
+        if (dirty.price == price && dirty.side == side) return;
+    }
+    m_dirtyLevels.push_back(DirtyLevel{side, price, before});
+}
+
 } // namespace orderbook
@@ -0,0 +1,126 @@
+// ============================================================================
+// ORDERIDINDEX.CPP - Flat hash index from OrderId to resting order node
+// ============================================================================
+
+#include "OrderIdIndex.h"
+#include <algorithm>
+
+namespace orderbook {
+
+namespace {
+
+// Smallest power of two that keeps n entries at <= 50% load
+size_t capacityFor(size_t n, size_t minCapacity) {
+    size_t capacity = minCapacity;
+    while (capacity < n * 2) {
+        capacity *= 2;
+    }
+    return capacity;
+}
+
+} // namespace
+
+// ============================================================================
+// CONSTRUCTOR
+// ============================================================================
+
+OrderIdIndex::OrderIdIndex(size_t expectedSize) {
+    rehash(capacityFor(expectedSize, MIN_CAPACITY));
+}
+
+// ============================================================================
+// LOOKUP / INSERT / ERASE
+// ============================================================================
+
+RestingOrder* OrderIdIndex::find(OrderId id) const {
+    for (size_t i = homeSlot(id);; i = (i + 1) & m_mask) {
+        const Slot& slot = m_slots[i];
+        if (!slot.value) return nullptr;    // Hit a gap: id is not present
+        if (slot.key == id) return slot.value;
+    }
+}
+
+bool OrderIdIndex::insert(OrderId id, RestingOrder* node) {
+    if ((m_size + 1) * 2 > m_slots.size()) {
+        rehash(m_slots.size() * 2);
+    }
+
+    for (size_t i = homeSlot(id);; i = (i + 1) & m_mask) {
+        Slot& slot = m_slots[i];
+        if (!slot.value) {
+            slot.key = id;
+            slot.value = node;
+            m_size++;
+            return true;
+        }
+        if (slot.key == id) return false;   // Duplicate
+    }
+}
+
+bool OrderIdIndex::erase(OrderId id) {
+    size_t hole = homeSlot(id);
+    for (;; hole = (hole + 1) & m_mask) {
+        if (!m_slots[hole].value) return false;
+        if (m_slots[hole].key == id) break;
+    }
+
+    // Backward shift: pull later entries of the probe run into the hole
+    // whenever the hole lies between their home slot and where they sit.
+    // Afterwards every run is contiguous again, so no tombstone is needed.
+    for (size_t next = (hole + 1) & m_mask;; next = (next + 1) & m_mask) {
+        Slot& candidate = m_slots[next];
+        if (!candidate.value) break;
+
+        size_t home = homeSlot(candidate.key);
+        size_t distToCandidate = (next - home) & m_mask;
+        size_t distToHole = (next - hole) & m_mask;
+        if (distToCandidate >= distToHole) {
+            m_slots[hole] = candidate;
+            hole = next;
+        }
+    }
+
+    m_slots[hole] = Slot{};
+    m_size--;
+    return true;
+}
+
+void OrderIdIndex::reserve(size_t n) {
+    size_t capacity = capacityFor(n, MIN_CAPACITY);
+    if (capacity > m_slots.size()) {
+        rehash(capacity);
+    }
+}
+
+void OrderIdIndex::clear() {
+    if (m_size == 0) return;
+    std::fill(m_slots.begin(), m_slots.end(), Slot{});
+    m_size = 0;
+}
+
+// ============================================================================
+// INTERNAL HELPERS
+// ============================================================================
+
+void OrderIdIndex::rehash(size_t newCapacity) {
+    std::vector<Slot> old;
+    old.swap(m_slots);
+
+    m_slots.assign(newCapacity, Slot{});
+    m_mask = newCapacity - 1;
+    m_shift = 64;
+    for (size_t blocks = newCapacity >> BLOCK_BITS; blocks > 1; blocks >>= 1) {
+        m_shift--;
+    }
+
+    for (const Slot& slot : old) {
+        if (!slot.value) continue;
+        size_t i = homeSlot(slot.key);
+        while (m_slots[i].value) {
+            i = (i + 1) & m_mask;
+        }
+        m_slots[i] = slot;
+    }
+}
+
+} // namespace orderbook
@@ -0,0 +1,80 @@
+// ============================================================================
+// ORDERPOOL.CPP - Slab allocator for resting order nodes
+// ============================================================================
+
+#include "OrderPool.h"
+#include <algorithm>
+
+namespace orderbook {
+
+// ============================================================================
+// CONSTRUCTOR
+// ============================================================================
+
+OrderPool::OrderPool(size_t capacityHint) {
+    addSlab(std::max<size_t>(capacityHint, 1));
+}
+
+// ============================================================================
+// ACQUIRE / RELEASE
+// ============================================================================
+
+RestingOrder* OrderPool::acquire(const Order& order) {
+    if (!m_freeList) {
+        // Double the pool so growth is amortized O(1) per node
+        addSlab(m_stats.capacity);
+    }
+
+    RestingOrder* node = m_freeList;
+    m_freeList = node->next;
+
+    node->order = order;
+    node->prev = nullptr;
+    node->next = nullptr;
+
+    m_stats.inUse++;
+    m_stats.highWater = std::max(m_stats.highWater, m_stats.inUse);
+    return node;
+}
+
+void OrderPool::release(RestingOrder* node) {
+    node->prev = nullptr;
+    node->next = m_freeList;
+    m_freeList = node;
+    m_stats.inUse--;
+}
+
+void OrderPool::reset() {
+    // Rebuild the free list over every slot of every slab
+    m_freeList = nullptr;
+    for (size_t s = m_slabs.size(); s-- > 0;) {
+        RestingOrder* slab = m_slabs[s].get();
+        for (size_t i = m_slabSizes[s]; i-- > 0;) {
+            slab[i].prev = nullptr;
+            slab[i].next = m_freeList;
+            m_freeList = &slab[i];
+        }
+    }
+    m_stats.inUse = 0;
+}
+
+// ============================================================================
+// INTERNAL HELPERS
+// ============================================================================
+
+void OrderPool::addSlab(size_t count) {
+    m_slabs.push_back(std::make_unique<RestingOrder[]>(count));
+    m_slabSizes.push_back(count);
+
+    // Thread the new slab onto the free list, lowest address first
+    RestingOrder* slab = m_slabs.back().get();
+    for (size_t i = count; i-- > 0;) {
+        slab[i].next = m_freeList;
+        m_freeList = &slab[i];
+    }
+
+    m_stats.capacity += count;
+    m_stats.slabs++;
+}
+
+} // namespace orderbook
@@ -85,6 +85,29 @@ std::optional<Order> OrderQueue::popWithTimeout(int timeoutMs) {
     return order;
 }
 
+size_t OrderQueue::popBatch(std::vector<Order>& out, size_t maxCount, int timeoutMs) {
+    out.clear();
+    std::unique_lock<std::mutex> lock(m_mutex);
+    
+    // Wait for the first order only
+    bool gotItem = m_condition.wait_for(
+        lock, 
+        std::chrono::milliseconds(timeoutMs),
+        [this] { return !m_queue.empty() || m_shutdown.load(); }
+    );
+    if (!gotItem) {
+        return 0;
+    }
+    
+    // One lock acquisition for the whole run
+    while (!m_queue.empty() && out.size() < maxCount) {
+        out.push_back(std::move(m_queue.front()));
+        m_queue.pop();
+    }
+    
+    return out.size();
+}
+
 // ============================================================================
 // QUEUE STATUS
 // ============================================================================
@@ -0,0 +1,86 @@
+// ============================================================================
+// OUTBOUNDQUEUE.CPP - Per-client send queue implementation
+// ============================================================================
+
+#include "OutboundQueue.h"
+#include <algorithm>
+
+namespace orderbook {
+
+// ============================================================================
+// PRODUCER
+// ============================================================================
+
+OutboundQueue::PushResult OutboundQueue::push(FrameRef frame, FrameDelivery delivery) {
+    bool replaced = false;
+    if (delivery == FrameDelivery::CONFLATE && m_hasConflatable) {
+        // Remove the stale tick and append the new one at the back, so it
+        // stays ordered after anything queued since
+        auto it = std::find_if(m_entries.begin(), m_entries.end(), [](const Entry& entry) {
+            return entry.delivery == FrameDelivery::CONFLATE;
+        });
+        m_queuedBytes -= it->frame->size();
+        m_entries.erase(it);
+        m_hasConflatable = false;
+        replaced = true;
+        ++m_conflated;
+        ++m_lagTicks;
+    }
+
+    if (m_entries.size() >= m_config.maxFrames) {
+        // (Never after a replacement: that just made room)
+        ++m_dropped;
+        if (delivery == FrameDelivery::ALWAYS) {
+            m_overflowed = true;
+        } else {
+            ++m_lagTicks;  // A tick the client will never see
+        }
+        return PushResult::DROPPED;
+    }
+
+    m_queuedBytes += frame->size();
+    m_entries.push_back({std::move(frame), delivery});
+    if (delivery == FrameDelivery::CONFLATE) {
+        m_hasConflatable = true;
+    }
+    return replaced ? PushResult::CONFLATED : PushResult::QUEUED;
+}
+
+// ============================================================================
+// CONSUMER
+// ============================================================================
+
+FrameRef OutboundQueue::pop() {
+    if (m_entries.empty()) {
+        return FrameRef();
+    }
+    Entry entry = std::move(m_entries.front());
+    m_entries.pop_front();
+    m_queuedBytes -= entry.frame->size();
+    if (entry.delivery == FrameDelivery::CONFLATE) {
+        m_hasConflatable = false;
+        m_lagTicks = 0;  // The client took a tick: caught up
+    }
+    return std::move(entry.frame);
+}
+
+// ============================================================================
+// POLICY
+// ============================================================================
+
+bool OutboundQueue::isSlowConsumer() const {
+    return m_overflowed ||
+           (m_config.slowConsumerTicks > 0 && m_lagTicks >= m_config.slowConsumerTicks);
+}
+
+OutboundQueueStats OutboundQueue::getStats() const {
+    OutboundQueueStats stats;
+    stats.queuedFrames = m_entries.size();
+    stats.queuedBytes = m_queuedBytes;
+    stats.conflated = m_conflated;
+    stats.dropped = m_dropped;
+    stats.lagTicks = m_lagTicks;
+    return stats;
+}
+
+} // namespace orderbook
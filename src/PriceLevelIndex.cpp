@@ -0,0 +1,306 @@
+// ============================================================================
+// PRICELEVELINDEX.CPP - Map and tick-array price level storage
+// ============================================================================
+
+#include "PriceLevelIndex.h"
+#include <algorithm>
+
+namespace orderbook {
+
+// ============================================================================
+// PRICE LEVEL METHODS
+// ============================================================================
+
+void PriceLevel::addOrder(RestingOrder* node) {
+    node->prev = tail;
+    node->next = nullptr;
+    if (tail) {
+        tail->next = node;
+    } else {
+        head = node;
+    }
+    tail = node;
+    orderCount++;
+    totalQuantity += node->order.getRemainingQty();
+}
+
+void PriceLevel::removeOrder(RestingOrder* node) {
+    // Caller guarantees the node is linked into THIS level
+    if (node->prev) {
+        node->prev->next = node->next;
+    } else {
+        head = node->next;
+    }
+    if (node->next) {
+        node->next->prev = node->prev;
+    } else {
+        tail = node->prev;
+    }
+    node->prev = nullptr;
+    node->next = nullptr;
+    orderCount--;
+    totalQuantity -= node->order.getRemainingQty();
+}
+
+void PriceLevel::reset() {
+    head = nullptr;
+    tail = nullptr;
+    orderCount = 0;
+    totalQuantity = 0;
+}
+
+// ============================================================================
+// MAP LEVEL INDEX
+// ============================================================================
+
+template <typename Compare>
+PriceLevel* MapLevelIndex<Compare>::find(Price price) {
+    auto it = m_levels.find(price);
+    return (it != m_levels.end()) ? &it->second : nullptr;
+}
+
+template <typename Compare>
+PriceLevel& MapLevelIndex<Compare>::getOrCreate(Price price) {
+    auto [it, inserted] = m_levels.try_emplace(price);
+    if (inserted) {
+        it->second.price = price;
+    }
+    return it->second;
+}
+
+template <typename Compare>
+void MapLevelIndex<Compare>::erase(Price price) {
+    m_levels.erase(price);
+}
+
+template <typename Compare>
+PriceLevel* MapLevelIndex<Compare>::best() {
+    return m_levels.empty() ? nullptr : &m_levels.begin()->second;
+}
+
+template <typename Compare>
+void MapLevelIndex<Compare>::visitLevels(
+    const std::function<bool(const PriceLevel&)>& visitor) const {
+    for (const auto& [price, level] : m_levels) {
+        if (!visitor(level)) break;
+    }
+}
+
+template class MapLevelIndex<std::greater<Price>>;
+template class MapLevelIndex<std::less<Price>>;
+
+// ============================================================================
+// TICK LEVEL INDEX
+// ============================================================================
+
+TickLevelIndex::TickLevelIndex(Side side, Price tickSize, size_t capacity, size_t maxCapacity)
+    : m_side(side)
+    , m_tickSize(tickSize.raw() > 0 ? tickSize : DEFAULT_TICK_SIZE)
+    , m_maxCapacity(std::max<size_t>({capacity, maxCapacity, 2}))
+    , m_levels(std::max<size_t>(capacity, 2))
+    , m_present(std::max<size_t>(capacity, 2), 0)
+{
+}
+
+int64_t TickLevelIndex::toTick(Price price) const {
+    return price.toTicks(m_tickSize);
+}
+
+bool TickLevelIndex::accepts(Price price) const {
+    // Only prices that sit on the tick grid map to a slot, and only if the
+    // window can reach them without outgrowing maxCapacity
+    return price.isOnTick(m_tickSize) && fitsWindow(toTick(price));
+}
+
+bool TickLevelIndex::fitsWindow(int64_t tick) const {
+    size_t slot = 0;
+    if (m_count == 0 || slotOf(tick, slot)) {
+        return true;
+    }
+    int64_t lowTick = tick;
+    int64_t highTick = tick;
+    liveRange(lowTick, highTick);
+    return static_cast<uint64_t>(highTick - lowTick) < m_maxCapacity;
+}
+
+void TickLevelIndex::liveRange(int64_t& lowTick, int64_t& highTick) const {
+    // Widens [lowTick, highTick] to cover every live level
+    for (size_t slot = 0; slot < m_levels.size(); ++slot) {
+        if (m_present[slot]) {
+            int64_t t = m_baseTick + static_cast<int64_t>(slot);
+            lowTick = std::min(lowTick, t);
+            highTick = std::max(highTick, t);
+        }
+    }
+}
+
+bool TickLevelIndex::slotOf(int64_t tick, size_t& slot) const {
+    int64_t offset = tick - m_baseTick;
+    if (offset < 0 || offset >= static_cast<int64_t>(m_levels.size())) {
+        return false;
+    }
+    slot = static_cast<size_t>(offset);
+    return true;
+}
+
+bool TickLevelIndex::isBetter(size_t a, size_t b) const {
+    // Bids: higher slot (price) is better. Asks: lower slot is better.
+    return (m_side == Side::BUY) ? a > b : a < b;
+}
+
+PriceLevel* TickLevelIndex::find(Price price) {
+    size_t slot = 0;
+    if (!accepts(price) || !slotOf(toTick(price), slot) || !m_present[slot]) {
+        return nullptr;
+    }
+    return &m_levels[slot];
+}
+
+PriceLevel& TickLevelIndex::getOrCreate(Price price) {
+    int64_t tick = toTick(price);
+    size_t slot = 0;
+    if (!slotOf(tick, slot)) {
+        rebase(tick);
+        slotOf(tick, slot);
+    }
+
+    if (!m_present[slot]) {
+        m_present[slot] = 1;
+        m_levels[slot].price = m_tickSize * tick;
+        m_levels[slot].reset();
+        m_count++;
+        if (m_best < 0 || isBetter(slot, static_cast<size_t>(m_best))) {
+            m_best = static_cast<long long>(slot);
+        }
+    }
+    return m_levels[slot];
+}
+
+void TickLevelIndex::erase(Price price) {
+    size_t slot = 0;
+    if (!accepts(price) || !slotOf(toTick(price), slot) || !m_present[slot]) {
+        return;
+    }
+
+    m_present[slot] = 0;
+    m_levels[slot].reset();
+    m_count--;
+
+    if (static_cast<long long>(slot) == m_best) {
+        findNextBest();
+    }
+}
+
+PriceLevel* TickLevelIndex::best() {
+    return (m_best < 0) ? nullptr : &m_levels[static_cast<size_t>(m_best)];
+}
+
+void TickLevelIndex::clear() {
+    // Walk only the live levels instead of the whole window
+    size_t remaining = m_count;
+    long long step = (m_side == Side::BUY) ? -1 : 1;
+    for (long long slot = m_best; remaining > 0 && slot >= 0 &&
+         slot < static_cast<long long>(m_levels.size()); slot += step) {
+        if (m_present[static_cast<size_t>(slot)]) {
+            m_present[static_cast<size_t>(slot)] = 0;
+            m_levels[static_cast<size_t>(slot)].reset();
+            remaining--;
+        }
+    }
+    m_count = 0;
+    m_best = -1;
+}
+
+void TickLevelIndex::visitLevels(
+    const std::function<bool(const PriceLevel&)>& visitor) const {
+    size_t remaining = m_count;
+    long long step = (m_side == Side::BUY) ? -1 : 1;
+    for (long long slot = m_best; remaining > 0 && slot >= 0 &&
+         slot < static_cast<long long>(m_levels.size()); slot += step) {
+        if (m_present[static_cast<size_t>(slot)]) {
+            remaining--;
+            if (!visitor(m_levels[static_cast<size_t>(slot)])) break;
+        }
+    }
+}
+
+void TickLevelIndex::findNextBest() {
+    if (m_count == 0) {
+        m_best = -1;
+        return;
+    }
+
+    // The new best is the next live slot on the worse side of the old one
+    long long step = (m_side == Side::BUY) ? -1 : 1;
+    for (long long slot = m_best + step; slot >= 0 &&
+         slot < static_cast<long long>(m_levels.size()); slot += step) {
+        if (m_present[static_cast<size_t>(slot)]) {
+            m_best = slot;
+            return;
+        }
+    }
+    m_best = -1;
+}
+
+void TickLevelIndex::rebase(int64_t tick) {
+    size_t capacity = m_levels.size();
+
+    // Empty side: just re-centre the window on the new price
+    if (m_count == 0) {
+        m_baseTick = tick - static_cast<int64_t>(capacity / 2);
+        return;
+    }
+
+    // Range of ticks that must fit: every live level plus the new one
+    // (accepts() guarantees it is within maxCapacity)
+    int64_t lowTick = tick;
+    int64_t highTick = tick;
+    liveRange(lowTick, highTick);
+
+    // Keep at least as much headroom as the live range on each side, as
+    // far as maxCapacity allows
+    size_t span = static_cast<size_t>(highTick - lowTick + 1);
+    size_t newCapacity = capacity;
+    while (newCapacity < span * 2 && newCapacity < m_maxCapacity) {
+        newCapacity *= 2;
+    }
+    newCapacity = std::max(span, std::min(newCapacity, m_maxCapacity));
+    int64_t newBase = lowTick - static_cast<int64_t>((newCapacity - span) / 2);
+
+    std::vector<PriceLevel> levels(newCapacity);
+    std::vector<char> present(newCapacity, 0);
+    long long best = -1;
+    for (size_t slot = 0; slot < capacity; ++slot) {
+        if (!m_present[slot]) continue;
+
+        size_t newSlot = static_cast<size_t>(m_baseTick + static_cast<int64_t>(slot) - newBase);
+        levels[newSlot] = std::move(m_levels[slot]);
+        present[newSlot] = 1;
+        if (static_cast<long long>(slot) == m_best) {
+            best = static_cast<long long>(newSlot);
+        }
+    }
+
+    m_levels = std::move(levels);
+    m_present = std::move(present);
+    m_baseTick = newBase;
+    m_best = best;
+}
+
+// ============================================================================
+// FACTORY
+// ============================================================================
+
+std::unique_ptr<PriceLevelIndex> makePriceLevelIndex(Side side, BookBackend backend,
+                                                     Price tickSize, size_t tickLevels,
+                                                     size_t maxTickLevels) {
+    if (backend == BookBackend::TICK_ARRAY) {
+        return std::make_unique<TickLevelIndex>(side, tickSize, tickLevels, maxTickLevels);
+    }
+    if (side == Side::BUY) {
+        return std::make_unique<MapLevelIndex<std::greater<Price>>>();
+    }
+    return std::make_unique<MapLevelIndex<std::less<Price>>>();
+}
+
+} // namespace orderbook
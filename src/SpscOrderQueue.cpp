@@ -0,0 +1,225 @@
+// ============================================================================
+// SPSCORDERQUEUE.CPP - Lock-free single-producer single-consumer order queue
+// ============================================================================
+
+#include "SpscOrderQueue.h"
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+namespace orderbook {
+
+namespace {
+
+// Spins before the consumer parks / the producer yields. A few microseconds
+// covers a typical cross-core hand-off without burning a core when idle.
+// On a single CPU the other side cannot run while we spin, so don't.
+const int SPIN_LIMIT = std::thread::hardware_concurrency() > 1 ? 2000 : 0;
+
+// Tell the CPU we are in a spin loop (saves power, frees the sibling
+// hyperthread, avoids a memory-order pipeline flush on exit)
+inline void cpuRelax() {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__)
+    asm volatile("yield");
+#endif
+}
+
+size_t roundUpToPowerOfTwo(size_t n) {
+    size_t capacity = 2;
+    while (capacity < n) {
+        capacity *= 2;
+    }
+    return capacity;
+}
+
+} // namespace
+
+// ============================================================================
+// CONSTRUCTOR
+// ============================================================================
+
+SpscOrderQueue::SpscOrderQueue(size_t capacity)
+    : m_ring(std::make_unique<Order[]>(roundUpToPowerOfTwo(capacity)))
+    , m_mask(roundUpToPowerOfTwo(capacity) - 1)
+{
+}
+
+// ============================================================================
+// PRODUCER METHODS
+// ============================================================================
+
+bool SpscOrderQueue::tryPush(const Order& order) {
+    size_t tail = m_tail.load(std::memory_order_relaxed);
+
+    // Only re-read the consumer's index when our cached copy says "full"
+    if (tail - m_cachedHead > m_mask) {
+        m_cachedHead = m_head.load(std::memory_order_acquire);
+        if (tail - m_cachedHead > m_mask) {
+            return false;
+        }
+    }
+
+    m_ring[tail & m_mask] = order;
+    m_tail.store(tail + 1, std::memory_order_release);
+
+    wakeConsumer();
+    return true;
+}
+
+void SpscOrderQueue::push(const Order& order) {
+    // Back-pressure: the consumer is behind by a whole ring
+    for (int spins = 0; !tryPush(order); ++spins) {
+        if (isShutdown()) return;
+        if (spins < SPIN_LIMIT) {
+            cpuRelax();
+        } else {
+            std::this_thread::yield();
+        }
+    }
+}
+
+void SpscOrderQueue::wakeConsumer() {
+    // Pairs with the fence in waitForOrder: either the consumer sees the
+    // new tail before parking, or we see that it has parked
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (m_consumerParked.load(std::memory_order_relaxed)) {
+        { std::lock_guard<std::mutex> lock(m_parkMutex); }
+        m_parkCondition.notify_one();
+    }
+}
+
+// ============================================================================
+// CONSUMER METHODS
+// ============================================================================
+
+bool SpscOrderQueue::popInto(Order& out) {
+    size_t head = m_head.load(std::memory_order_relaxed);
+
+    // Only re-read the producer's index when our cached copy says "empty"
+    if (head == m_cachedTail) {
+        m_cachedTail = m_tail.load(std::memory_order_acquire);
+        if (head == m_cachedTail) {
+            return false;
+        }
+    }
+
+    out = std::move(m_ring[head & m_mask]);
+    m_head.store(head + 1, std::memory_order_release);
+    return true;
+}
+
+std::optional<Order> SpscOrderQueue::tryPop() {
+    Order order;
+    if (!popInto(order)) {
+        return std::nullopt;
+    }
+    return order;
+}
+
+std::optional<Order> SpscOrderQueue::pop() {
+    Order order;
+    while (!popInto(order)) {
+        // Re-arm a long deadline rather than passing time_point::max(),
+        // which some wait_until implementations overflow on
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::hours(1);
+        if (!waitForOrder(deadline) && isShutdown()) {
+            return std::nullopt;  // Shutdown with nothing left
+        }
+    }
+    return order;
+}
+
+std::optional<Order> SpscOrderQueue::popWithTimeout(int timeoutMs) {
+    Order order;
+    if (popInto(order)) {
+        return order;  // Fast path: no clock read
+    }
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+    while (!popInto(order)) {
+        if (!waitForOrder(deadline)) {
+            return std::nullopt;  // Timed out, or shutdown with nothing left
+        }
+    }
+    return order;
+}
+
+size_t SpscOrderQueue::popBatch(std::vector<Order>& out, size_t maxCount, int timeoutMs) {
+    out.clear();
+
+    size_t head = m_head.load(std::memory_order_relaxed);
+    m_cachedTail = m_tail.load(std::memory_order_acquire);
+    if (head == m_cachedTail) {
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+        do {
+            if (!waitForOrder(deadline)) {
+                return 0;  // Timed out, or shutdown with nothing left
+            }
+            m_cachedTail = m_tail.load(std::memory_order_acquire);
+        } while (head == m_cachedTail);
+    }
+
+    // Copy out everything published so far, then release the slots at once
+    size_t count = std::min(m_cachedTail - head, maxCount);
+    for (size_t i = 0; i < count; ++i) {
+        out.push_back(std::move(m_ring[(head + i) & m_mask]));
+    }
+    m_head.store(head + count, std::memory_order_release);
+    return count;
+}
+
+void SpscOrderQueue::clear() {
+    m_cachedTail = m_tail.load(std::memory_order_acquire);
+    m_head.store(m_cachedTail, std::memory_order_release);
+}
+
+template <typename Deadline>
+bool SpscOrderQueue::waitForOrder(const Deadline& deadline) {
+    auto hasOrder = [this] {
+        return m_head.load(std::memory_order_relaxed) != m_tail.load(std::memory_order_acquire);
+    };
+
+    // Spin first: cheap, and most hand-offs land inside this window
+    for (int spins = 0; spins < SPIN_LIMIT; ++spins) {
+        if (hasOrder()) return true;
+        if (isShutdown()) return hasOrder();
+        cpuRelax();
+    }
+
+    // Park. Announce it first, then re-check, so a push that raced with
+    // us either is seen here or sees the flag and notifies.
+    std::unique_lock<std::mutex> lock(m_parkMutex);
+    m_consumerParked.store(true, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    bool ready = m_parkCondition.wait_until(lock, deadline, [&] {
+        return hasOrder() || isShutdown();
+    });
+
+    m_consumerParked.store(false, std::memory_order_relaxed);
+    return ready && hasOrder();
+}
+
+// ============================================================================
+// QUEUE STATUS
+// ============================================================================
+
+size_t SpscOrderQueue::size() const {
+    size_t head = m_head.load(std::memory_order_acquire);
+    size_t tail = m_tail.load(std::memory_order_acquire);
+    return tail - head;
+}
+
+// ============================================================================
+// LIFECYCLE
+// ============================================================================
+
+void SpscOrderQueue::shutdown() {
+    m_shutdown.store(true, std::memory_order_release);
+    { std::lock_guard<std::mutex> lock(m_parkMutex); }
+    m_parkCondition.notify_all();
+}
+
+} // namespace orderbook
@@ -0,0 +1,240 @@
+// ============================================================================
+// TICKSCHEDULER.CPP - Per-session tick deadline implementation
+// ============================================================================
+
+#include "TickScheduler.h"
+#include <algorithm>
+#include <cmath>
+
+namespace orderbook {
+
+namespace {
+
+double toMs(TickScheduler::Clock::duration d) {
+    return std::chrono::duration<double, std::milli>(d).count();
+}
+
+} // namespace
+
+// ============================================================================
+// SESSIONS
+// ============================================================================
+
+void TickScheduler::add(uint32_t id, Clock::duration interval, Clock::time_point firstDue,
+                        Context context) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_sessions.find(id);
+        if (it != m_sessions.end()) {
+            it->second.interval = interval;
+            return;
+        }
+        Session& session = m_sessions[id];
+        session.interval = interval;
+        session.due = firstDue;
+        session.context = std::move(context);
+        pushLocked(id, session);
+    }
+    m_wake.notify_all();  // The loop re-reads the earliest deadline
+}
+
+void TickScheduler::setInterval(uint32_t id, Clock::duration interval) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_sessions.find(id);
+        if (it == m_sessions.end()) return;
+
+        Session& session = it->second;
+        session.interval = interval;
+        if (session.inFlight) return;  // complete() uses the new interval
+
+        Clock::time_point now = Clock::now();
+        Clock::time_point last = session.lastStarted == Clock::time_point() ? now : session.lastStarted;
+        session.due = std::max(now, last + interval);
+        session.lastStarted = Clock::time_point();  // Old spacing is no jitter sample
+        pushLocked(id, session);
+    }
+    m_wake.notify_all();  // The loop re-reads the earliest deadline
+}
+
+void TickScheduler::remove(uint32_t id) {
+    // Its heap entry goes stale and is dropped when it reaches the top
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_sessions.erase(id);
+}
+
+size_t TickScheduler::size() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_sessions.size();
+}
+
+// ============================================================================
+// TICK LOOP
+// ============================================================================
+
+void TickScheduler::waitDue(Clock::time_point until, std::vector<Due>& due) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true) {
+        Clock::time_point now = Clock::now();
+        size_t before = due.size();
+        popDueLocked(now, due);
+        if (due.size() > before || m_woken || now >= until) {
+            m_woken = false;
+            return;
+        }
+
+        // Sleep to the earliest deadline. add/setInterval notify so it is
+        // recomputed; wake() makes the call return
+        pruneLocked();
+        Clock::time_point wakeAt = until;
+        if (!m_heap.empty() && m_heap.top().due < wakeAt) {
+            wakeAt = m_heap.top().due;
+        }
+        m_wake.wait_until(lock, wakeAt);
+    }
+}
+
+void TickScheduler::popDue(Clock::time_point now, std::vector<Due>& due) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    popDueLocked(now, due);
+}
+
+void TickScheduler::popDueLocked(Clock::time_point now, std::vector<Due>& due) {
+    while (!m_heap.empty() && m_heap.top().due <= now) {
+        HeapEntry entry = m_heap.top();
+        m_heap.pop();
+
+        auto it = m_sessions.find(entry.id);
+        if (it == m_sessions.end() || it->second.version != entry.version || it->second.inFlight) {
+            continue;  // Removed or rescheduled since it was pushed
+        }
+        it->second.inFlight = true;
+        due.push_back({entry.id, entry.due, entry.version, it->second.context});
+    }
+}
+
+void TickScheduler::complete(const Due& due, Clock::time_point started) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_sessions.find(due.id);
+    if (it == m_sessions.end() || it->second.version != due.version) {
+        return;  // Removed (or removed and re-added) while it was stepped
+    }
+    Session& session = it->second;
+    session.inFlight = false;
+
+    double driftMs = std::max(0.0, toMs(started - due.at));
+    ++session.steps;
+    session.driftSumMs += driftMs;
+    session.driftMaxMs = std::max(session.driftMaxMs, driftMs);
+    if (session.lastStarted != Clock::time_point()) {
+        double jitterMs = std::abs(toMs(started - session.lastStarted) - toMs(session.interval));
+        ++session.jitterSamples;
+        session.jitterSumMs += jitterMs;
+        session.jitterMaxMs = std::max(session.jitterMaxMs, jitterMs);
+    }
+    session.lastStarted = started;
+
+    // Fixed rate from the deadline; skip ticks the session is already past
+    Clock::time_point next = due.at + session.interval;
+    if (next <= started && session.interval > Clock::duration::zero()) {
+        auto missed = (started - due.at) / session.interval;
+        m_skipped += static_cast<uint64_t>(missed);
+        next = due.at + (missed + 1) * session.interval;
+    }
+    session.due = next;
+    pushLocked(due.id, session);
+}
+
+void TickScheduler::wake() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_woken = true;
+    }
+    m_wake.notify_all();
+}
+
+TickScheduler::Clock::time_point TickScheduler::nextDue() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    pruneLocked();
+    return m_heap.empty() ? Clock::time_point::max() : m_heap.top().due;
+}
+
+void TickScheduler::pushLocked(uint32_t id, Session& session) {
+    session.version = ++m_nextVersion;
+    m_heap.push({session.due, id, session.version});
+}
+
+void TickScheduler::pruneLocked() {
+    while (!m_heap.empty()) {
+        const HeapEntry& top = m_heap.top();
+        auto it = m_sessions.find(top.id);
+        if (it != m_sessions.end() && it->second.version == top.version && !it->second.inFlight) {
+            return;
+        }
+        m_heap.pop();
+    }
+}
+
+// ============================================================================
+// STATISTICS
+// ============================================================================
+
+TickSchedulerStats TickScheduler::window() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    TickSchedulerStats stats;
+    stats.sessions = m_sessions.size();
+    stats.skipped = m_skipped;
+
+    double driftSum = 0.0;
+    double jitterSum = 0.0;
+    uint64_t jitterSamples = 0;
+    for (const auto& [id, session] : m_sessions) {
+        stats.steps += session.steps;
+        driftSum += session.driftSumMs;
+        jitterSum += session.jitterSumMs;
+        jitterSamples += session.jitterSamples;
+        if (session.steps > 0 && session.driftMaxMs >= stats.maxDriftMs) {
+            stats.maxDriftMs = session.driftMaxMs;
+            stats.worstSession = id;
+        }
+        stats.maxJitterMs = std::max(stats.maxJitterMs, session.jitterMaxMs);
+    }
+    stats.avgDriftMs = stats.steps ? driftSum / static_cast<double>(stats.steps) : 0.0;
+    stats.avgJitterMs = jitterSamples ? jitterSum / static_cast<double>(jitterSamples) : 0.0;
+    return stats;
+}
+
+std::vector<SessionTiming> TickScheduler::sessionTimings() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::vector<SessionTiming> timings;
+    timings.reserve(m_sessions.size());
+    for (const auto& [id, session] : m_sessions) {
+        SessionTiming timing;
+        timing.id = id;
+        timing.steps = session.steps;
+        timing.avgDriftMs = session.steps ? session.driftSumMs / static_cast<double>(session.steps) : 0.0;
+        timing.maxDriftMs = session.driftMaxMs;
+        timing.avgJitterMs = session.jitterSamples
+            ? session.jitterSumMs / static_cast<double>(session.jitterSamples) : 0.0;
+        timing.maxJitterMs = session.jitterMaxMs;
+        timings.push_back(timing);
+    }
+    std::sort(timings.begin(), timings.end(),
+              [](const SessionTiming& a, const SessionTiming& b) { return a.id < b.id; });
+    return timings;
+}
+
+void TickScheduler::resetWindow() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (auto& [id, session] : m_sessions) {
+        session.steps = 0;
+        session.driftSumMs = 0.0;
+        session.driftMaxMs = 0.0;
+        session.jitterSamples = 0;
+        session.jitterSumMs = 0.0;
+        session.jitterMaxMs = 0.0;
+    }
+    m_skipped = 0;
+}
+
+} // namespace orderbook
@@ -37,12 +37,15 @@ Visualizer::Visualizer(const OrderBook& orderBook, const std::string& symbol)
 // ============================================================================
 
 void Visualizer::render(size_t levels) const {
+    // One consistent view of the book for the whole frame
+    m_orderBook.snapshot(levels, m_snapshot);
+    
     clearScreen();
-    printPriceTicker();      // Show prominent price display
+    drawPriceTicker();       // Show prominent price display
     printPriceChart();       // Show price history chart
     printHeader();
-    printOrderBook(levels);
-    printFooter();
+    drawOrderBook(levels);
+    drawFooter();
     printRecentTrades(5);
 }
 
@@ -73,16 +76,14 @@ void Visualizer::printHeader() const {
 }
 
 void Visualizer::printOrderBook(size_t levels) const {
-    auto bids = m_orderBook.getTopBids(levels);
-    auto asks = m_orderBook.getTopAsks(levels);
-    
-    // Make both vectors the same size by padding with empty entries
-    while (bids.size() < levels) {
-        bids.emplace_back(0.0, 0);
-    }
-    while (asks.size() < levels) {
-        asks.emplace_back(0.0, 0);
-    }
+    m_orderBook.snapshot(levels, m_snapshot);
+    drawOrderBook(levels);
+}
+
+void Visualizer::drawOrderBook(size_t levels) const {
+    const auto& bids = m_snapshot.bids;
+    const auto& asks = m_snapshot.asks;
+    levels = std::min(levels, BookSnapshot::MAX_DEPTH);
     
     // Print column headers
     std::cout << "\n";
@@ -96,10 +97,10 @@ void Visualizer::printOrderBook(size_t levels) const {
     for (size_t i = 0; i < levels; ++i) {
         // Bid side (show in reverse order so highest is at top)
         size_t bidIdx = i;
-        if (bidIdx < bids.size() && bids[bidIdx].second > 0) {
-            std::cout << colorize(formatQuantity(bids[bidIdx].second), "green");
+        if (bidIdx < m_snapshot.bidCount && bids[bidIdx].quantity > 0) {
+            std::cout << colorize(formatQuantity(bids[bidIdx].quantity), "green");
             std::cout << " x ";
-            std::cout << colorize(formatPrice(bids[bidIdx].first), "green");
+            std::cout << colorize(formatPrice(bids[bidIdx].price), "green");
         } else {
             std::cout << std::setw(24) << " ";
         }
@@ -112,10 +113,10 @@ void Visualizer::printOrderBook(size_t levels) const {
         }
         
         // Ask side
-        if (i < asks.size() && asks[i].second > 0) {
-            std::cout << colorize(formatPrice(asks[i].first), "red");
+        if (i < m_snapshot.askCount && asks[i].quantity > 0) {
+            std::cout << colorize(formatPrice(asks[i].price), "red");
             std::cout << " x ";
-            std::cout << colorize(formatQuantity(asks[i].second), "red");
+            std::cout << colorize(formatQuantity(asks[i].quantity), "red");
         }
         
         std::cout << "\n";
@@ -125,9 +126,14 @@ void Visualizer::printOrderBook(size_t levels) const {
 }
 
 void Visualizer::printFooter() const {
-    auto bestBid = m_orderBook.getBestBid();
-    auto bestAsk = m_orderBook.getBestAsk();
-    auto spread = m_orderBook.getSpread();
+    m_orderBook.snapshot(0, m_snapshot);
+    drawFooter();
+}
+
+void Visualizer::drawFooter() const {
+    const auto& bestBid = m_snapshot.bestBid;
+    const auto& bestAsk = m_snapshot.bestAsk;
+    const auto& spread = m_snapshot.spread;
     
     std::cout << "\n";
     std::cout << "  Best Bid: ";
@@ -154,9 +160,9 @@ void Visualizer::printFooter() const {
     std::cout << "\n";
     
     // Statistics
-    std::cout << "  Bid Levels: " << m_orderBook.getBidLevelCount();
-    std::cout << "  |  Ask Levels: " << m_orderBook.getAskLevelCount();
-    std::cout << "  |  Total Orders: " << m_orderBook.getTotalOrderCount();
+    std::cout << "  Bid Levels: " << m_snapshot.bidLevels;
+    std::cout << "  |  Ask Levels: " << m_snapshot.askLevels;
+    std::cout << "  |  Total Orders: " << m_snapshot.orderCount;
     std::cout << "\n";
     
     printLine('=', 62);
@@ -167,25 +173,30 @@ void Visualizer::printFooter() const {
 // ============================================================================
 
 void Visualizer::printPriceTicker() const {
+    m_orderBook.snapshot(0, m_snapshot);
+    drawPriceTicker();
+}
+
+void Visualizer::drawPriceTicker() const {
     // Use LAST TRADE PRICE as the current price (this is how real markets work!)
     // If no trades yet, fall back to order book mid
-    Price currentPrice = m_lastPrice;
+    double currentPrice = m_lastPrice;
     
     if (currentPrice <= 0) {
         // No trades yet - use order book mid as fallback
-        auto bestBid = m_orderBook.getBestBid();
-        auto bestAsk = m_orderBook.getBestAsk();
+        const auto& bestBid = m_snapshot.bestBid;
+        const auto& bestAsk = m_snapshot.bestAsk;
         
         if (!bestBid && !bestAsk) {
             return;  // No price to show
         }
         
         if (bestBid && bestAsk) {
-            currentPrice = (*bestBid + *bestAsk) / 2.0;
+            currentPrice = (bestBid->toDouble() + bestAsk->toDouble()) / 2.0;
         } else if (bestBid) {
-            currentPrice = *bestBid;
+            currentPrice = bestBid->toDouble();
         } else {
-            currentPrice = *bestAsk;
+            currentPrice = bestAsk->toDouble();
         }
         
         // Initialize price tracking from order book
@@ -221,8 +232,8 @@ void Visualizer::printPriceChart() const {
     const int chartWidth = 60;   // Fixed width for consistency
     
     // Find min/max for scaling
-    Price minPrice = *std::min_element(m_priceHistory.begin(), m_priceHistory.end());
-    Price maxPrice = *std::max_element(m_priceHistory.begin(), m_priceHistory.end());
+    double minPrice = *std::min_element(m_priceHistory.begin(), m_priceHistory.end());
+    double maxPrice = *std::max_element(m_priceHistory.begin(), m_priceHistory.end());
     
     // Ensure meaningful range (at least 0.5% of price)
     double range = maxPrice - minPrice;
@@ -241,7 +252,7 @@ void Visualizer::printPriceChart() const {
     }
     
     // Current price for highlighting
-    Price currentPrice = m_priceHistory.back();
+    double currentPrice = m_priceHistory.back();
     int currentRow = chartHeight - 1 - static_cast<int>(((currentPrice - minPrice) / range) * (chartHeight - 1));
     currentRow = std::max(0, std::min(chartHeight - 1, currentRow));
     
@@ -355,7 +366,7 @@ void Visualizer::printPriceChart() const {
     std::cout << "\n";
 }
 
-void Visualizer::updatePriceTracking(Price price) const {
+void Visualizer::updatePriceTracking(double price) const {
     // Store previous for tick direction
     m_previousPrice = m_lastPrice;
     m_lastPrice = price;
@@ -396,7 +407,7 @@ void Visualizer::addTrade(Price price, Quantity quantity, Side side) {
     // UPDATE PRICE TRACKING FROM ACTUAL TRADE PRICES!
     // This is the key - the "current price" is the LAST TRADE PRICE, not the order book mid
     // Note: updatePriceTracking already handles price history for the chart
-    updatePriceTracking(price);
+    updatePriceTracking(price.toDouble());
 }
 
 void Visualizer::printRecentTrades(size_t count) const {
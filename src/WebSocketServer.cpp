@@ -17,321 +17,18 @@ namespace orderbook {
 // Static instance
 WebSocketServer* WebSocketServer::s_instance = nullptr;
 
-// ============================================================================
-// JSON Builder Implementation
-// ============================================================================
-
-std::string JsonBuilder::orderBookToJson(const OrderBook& book) {
-    std::ostringstream ss;
-    ss << std::fixed << std::setprecision(2);
-    
-    auto bids = book.getTopBids(15);
-    auto asks = book.getTopAsks(15);
-    auto bestBid = book.getBestBid();
-    auto bestAsk = book.getBestAsk();
-    
-    ss << R"({"type":"orderbook","data":{)";
-    
-    // Bids (already sorted by price descending from getTopBids)
-    ss << R"("bids":[)";
-    int count = 0;
-    for (const auto& bid : bids) {
-        if (count > 0) ss << ",";
-        ss << R"({"price":)" << bid.first << R"(,"quantity":)" << bid.second << "}";
-        count++;
-    }
-    ss << "],";
-    
-    // Asks (already sorted by price ascending from getTopAsks)
-    ss << R"("asks":[)";
-    count = 0;
-    for (const auto& ask : asks) {
-        if (count > 0) ss << ",";
-        ss << R"({"price":)" << ask.first << R"(,"quantity":)" << ask.second << "}";
-        count++;
-    }
-    ss << "],";
-    
-    // Best prices and spread
-    double bestBidPrice = bestBid.value_or(0.0);
-    double bestAskPrice = bestAsk.value_or(0.0);
-    double spread = (bestAskPrice > 0 && bestBidPrice > 0) ? bestAskPrice - bestBidPrice : 0.0;
-    
-    ss << R"("bestBid":)" << bestBidPrice << ",";
-    ss << R"("bestAsk":)" << bestAskPrice << ",";
-    ss << R"("spread":)" << spread;
-    
-    ss << "}}";
-    return ss.str();
-}
-
-std::string JsonBuilder::tradeToJson(double price, int quantity, const std::string& side) {
-    static int tradeId = 0;
-    std::ostringstream ss;
-    ss << std::fixed << std::setprecision(2);
-    
-    ss << R"({"type":"trade","data":{)";
-    ss << R"("id":)" << ++tradeId << ",";
-    ss << R"("price":)" << price << ",";
-    ss << R"("quantity":)" << quantity << ",";
-    ss << R"("side":")" << side << R"(",)";
-    ss << R"("timestamp":)" << std::time(nullptr) * 1000;  // milliseconds
-    ss << "}}";
-    
-    return ss.str();
-}
-
-std::string JsonBuilder::statsToJson(
-    const std::string& symbol,
-    double currentPrice,
-    double openPrice,
-    double highPrice,
-    double lowPrice,
-    size_t totalOrders,
-    size_t totalTrades,
-    size_t totalVolume,
-    int marketOrderPct,
-    const std::string& sentiment,
-    const std::string& intensity,
-    double spread,
-    double speed,
-    bool paused,
-    bool newsShockEnabled,
-    bool newsShockCooldown,
-    int newsShockCooldownRemaining,
-    int newsShockActiveRemaining
-) {
-    std::ostringstream ss;
-    ss << std::fixed << std::setprecision(2);
-    
-    ss << R"({"type":"stats","data":{)";
-    ss << R"("symbol":")" << symbol << R"(",)";
-    ss << R"("currentPrice":)" << currentPrice << ",";
-    ss << R"("openPrice":)" << openPrice << ",";
-    ss << R"("highPrice":)" << highPrice << ",";
-    ss << R"("lowPrice":)" << lowPrice << ",";
-    ss << R"("totalOrders":)" << totalOrders << ",";
-    ss << R"("totalTrades":)" << totalTrades << ",";
-    ss << R"("totalVolume":)" << totalVolume << ",";
-    ss << R"("marketOrderPct":)" << marketOrderPct << ",";
-    ss << R"("sentiment":")" << sentiment << R"(",)";
-    ss << R"("intensity":")" << intensity << R"(",)";
-    ss << R"("spread":)" << spread << ",";
-    ss << R"("speed":)" << speed << ",";
-    ss << R"("paused":)" << (paused ? "true" : "false") << ",";
-    ss << R"("newsShockEnabled":)" << (newsShockEnabled ? "true" : "false") << ",";
-    ss << R"("newsShockCooldown":)" << (newsShockCooldown ? "true" : "false") << ",";
-    ss << R"("newsShockCooldownRemaining":)" << newsShockCooldownRemaining << ",";
-    ss << R"("newsShockActiveRemaining":)" << newsShockActiveRemaining;
-    ss << "}}";
-    
-    return ss.str();
-}
-
-std::string JsonBuilder::priceToJson(double price, int volume) {
-    std::ostringstream ss;
-    ss << std::fixed << std::setprecision(2);
-    
-    auto now = std::chrono::system_clock::now();
-    auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()).count();
-    
-    ss << R"({"type":"price","data":{)";
-    ss << R"("timestamp":)" << ms << ",";
-    ss << R"("price":)" << price << ",";
-    ss << R"("volume":)" << volume;
-    ss << "}}";
-    
-    return ss.str();
-}
-
-std::string JsonBuilder::tickToJson(
-    const OrderBook& book,
-    const std::string& statsJson,
-    double price,
-    int volume,
-    int64_t timestamp,
-    const TradeData* trade,
-    const std::map<int, orderbook::Candle>& currentCandles,
-    const std::vector<orderbook::CompletedCandle>& completedCandles
-) {
-    std::ostringstream ss;
-    ss << std::fixed << std::setprecision(2);
-    
-    // Extract stats data (remove outer wrapper {"type":"stats","data":{...}})
-    // We need just the inner {...} part
-    std::string statsData = "{}"; // Default empty object
-    size_t dataStart = statsJson.find("\"data\":");
-    if (dataStart != std::string::npos) {
-        size_t start = statsJson.find("{", dataStart + 7);
-        if (start != std::string::npos) {
-            // Find matching closing brace by counting
-            int depth = 0;
-            size_t end = start;
-            for (size_t i = start; i < statsJson.length(); i++) {
-                if (statsJson[i] == '{') depth++;
-                else if (statsJson[i] == '}') {
-                    depth--;
-                    if (depth == 0) {
-                        end = i;
-                        break;
-                    }
-                }
-            }
-            if (end > start) {
-                statsData = statsJson.substr(start, end - start + 1);
-            }
-        }
-    }
-    
-    // Build order book JSON inline
-    auto bids = book.getTopBids(15);
-    auto asks = book.getTopAsks(15);
-    auto bestBid = book.getBestBid();
-    auto bestAsk = book.getBestAsk();
-    
-    ss << R"({"type":"tick","data":{)";
-    
-    // Order book
-    ss << R"("orderbook":{)";
-    ss << R"("bids":[)";
-    int count = 0;
-    for (const auto& bid : bids) {
-        if (count > 0) ss << ",";
-        ss << R"({"price":)" << bid.first << R"(,"quantity":)" << bid.second << "}";
-        count++;
-    }
-    ss << "],";
-    ss << R"("asks":[)";
-    count = 0;
-    for (const auto& ask : asks) {
-        if (count > 0) ss << ",";
-        ss << R"({"price":)" << ask.first << R"(,"quantity":)" << ask.second << "}";
-        count++;
-    }
-    ss << "],";
-    double bestBidPrice = bestBid.value_or(0.0);
-    double bestAskPrice = bestAsk.value_or(0.0);
-    double spread = (bestAskPrice > 0 && bestBidPrice > 0) ? bestAskPrice - bestBidPrice : 0.0;
-    ss << R"("bestBid":)" << bestBidPrice << ",";
-    ss << R"("bestAsk":)" << bestAskPrice << ",";
-    ss << R"("spread":)" << spread;
-    ss << "},";
-    
-    // Stats
-    ss << R"("stats":)" << statsData << ",";
-    
-    // Price point
-    ss << R"("price":{"timestamp":)" << timestamp << R"(,"price":)" << price << R"(,"volume":)" << volume << "},";
-    
-    // Current candles (for all timeframes)
-    ss << R"("currentCandles":{)";
-    bool first = true;
-    for (const auto& [tf, candle] : currentCandles) {
-        if (!first) ss << ",";
-        first = false;
-        ss << "\"" << tf << "\":{";
-        ss << R"("timestamp":)" << candle.timestamp << ",";
-        ss << R"("open":)" << candle.open << ",";
-        ss << R"("high":)" << candle.high << ",";
-        ss << R"("low":)" << candle.low << ",";
-        ss << R"("close":)" << candle.close << ",";
-        ss << R"("volume":)" << candle.volume;
-        ss << "}";
-    }
-    ss << "},";
-    
-    // Completed candles (if any)
-    if (!completedCandles.empty()) {
-        ss << R"("completedCandles":[)";
-        for (size_t i = 0; i < completedCandles.size(); i++) {
-            if (i > 0) ss << ",";
-            const auto& cc = completedCandles[i];
-            ss << R"({"timeframe":)" << cc.timeframe << ",";
-            ss << R"("candle":{)";
-            ss << R"("timestamp":)" << cc.candle.timestamp << ",";
-            ss << R"("open":)" << cc.candle.open << ",";
-            ss << R"("high":)" << cc.candle.high << ",";
-            ss << R"("low":)" << cc.candle.low << ",";
-            ss << R"("close":)" << cc.candle.close << ",";
-            ss << R"("volume":)" << cc.candle.volume;
-            ss << "}}";
-        }
-        ss << "],";
-    } else {
-        ss << R"("completedCandles":null,)";
-    }
-    
-    // Trade (optional)
-    if (trade && trade->isValid()) {
-        ss << R"("trade":{)";
-        ss << R"("id":)" << trade->id << ",";
-        ss << R"("price":)" << trade->price << ",";
-        ss << R"("quantity":)" << trade->quantity << ",";
-        ss << R"("side":")" << trade->side << R"(",)";
-        ss << R"("timestamp":)" << trade->timestamp;
-        ss << "}";
-    } else {
-        ss << R"("trade":null)";
-    }
-    
-    ss << "}}";
-    
-    return ss.str();
-}
-
-// Candle history response (for getCandles command)
-std::string JsonBuilder::candleHistoryToJson(
-    int timeframe,
-    const std::vector<orderbook::Candle>& candles,
-    const orderbook::Candle* current
-) {
-    std::ostringstream ss;
-    ss << std::fixed << std::setprecision(2);
-    
-    ss << R"({"type":"candleHistory","data":{)";
-    ss << R"("timeframe":)" << timeframe << ",";
-    
-    // Cached candles
-    ss << R"("candles":[)";
-    for (size_t i = 0; i < candles.size(); i++) {
-        if (i > 0) ss << ",";
-        const auto& c = candles[i];
-        ss << "{";
-        ss << R"("timestamp":)" << c.timestamp << ",";
-        ss << R"("open":)" << c.open << ",";
-        ss << R"("high":)" << c.high << ",";
-        ss << R"("low":)" << c.low << ",";
-        ss << R"("close":)" << c.close << ",";
-        ss << R"("volume":)" << c.volume;
-        ss << "}";
-    }
-    ss << "],";
-    
-    // Current candle
-    if (current) {
-        ss << R"("current":{)";
-        ss << R"("timestamp":)" << current->timestamp << ",";
-        ss << R"("open":)" << current->open << ",";
-        ss << R"("high":)" << current->high << ",";
-        ss << R"("low":)" << current->low << ",";
-        ss << R"("close":)" << current->close << ",";
-        ss << R"("volume":)" << current->volume;
-        ss << "}";
-    } else {
-        ss << R"("current":null)";
-    }
-    
-    ss << "}}";
-    return ss.str();
-}
+// lws_write() writes the frame header into the bytes before the payload
+static_assert(OutboundFrame::HEADROOM >= LWS_PRE, "OutboundFrame headroom must cover LWS_PRE");
 
 // ============================================================================
 // WebSocket Server Implementation
 // ============================================================================
 
-// Per-session data - just a simple ID, actual data stored in server
+// Per-session data - the ID and the server's entry (kept alive by the
+// registry until LWS_CALLBACK_CLOSED)
 struct PerSessionData {
     uint32_t clientId;
+    WebSocketServer::ClientData* client;
 };
 
 // Client ID counter
@@ -384,7 +81,8 @@ static struct lws_protocols protocols[] = {
     }
 };
 
-WebSocketServer::WebSocketServer(int port) : m_port(port) {
+WebSocketServer::WebSocketServer(int port, int serviceThreads)
+    : m_port(port), m_requestedThreads(std::max(1, serviceThreads)) {
     s_instance = this;
 }
 
@@ -405,6 +103,7 @@ bool WebSocketServer::start() {
     info.gid = -1;
     info.uid = -1;
     info.options = 0;  // No special options - allow plain WebSocket
+    info.count_threads = static_cast<unsigned int>(m_requestedThreads);  // Capped by LWS_MAX_SMP
     
     // WebSocket keepalive settings to prevent connection timeout
     info.ka_time = 60;         // Start keepalive after 60 seconds of inactivity
@@ -420,13 +119,28 @@ bool WebSocketServer::start() {
         std::cerr << "[Server] [ERROR] Failed to create WebSocket context\n";
         return false;
     }
+    
+    // libwebsockets built with LWS_MAX_SMP=1 (common for distro packages)
+    // silently runs a single service thread
+    int threads = std::max(1, lws_get_count_threads(m_context));
+    if (threads < m_requestedThreads) {
+        std::cout << "[Server] [WARN] libwebsockets supports " << threads << " service thread(s), "
+                  << m_requestedThreads << " requested\n";
+    }
+    m_pendingWrites.clear();
+    for (int tsi = 0; tsi < threads; ++tsi) {
+        m_pendingWrites.push_back(std::make_unique<PendingWrites>());
+    }
 
     m_running = true;
     m_metrics.serverStartTime = std::chrono::duration_cast<std::chrono::milliseconds>(
         std::chrono::system_clock::now().time_since_epoch()).count();
-    m_serverThread = std::thread(&WebSocketServer::serverThread, this);
+    for (int tsi = 0; tsi < threads; ++tsi) {
+        m_serviceThreads.emplace_back(&WebSocketServer::serviceThread, this, tsi);
+    }
     
-    std::cout << "WebSocket server started on port " << m_port << "\n";
+    std::cout << "WebSocket server started on port " << m_port
+              << " (" << threads << " service thread" << (threads > 1 ? "s" : "") << ")\n";
     return true;
 }
 
@@ -434,10 +148,16 @@ void WebSocketServer::stop() {
     if (!m_running) return;
     
     m_running = false;
+    if (m_context) {
+        lws_cancel_service(m_context);  // Wake every service thread
+    }
     
-    if (m_serverThread.joinable()) {
-        m_serverThread.join();
+    for (std::thread& thread : m_serviceThreads) {
+        if (thread.joinable()) {
+            thread.join();
+        }
     }
+    m_serviceThreads.clear();
     
     if (m_context) {
         lws_context_destroy(m_context);
@@ -455,13 +175,20 @@ static constexpr int64_t SUMMARY_INTERVAL_MS = 30 * 1000;
 // Forward declaration of formatDuration (defined later in file)
 static std::string formatDuration(int64_t ms);
 
-void WebSocketServer::serverThread() {
+void WebSocketServer::serviceThread(int tsi) {
     int64_t lastTimeoutCheck = 0;
     int64_t lastSummaryDisplay = 0;
     
     while (m_running) {
-        // Service WebSocket events - this handles all callbacks
-        lws_service(m_context, 50);  // 50ms timeout
+        // Service WebSocket events for this thread's connections - this
+        // handles their callbacks. Returns early on lws_cancel_service()
+        lws_service_tsi(m_context, 50, tsi);  // 50ms timeout
+        
+        // Writes and disconnects other threads asked for
+        servicePending(tsi);
+        
+        // Housekeeping runs on the first thread only
+        if (tsi != 0) continue;
         
         auto now = std::chrono::duration_cast<std::chrono::milliseconds>(
             std::chrono::system_clock::now().time_since_epoch()).count();
@@ -470,21 +197,28 @@ void WebSocketServer::serverThread() {
         if (now - lastSummaryDisplay > SUMMARY_INTERVAL_MS) {
             lastSummaryDisplay = now;
             
-            std::lock_guard<std::mutex> lock(m_clientsMutex);
-            if (!m_clients.empty()) {
+            ClientSnapshot clients = m_clients.snapshot();
+            if (!clients->empty()) {
                 std::cout << "\n[Server] ======= CONNECTION SUMMARY =======\n";
                 std::cout << "[Server] Total connections: " << m_metrics.totalConnections 
-                          << " | Active: " << m_clients.size() << "\n";
+                          << " | Active: " << clients->size() << "\n";
                 std::cout << "[Server] ---------------------------------\n";
                 
-                for (const auto& [id, client] : m_clients) {
-                    int64_t durationMs = now - client.connectedAt;
+                for (const ClientHandle& client : *clients) {
+                    int64_t durationMs = now - client->connectedAt;
                     int64_t remainingMs = MAX_CONNECTION_DURATION_MS - durationMs;
+                    uint32_t lagTicks;
+                    {
+                        std::lock_guard<std::mutex> lock(client->mutex);
+                        lagTicks = client->messageQueue.getStats().lagTicks;
+                    }
                     
-                    std::cout << "[Server] Session " << id 
-                              << " | IP: " << client.ipAddress
+                    std::cout << "[Server] Session " << client->id 
+                              << " | IP: " << client->ipAddress
+                              << " | Thread: " << client->tsi
                               << " | Active: " << formatDuration(durationMs)
                               << " | Remaining: " << formatDuration(remainingMs)
+                              << " | Lag: " << lagTicks << " ticks"
                               << "\n";
                 }
                 std::cout << "[Server] =====================================\n\n";
@@ -495,55 +229,90 @@ void WebSocketServer::serverThread() {
         if (now - lastTimeoutCheck > 10000) {
             lastTimeoutCheck = now;
             
-            std::vector<std::pair<uint32_t, struct lws*>> expiredClients;
-            {
-                std::lock_guard<std::mutex> lock(m_clientsMutex);
-                for (auto& [id, client] : m_clients) {
-                    int64_t connectionDuration = now - client.connectedAt;
-                    if (connectionDuration >= MAX_CONNECTION_DURATION_MS) {
-                        expiredClients.push_back({id, client.wsi});
-                    }
+            // Queue a timeout notification; the client's own service thread
+            // closes the connection once it has been written
+            const FrameRef timeoutMsg = FrameRef::copyOf(
+                R"({"type":"timeout","message":"Session expired after 60 minutes. Please reconnect to continue."})",
+                false);
+            bool queued = false;
+            ClientSnapshot clients = m_clients.snapshot();
+            for (const ClientHandle& client : *clients) {
+                if (now - client->connectedAt < MAX_CONNECTION_DURATION_MS) continue;
+                std::lock_guard<std::mutex> lock(client->mutex);
+                if (!client->closeAfterDrain) {
+                    std::cout << "[Session " << client->id << "] Connection timeout (60 min limit reached)\n";
+                    queued |= pushLocked(client, timeoutMsg, FrameDelivery::ALWAYS);
+                    client->closeAfterDrain = true;
                 }
             }
-            
-            // Send timeout notification and close expired connections
-            for (auto& [clientId, wsi] : expiredClients) {
-                std::cout << "[Session " << clientId << "] Connection timeout (60 min limit reached)\n";
-                
-                // Send a timeout message before closing
-                std::string timeoutMsg = R"({"type":"timeout","message":"Session expired after 60 minutes. Please reconnect to continue."})";
-                sendToClient(clientId, timeoutMsg);
-                
-                // Request close from lws
-                lws_close_reason(wsi, LWS_CLOSE_STATUS_NORMAL,
-                    (unsigned char*)"Session timeout", 15);
-                lws_callback_on_writable(wsi);
+            if (queued) {
+                lws_cancel_service(m_context);
             }
         }
     }
 }
 
-void WebSocketServer::broadcast(const std::string& message) {
-    // Step 1: Add message to each client's queue (under lock)
-    std::vector<struct lws*> clientsToNotify;
+void WebSocketServer::servicePending(int tsi) {
+    std::vector<ClientHandle> pending;
     {
-        std::lock_guard<std::mutex> lock(m_clientsMutex);
-        for (auto& [id, client] : m_clients) {
-            // Limit queue size to prevent memory issues
-            if (client.messageQueue.size() < 100) {
-                client.messageQueue.push(message);
+        PendingWrites& writes = *m_pendingWrites[tsi];
+        std::lock_guard<std::mutex> lock(writes.mutex);
+        if (writes.clients.empty()) return;
+        pending.swap(writes.clients);
+    }
+    
+    std::vector<struct lws*> writable;
+    writable.reserve(pending.size());
+    for (const ClientHandle& client : pending) {
+        std::lock_guard<std::mutex> lock(client->mutex);
+        if (!client->wsi) continue;  // Closed meanwhile
+        client->writePending = false;
+        
+        // Drop clients flagged as slow consumers. A stalled socket never
+        // becomes writable, so kill the connection instead of waiting to
+        // write a close frame
+        if (client->slowConsumer) {
+            if (!client->closeRequested) {
+                client->closeRequested = true;
+                m_metrics.slowConsumerDisconnects++;
+                lws_close_reason(client->wsi, LWS_CLOSE_STATUS_POLICY_VIOLATION,
+                    (unsigned char*)"Slow consumer", 13);
+                lws_set_timeout(client->wsi, PENDING_TIMEOUT_USER_REASON_BASE, LWS_TO_KILL_ASYNC);
             }
-            clientsToNotify.push_back(client.wsi);
+            continue;
         }
+        writable.push_back(client->wsi);
     }
     
-    // Step 2: Request writable callback OUTSIDE the lock
-    for (auto* wsi : clientsToNotify) {
+    // On the owning thread, outside the locks. The wsi cannot close in
+    // between: that too happens on this thread
+    for (struct lws* wsi : writable) {
         lws_callback_on_writable(wsi);
     }
+}
+
+void WebSocketServer::broadcast(const std::string& message) {
+    broadcastFrame(FrameRef::copyOf(message, false));
+}
+
+void WebSocketServer::broadcastFrame(const FrameRef& frame, FrameDelivery delivery) {
+    // One reference to the frame per client. Clients of different service
+    // threads get separate copies: lws_write() fills the headroom in front
+    // of the payload, and two threads must not write it at once
+    bool queued = false;
+    std::vector<FrameRef> perThread(m_pendingWrites.size());
+    ClientSnapshot clients = m_clients.snapshot();
+    for (const ClientHandle& client : *clients) {
+        FrameRef& copy = perThread[client->tsi];
+        if (!copy) {
+            copy = client->tsi == 0 ? frame : FrameRef::copyOf(frame->payload(), frame->isBinary());
+        }
+        std::lock_guard<std::mutex> lock(client->mutex);
+        queued |= pushLocked(client, copy, delivery);
+    }
     
-    // Cancel any wait so lws_service processes sooner
-    if (m_context) {
+    // Wake the service threads so they pick up the writes
+    if (queued && m_context) {
         lws_cancel_service(m_context);
     }
 }
@@ -565,65 +334,126 @@ void WebSocketServer::broadcastPrice(const std::string& json) {
 }
 
 void WebSocketServer::sendToClient(uint32_t clientId, const std::string& message) {
-    struct lws* wsi = nullptr;
+    enqueue(m_clients.find(clientId), FrameRef::copyOf(message, false), FrameDelivery::ALWAYS);
+}
+
+void WebSocketServer::sendBinaryToClient(uint32_t clientId, const std::string& bytes) {
+    enqueue(m_clients.find(clientId), FrameRef::copyOf(bytes, true), FrameDelivery::ALWAYS);
+}
+
+void WebSocketServer::sendFrame(uint32_t clientId, FrameRef frame, FrameDelivery delivery) {
+    enqueue(m_clients.find(clientId), std::move(frame), delivery);
+}
+
+void WebSocketServer::sendFrame(const ClientHandle& client, FrameRef frame, FrameDelivery delivery) {
+    enqueue(client, std::move(frame), delivery);
+}
+
+void WebSocketServer::enqueue(const ClientHandle& client, FrameRef frame, FrameDelivery delivery) {
+    if (!client) return;
+    bool queued;
     {
-        std::lock_guard<std::mutex> lock(m_clientsMutex);
-        auto it = m_clients.find(clientId);
-        if (it != m_clients.end()) {
-            // Limit queue size to prevent memory issues
-            if (it->second.messageQueue.size() < 100) {
-                it->second.messageQueue.push(message);
-                // Track bytes sent
-                m_metrics.totalBytesSent += message.size();
-                m_metrics.totalMessagesOut++;
-            }
-            wsi = it->second.wsi;
-        }
+        std::lock_guard<std::mutex> lock(client->mutex);
+        queued = pushLocked(client, frame, delivery);
     }
     
-    // Request writable callback outside the lock
-    if (wsi) {
-        lws_callback_on_writable(wsi);
+    // lws_callback_on_writable() is only safe on the connection's own
+    // service thread: wake it, and it requests the write itself
+    if (queued && m_context) {
+        lws_cancel_service(m_context);
     }
+}
+
+bool WebSocketServer::pushLocked(const ClientHandle& handle, const FrameRef& frame,
+                                 FrameDelivery delivery) {
+    ClientData& client = *handle;
+    if (!client.wsi || client.slowConsumer || client.closeAfterDrain) return false;  // Closed or closing
     
-    if (m_context) {
-        lws_cancel_service(m_context);
+    OutboundQueue::PushResult result = client.messageQueue.push(frame, delivery);
+    switch (result) {
+        case OutboundQueue::PushResult::QUEUED:
+            break;
+        case OutboundQueue::PushResult::CONFLATED:
+            m_metrics.totalConflated++;
+            break;
+        case OutboundQueue::PushResult::DROPPED:
+            m_metrics.totalDropped++;
+            break;
     }
+    
+    // A replaced or dropped DELTA frame leaves the client's book behind:
+    // make the next tick a snapshot
+    if (OutboundQueue::tickLost(result, delivery) && client.session) {
+        client.session->requestBookResync();
+    }
+    
+    if (client.messageQueue.isSlowConsumer()) {
+        OutboundQueueStats stats = client.messageQueue.getStats();
+        std::cout << "[Session " << client.id << "] [SLOW] Disconnecting slow consumer (lag: "
+                  << stats.lagTicks << " ticks, queued: " << stats.queuedFrames
+                  << ", dropped: " << stats.dropped << ")\n";
+        client.slowConsumer = true;
+    }
+    
+    // Hand the client to its service thread (once until it is serviced)
+    if (!client.writePending) {
+        client.writePending = true;
+        PendingWrites& writes = *m_pendingWrites[client.tsi];
+        std::lock_guard<std::mutex> lock(writes.mutex);
+        writes.clients.push_back(handle);
+    }
+    return true;
+}
+
+void WebSocketServer::setOutboundQueueConfig(const OutboundQueueConfig& config) {
+    std::lock_guard<std::mutex> lock(m_configMutex);
+    m_queueConfig = config;
+}
+
+void WebSocketServer::setSessionSeed(uint64_t base) {
+    std::lock_guard<std::mutex> lock(m_configMutex);
+    m_sessionSeed = base;
+}
+
+OutboundQueueStats WebSocketServer::getOutboundStats(uint32_t clientId) const {
+    ClientHandle client = m_clients.find(clientId);
+    if (!client) return OutboundQueueStats();
+    std::lock_guard<std::mutex> lock(client->mutex);
+    return client->messageQueue.getStats();
 }
 
 std::vector<uint32_t> WebSocketServer::getClientIds() const {
     std::vector<uint32_t> ids;
-    std::lock_guard<std::mutex> lock(m_clientsMutex);
-    for (const auto& [id, _] : m_clients) {
-        ids.push_back(id);
+    ClientSnapshot clients = m_clients.snapshot();
+    for (const ClientHandle& client : *clients) {
+        ids.push_back(client->id);
     }
     return ids;
 }
 
+bool WebSocketServer::isConnected(const ClientHandle& client) {
+    std::lock_guard<std::mutex> lock(client->mutex);
+    return client->wsi != nullptr;
+}
+
+// The session lives as long as the connection; callers on other threads
+// should hold a ClientHandle (getClients()) rather than the bare pointer
 SessionState* WebSocketServer::getSession(uint32_t clientId) {
-    std::lock_guard<std::mutex> lock(m_clientsMutex);
-    auto it = m_clients.find(clientId);
-    if (it != m_clients.end() && it->second.session) {
-        return it->second.session.get();
-    }
-    return nullptr;
+    ClientHandle client = m_clients.find(clientId);
+    return client ? client->session.get() : nullptr;
 }
 
 const SessionState* WebSocketServer::getSession(uint32_t clientId) const {
-    std::lock_guard<std::mutex> lock(m_clientsMutex);
-    auto it = m_clients.find(clientId);
-    if (it != m_clients.end() && it->second.session) {
-        return it->second.session.get();
-    }
-    return nullptr;
+    ClientHandle client = m_clients.find(clientId);
+    return client ? client->session.get() : nullptr;
 }
 
 std::vector<SessionState*> WebSocketServer::getAllSessions() {
     std::vector<SessionState*> sessions;
-    std::lock_guard<std::mutex> lock(m_clientsMutex);
-    for (auto& [id, client] : m_clients) {
-        if (client.session && client.session->isRunning()) {
-            sessions.push_back(client.session.get());
+    ClientSnapshot clients = m_clients.snapshot();
+    for (const ClientHandle& client : *clients) {
+        if (client->session->isRunning()) {
+            sessions.push_back(client->session.get());
         }
     }
     return sessions;
@@ -675,6 +505,9 @@ void WebSocketServer::printStats() const {
     std::cout << "  Messages Out: " << m_metrics.totalMessagesOut.load() << "\n";
     std::cout << "  Bytes Received: " << formatBytes(m_metrics.totalBytesReceived.load()) << "\n";
     std::cout << "  Bytes Sent: " << formatBytes(m_metrics.totalBytesSent.load()) << "\n";
+    std::cout << "  Ticks Conflated: " << m_metrics.totalConflated.load() << "\n";
+    std::cout << "  Frames Dropped: " << m_metrics.totalDropped.load() << "\n";
+    std::cout << "  Slow Consumers Dropped: " << m_metrics.slowConsumerDisconnects.load() << "\n";
     std::cout << "========================================\n";
     
     // Also print per-session stats
@@ -682,9 +515,8 @@ void WebSocketServer::printStats() const {
 }
 
 void WebSocketServer::printAllSessionStats() const {
-    std::lock_guard<std::mutex> lock(m_clientsMutex);
-    
-    if (m_clients.empty()) {
+    ClientSnapshot clients = m_clients.snapshot();
+    if (clients->empty()) {
         std::cout << "  No active sessions\n\n";
         return;
     }
@@ -695,34 +527,42 @@ void WebSocketServer::printAllSessionStats() const {
     std::cout << "\n  Active Sessions:\n";
     std::cout << "  ----------------------------------------\n";
     
-    for (const auto& [id, client] : m_clients) {
+    for (const ClientHandle& handle : *clients) {
+        const ClientData& client = *handle;
+        std::lock_guard<std::mutex> lock(client.mutex);
         int64_t duration = now - client.connectedAt;
-        std::cout << "  [Session " << id << "] " << client.ipAddress << "\n";
+        std::cout << "  [Session " << client.id << "] " << client.ipAddress << "\n";
         std::cout << "    Duration: " << formatDuration(duration) << "\n";
         std::cout << "    Sent: " << formatBytes(client.bytesSent) 
                   << " (" << client.messagesSent << " msgs)\n";
         std::cout << "    Recv: " << formatBytes(client.bytesReceived) 
                   << " (" << client.messagesReceived << " msgs)\n";
+        OutboundQueueStats queue = client.messageQueue.getStats();
+        std::cout << "    Queue: " << queue.queuedFrames << " frames (" << formatBytes(queue.queuedBytes)
+                  << ") | Lag: " << queue.lagTicks << " ticks | Conflated: " << queue.conflated
+                  << " | Dropped: " << queue.dropped << "\n";
     }
     std::cout << "  ----------------------------------------\n\n";
 }
 
 std::string WebSocketServer::getSessionStatsString(uint32_t clientId) const {
-    std::lock_guard<std::mutex> lock(m_clientsMutex);
-    
-    auto it = m_clients.find(clientId);
-    if (it == m_clients.end()) {
+    ClientHandle client = m_clients.find(clientId);
+    if (!client) {
         return "Session not found";
     }
     
     auto now = std::chrono::duration_cast<std::chrono::milliseconds>(
         std::chrono::system_clock::now().time_since_epoch()).count();
-    int64_t duration = now - it->second.connectedAt;
+    int64_t duration = now - client->connectedAt;
     
+    std::lock_guard<std::mutex> lock(client->mutex);
     std::ostringstream ss;
     ss << "Duration: " << formatDuration(duration)
-       << " | Sent: " << formatBytes(it->second.bytesSent) << " (" << it->second.messagesSent << " msgs)"
-       << " | Recv: " << formatBytes(it->second.bytesReceived) << " (" << it->second.messagesReceived << " msgs)";
+       << " | Sent: " << formatBytes(client->bytesSent) << " (" << client->messagesSent << " msgs)"
+       << " | Recv: " << formatBytes(client->bytesReceived) << " (" << client->messagesReceived << " msgs)";
+    OutboundQueueStats queue = client->messageQueue.getStats();
+    ss << " | Lag: " << queue.lagTicks << " ticks | Conflated: " << queue.conflated
+       << " | Dropped: " << queue.dropped;
     return ss.str();
 }
 
@@ -880,9 +720,6 @@ int WebSocketServer::callback(struct lws* wsi, enum lws_callback_reasons reason,
         case LWS_CALLBACK_ESTABLISHED: {
             // Assign client ID
             uint32_t clientId = g_nextClientId++;
-            if (pss) {
-                pss->clientId = clientId;
-            }
             
             // Get client IP address
             char ipBuffer[128] = {0};
@@ -897,25 +734,34 @@ int WebSocketServer::callback(struct lws* wsi, enum lws_callback_reasons reason,
             int64_t connectedAt = std::chrono::duration_cast<std::chrono::milliseconds>(
                 now.time_since_epoch()).count();
             
+            // Create client data with new session state
+            auto client = std::make_shared<ClientData>();
+            client->id = clientId;
+            client->tsi = lws_get_tsi(wsi);
+            SessionConfig sessionConfig;
             {
-                std::lock_guard<std::mutex> lock(s_instance->m_clientsMutex);
-                // Create client data with new session state
-                ClientData clientData;
-                clientData.wsi = wsi;
-                clientData.session = std::make_unique<SessionState>(clientId);
-                clientData.ipAddress = clientIp;
-                clientData.connectedAt = connectedAt;
-                clientData.bytesSent = 0;
-                clientData.bytesReceived = 0;
-                clientData.messagesSent = 0;
-                clientData.messagesReceived = 0;
-                s_instance->m_clients[clientId] = std::move(clientData);
-                s_instance->m_connectionCount++;
-                s_instance->m_metrics.totalConnections++;
-                s_instance->m_metrics.activeConnections++;
+                std::lock_guard<std::mutex> lock(s_instance->m_configMutex);
+                client->messageQueue = OutboundQueue(s_instance->m_queueConfig);
+                if (s_instance->m_sessionSeed != 0) {
+                    sessionConfig.seed = FastRng::deriveSeed(s_instance->m_sessionSeed, clientId);
+                }
+            }
+            client->session = std::make_unique<SessionState>(clientId, sessionConfig);
+            uint64_t sessionSeed = client->session->getSeed();
+            client->ipAddress = clientIp;
+            client->connectedAt = connectedAt;
+            client->wsi = wsi;
+            if (pss) {
+                pss->clientId = clientId;
+                pss->client = client.get();
             }
+            s_instance->m_clients.insert(clientId, std::move(client));
+            s_instance->m_connectionCount++;
+            s_instance->m_metrics.totalConnections++;
+            s_instance->m_metrics.activeConnections++;
             std::cout << "[Session " << clientId << "] [CONNECT] IP: " << clientIp 
-                      << " (active: " << s_instance->m_connectionCount << ")\\n";
+                      << " (active: " << s_instance->m_connectionCount << ")"
+                      << " | Seed: " << sessionSeed << "\n";
             break;
         }
         
@@ -923,14 +769,18 @@ int WebSocketServer::callback(struct lws* wsi, enum lws_callback_reasons reason,
             uint32_t clientId = pss ? pss->clientId : 0;
             std::string disconnectInfo;
             {
-                std::lock_guard<std::mutex> lock(s_instance->m_clientsMutex);
-                auto it = s_instance->m_clients.find(clientId);
-                if (it != s_instance->m_clients.end()) {
+                // Readers holding a handle keep the entry (and session) alive
+                ClientHandle client = s_instance->m_clients.erase(clientId);
+                if (client) {
+                    std::lock_guard<std::mutex> lock(client->mutex);
+                    client->wsi = nullptr;  // No more writes or kills
+                    client->messageQueue = OutboundQueue();  // Release queued frames
+                    
                     // Calculate session duration
                     auto now = std::chrono::system_clock::now();
                     int64_t nowMs = std::chrono::duration_cast<std::chrono::milliseconds>(
                         now.time_since_epoch()).count();
-                    int64_t durationMs = nowMs - it->second.connectedAt;
+                    int64_t durationMs = nowMs - client->connectedAt;
                     int durationSec = static_cast<int>(durationMs / 1000);
                     
                     // Format bytes
@@ -941,16 +791,16 @@ int WebSocketServer::callback(struct lws* wsi, enum lws_callback_reasons reason,
                     };
                     
                     std::ostringstream ss;
-                    ss << "IP: " << it->second.ipAddress
+                    ss << "IP: " << client->ipAddress
                        << " | Duration: " << durationSec << "s"
-                       << " | Sent: " << formatBytes(it->second.bytesSent) 
-                       << " (" << it->second.messagesSent << " msgs)"
-                       << " | Recv: " << formatBytes(it->second.bytesReceived)
-                       << " (" << it->second.messagesReceived << " msgs)";
+                       << " | Sent: " << formatBytes(client->bytesSent) 
+                       << " (" << client->messagesSent << " msgs)"
+                       << " | Recv: " << formatBytes(client->bytesReceived)
+                       << " (" << client->messagesReceived << " msgs)";
                     disconnectInfo = ss.str();
-                    
-                    // Session is automatically destroyed with unique_ptr
-                    s_instance->m_clients.erase(it);
+                }
+                if (pss) {
+                    pss->client = nullptr;
                 }
                 s_instance->m_connectionCount--;
                 s_instance->m_metrics.activeConnections--;
@@ -968,13 +818,10 @@ int WebSocketServer::callback(struct lws* wsi, enum lws_callback_reasons reason,
             s_instance->m_metrics.totalBytesReceived += len;
             s_instance->m_metrics.totalMessagesIn++;
             
-            {
-                std::lock_guard<std::mutex> lock(s_instance->m_clientsMutex);
-                auto it = s_instance->m_clients.find(clientId);
-                if (it != s_instance->m_clients.end()) {
-                    it->second.bytesReceived += len;
-                    it->second.messagesReceived++;
-                }
+            if (pss && pss->client) {
+                std::lock_guard<std::mutex> lock(pss->client->mutex);
+                pss->client->bytesReceived += len;
+                pss->client->messagesReceived++;
             }
             
             if (g_debug) {
@@ -986,30 +833,26 @@ int WebSocketServer::callback(struct lws* wsi, enum lws_callback_reasons reason,
         }
         
         case LWS_CALLBACK_SERVER_WRITEABLE: {
-            if (!pss) break;
+            if (!pss || !pss->client) break;
             
             uint32_t clientId = pss->clientId;
-            std::string msg;
+            ClientData& client = *pss->client;
+            FrameRef frame;
             bool hasMore = false;
-            size_t msgLen = 0;
+            bool closeNow = false;
             
             {
-                std::lock_guard<std::mutex> lock(s_instance->m_clientsMutex);
-                auto it = s_instance->m_clients.find(clientId);
-                if (it != s_instance->m_clients.end() && !it->second.messageQueue.empty()) {
-                    msg = it->second.messageQueue.front();
-                    it->second.messageQueue.pop();
-                    hasMore = !it->second.messageQueue.empty();
-                    msgLen = msg.length();
-                }
+                std::lock_guard<std::mutex> lock(client.mutex);
+                frame = client.messageQueue.pop();
+                hasMore = !client.messageQueue.empty();
+                closeNow = client.closeAfterDrain && !hasMore;
             }
             
-            if (!msg.empty()) {
-                // Prepare buffer with LWS_PRE padding
-                std::vector<unsigned char> buf(LWS_PRE + msg.length());
-                memcpy(&buf[LWS_PRE], msg.c_str(), msg.length());
-                
-                int written = lws_write(wsi, &buf[LWS_PRE], msg.length(), LWS_WRITE_TEXT);
+            if (frame && !frame->empty()) {
+                // The frame already has LWS_PRE headroom: write it in place
+                size_t msgLen = frame->size();
+                int written = lws_write(wsi, frame->wireData(), msgLen,
+                                        frame->isBinary() ? LWS_WRITE_BINARY : LWS_WRITE_TEXT);
                 if (written < 0) {
                     std::cerr << "[Session " << clientId << "] [ERROR] Write failed\\n";
                 } else {
@@ -1017,12 +860,9 @@ int WebSocketServer::callback(struct lws* wsi, enum lws_callback_reasons reason,
                     s_instance->m_metrics.totalBytesSent += msgLen;
                     s_instance->m_metrics.totalMessagesOut++;
                     
-                    std::lock_guard<std::mutex> lock(s_instance->m_clientsMutex);
-                    auto it = s_instance->m_clients.find(clientId);
-                    if (it != s_instance->m_clients.end()) {
-                        it->second.bytesSent += msgLen;
-                        it->second.messagesSent++;
-                    }
+                    std::lock_guard<std::mutex> lock(client.mutex);
+                    client.bytesSent += msgLen;
+                    client.messagesSent++;
                 }
                 
                 // If more messages in queue, request another callback
@@ -1030,6 +870,13 @@ int WebSocketServer::callback(struct lws* wsi, enum lws_callback_reasons reason,
                     lws_callback_on_writable(wsi);
                 }
             }
+            
+            // Expired session: the timeout notice was the last frame
+            if (closeNow) {
+                lws_close_reason(wsi, LWS_CLOSE_STATUS_NORMAL,
+                    (unsigned char*)"Session timeout", 15);
+                return -1;
+            }
             break;
         }
         
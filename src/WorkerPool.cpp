@@ -0,0 +1,143 @@
+// ============================================================================
+// WORKERPOOL.CPP - Work-stealing thread pool implementation
+// ============================================================================
+
+#include "WorkerPool.h"
+#include <algorithm>
+
+namespace orderbook {
+
+// ============================================================================
+// CONSTRUCTION
+// ============================================================================
+
+WorkerPool::WorkerPool(size_t workers) {
+    if (workers == 0) {
+        workers = std::max(1u, std::thread::hardware_concurrency());
+    }
+    for (size_t i = 0; i < workers; ++i) {
+        m_workers.push_back(std::make_unique<WorkerQueue>());
+    }
+    for (size_t i = 1; i < workers; ++i) {
+        m_threads.emplace_back(&WorkerPool::workerLoop, this, i);
+    }
+}
+
+WorkerPool::~WorkerPool() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_wake.notify_all();
+    for (std::thread& thread : m_threads) {
+        thread.join();
+    }
+}
+
+// ============================================================================
+// BATCHES
+// ============================================================================
+
+void WorkerPool::run(size_t count, const Task& task) {
+    if (count == 0) return;
+    std::lock_guard<std::mutex> runLock(m_runMutex);
+
+    m_task = &task;
+    m_remaining.store(count, std::memory_order_relaxed);
+
+    // Seed contiguous ranges: without stealing, each worker keeps the same
+    // sessions from tick to tick
+    size_t workers = m_workers.size();
+    for (size_t w = 0; w < workers; ++w) {
+        WorkerQueue& queue = *m_workers[w];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        for (size_t i = w * count / workers; i < (w + 1) * count / workers; ++i) {
+            queue.tasks.push_back(i);
+        }
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        ++m_generation;
+    }
+    m_wake.notify_all();
+
+    // The caller is worker 0, then waits for tasks still running elsewhere
+    drain(0);
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_done.wait(lock, [this] { return m_remaining.load(std::memory_order_acquire) == 0; });
+    }
+
+    m_batches.fetch_add(1, std::memory_order_relaxed);
+    m_tasks.fetch_add(count, std::memory_order_relaxed);
+}
+
+void WorkerPool::workerLoop(size_t self) {
+    uint64_t seen = 0;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_wake.wait(lock, [&] { return m_stop || m_generation != seen; });
+            if (m_stop) return;
+            seen = m_generation;
+        }
+        drain(self);
+    }
+}
+
+void WorkerPool::drain(size_t self) {
+    size_t index;
+    bool stolen;
+    while (takeTask(self, index, stolen)) {
+        (*m_task)(index);
+        if (stolen) {
+            m_steals.fetch_add(1, std::memory_order_relaxed);
+        }
+        if (m_remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_done.notify_all();
+        }
+    }
+}
+
+bool WorkerPool::takeTask(size_t self, size_t& index, bool& stolen) {
+    // Own work first, oldest first
+    {
+        WorkerQueue& own = *m_workers[self];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.tasks.empty()) {
+            index = own.tasks.front();
+            own.tasks.pop_front();
+            stolen = false;
+            return true;
+        }
+    }
+
+    // Then steal from the far end of another worker's deque
+    size_t workers = m_workers.size();
+    for (size_t k = 1; k < workers; ++k) {
+        WorkerQueue& victim = *m_workers[(self + k) % workers];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.tasks.empty()) {
+            index = victim.tasks.back();
+            victim.tasks.pop_back();
+            stolen = true;
+            return true;
+        }
+    }
+    return false;
+}
+
+// ============================================================================
+// STATISTICS
+// ============================================================================
+
+WorkerPoolStats WorkerPool::getStats() const {
+    WorkerPoolStats stats;
+    stats.batches = m_batches.load(std::memory_order_relaxed);
+    stats.tasks = m_tasks.load(std::memory_order_relaxed);
+    stats.steals = m_steals.load(std::memory_order_relaxed);
+    return stats;
+}
+
+} // namespace orderbook
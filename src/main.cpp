@@ -12,13 +12,17 @@
 #include "Order.h"
 #include "OrderBook.h"
 #include "MatchingEngine.h"
-#include "OrderQueue.h"
+#include "SpscOrderQueue.h"
 #include "Visualizer.h"
 #include "MarketSentiment.h"
 #include "NewsShock.h"
 #include "PriceEngine.h"
 #include "CandleManager.h"
 #include "SessionState.h"
+#include "BinaryEncoder.h"
+#include "WorkerPool.h"
+#include "TickDeadline.h"
+#include "TickScheduler.h"
 
 #ifdef WEBSOCKET_ENABLED
 #include "WebSocketServer.h"
@@ -57,6 +61,10 @@ struct SimulationConfig {
     bool waitForWebSocket = false;  // Wait for WebSocket start command
     bool headless = false;          // No terminal visualization, just logs
     bool debug = false;             // Enable verbose debug logging
+    uint32_t slowClientTicks = 100; // Disconnect clients this many ticks behind (0 = never)
+    int wsThreads = 1;              // libwebsockets service threads
+    int tickWorkers = 0;            // Session stepping threads (0 = one per core)
+    uint64_t seed = 0;              // Base RNG seed (0 = random per run)
     
     // Validate and clamp values
     void validate() {
@@ -64,8 +72,8 @@ struct SimulationConfig {
         spread = std::max(0.05, std::min(0.25, spread));
         speedMultiplier = std::max(0.25, std::min(2.0, speedMultiplier));
         // Round to tick size
-        basePrice = std::round(basePrice / 0.05) * 0.05;
-        spread = std::round(spread / 0.05) * 0.05;
+        basePrice = Price(basePrice).roundToTick(DEFAULT_TICK_SIZE).toDouble();
+        spread = Price(spread).roundToTick(DEFAULT_TICK_SIZE).toDouble();
     }
 };
 
@@ -84,9 +92,6 @@ SimulationConfig g_config;
 // News Shock controller
 orderbook::NewsShockController g_newsShockController;
 
-// Price engine (for trend/pullback logic like Node.js)
-orderbook::PriceEngine g_priceEngine;
-
 // Candle manager (for multi-timeframe aggregation like Node.js)
 orderbook::CandleManager g_candleManager;
 
@@ -95,6 +100,12 @@ orderbook::CandleManager g_candleManager;
 WebSocketServer* g_wsServer = nullptr;
 #endif
 
+// Steps the sessions each tick
+WorkerPool* g_tickPool = nullptr;
+
+// When each session's next tick is due
+TickScheduler* g_tickScheduler = nullptr;
+
 // Price tracking for stats
 std::atomic<double> g_openPrice{100.0};
 std::atomic<double> g_highPrice{100.0};
@@ -221,7 +232,7 @@ void closePriceLog() {
 SentimentOrderGenerator* g_generator = nullptr;
 std::mutex g_generatorMutex;
 
-void orderGenerator(OrderQueue& queue, std::atomic<OrderId>& nextOrderId,
+void orderGenerator(SpscOrderQueue& queue, std::atomic<OrderId>& nextOrderId,
                     const OrderBook& orderBook) {
     
     while (g_running) {
@@ -235,10 +246,11 @@ void orderGenerator(OrderQueue& queue, std::atomic<OrderId>& nextOrderId,
         {
             std::lock_guard<std::mutex> lock(g_generatorMutex);
             if (g_generator) {
-                auto bestBid = orderBook.getBestBid();
-                auto bestAsk = orderBook.getBestAsk();
-                if (bestBid && bestAsk) {
-                    g_generator->updateFromOrderBook(*bestBid, *bestAsk);
+                // Lock-free read of the published top of book
+                TopOfBook top = orderBook.getTopOfBook();
+                if (top.hasBid() && top.hasAsk()) {
+                    g_generator->updateFromOrderBook(top.bestBid.toDouble(),
+                                                     top.bestAsk.toDouble());
                 }
             }
         }
@@ -279,7 +291,7 @@ void orderGenerator(OrderQueue& queue, std::atomic<OrderId>& nextOrderId,
 // ============================================================================
 // Processes orders and feeds trade executions back to the generator
 
-void orderProcessor(OrderQueue& queue, MatchingEngine& engine, 
+void orderProcessor(SpscOrderQueue& queue, MatchingEngine& engine, 
                     Visualizer& visualizer, std::atomic<size_t>& processedCount,
                     std::atomic<size_t>& marketOrderCount,
                     std::atomic<size_t>& limitOrderCount,
@@ -287,54 +299,61 @@ void orderProcessor(OrderQueue& queue, MatchingEngine& engine,
     
     int tradeCounter = 0;
     
+    // Reused for every batch so the steady-state loop does not allocate
+    constexpr size_t MAX_BATCH = 64;
+    std::vector<Order> batch;
+    std::vector<Trade> trades;
+    batch.reserve(MAX_BATCH);
+    trades.reserve(MAX_BATCH * 4);
+    
     while (g_running) {
-        auto orderOpt = queue.popWithTimeout(100);
+        // Drain whatever has queued up (at least one order, or a timeout)
+        if (queue.popBatch(batch, MAX_BATCH, 100) == 0) {
+            continue;
+        }
         
-        if (orderOpt) {
-            Order& order = *orderOpt;
-            
-            // Track order types
+        // Track order types
+        for (const Order& order : batch) {
             if (order.getType() == OrderType::MARKET) {
                 marketOrderCount++;
             } else {
                 limitOrderCount++;
             }
+        }
+        
+        // Match the whole batch under one book lock, then handle each
+        // trade: update the generator's price and log
+        engine.processBatch(batch, trades, [&](const Order& order, const Trade& trade) {
+            // Record trade for visualization
+            visualizer.addTrade(trade.price, trade.quantity, order.getSide());
             
-            // Process the order through the matching engine
-            auto trades = engine.processOrder(order);
+            // Update price tracking (the generator and stats work in doubles)
+            double tradePrice = trade.price.toDouble();
+            g_currentPrice = tradePrice;
+            double high = g_highPrice.load();
+            while (tradePrice > high && !g_highPrice.compare_exchange_weak(high, tradePrice)) {}
+            double low = g_lowPrice.load();
+            while (tradePrice < low && !g_lowPrice.compare_exchange_weak(low, tradePrice)) {}
             
-            // For each trade, update the generator's price and log
-            for (const auto& trade : trades) {
-                // Record trade for visualization
-                visualizer.addTrade(trade.price, trade.quantity, order.getSide());
-                
-                // Update price tracking
-                g_currentPrice = trade.price;
-                double high = g_highPrice.load();
-                while (trade.price > high && !g_highPrice.compare_exchange_weak(high, trade.price)) {}
-                double low = g_lowPrice.load();
-                while (trade.price < low && !g_lowPrice.compare_exchange_weak(low, trade.price)) {}
-                
-                // CRITICAL: Feed trade back to generator - this drives price movement!
-                {
-                    std::lock_guard<std::mutex> lock(g_generatorMutex);
-                    if (g_generator) {
-                        g_generator->onTradeExecuted(trade.price, order.getSide());
-                    }
-                }
-                
-                // NOTE: Trades are now sent per-session in displayUpdater, not broadcast
-                // Each session generates its own trades based on its own price
-
-                // Log every 10th trade to avoid huge file
-                tradeCounter++;
-                if (tradeCounter % 10 == 0) {
-                    logPrice(trade.price, "TRADE");
+            // CRITICAL: Feed trade back to generator - this drives price movement!
+            {
+                std::lock_guard<std::mutex> lock(g_generatorMutex);
+                if (g_generator) {
+                    g_generator->onTradeExecuted(tradePrice, order.getSide());
                 }
             }
             
-            processedCount++;
-        }
+            // NOTE: Trades are now sent per-session in displayUpdater, not broadcast
+            // Each session generates its own trades based on its own price
+
+            // Log every 10th trade to avoid huge file
+            tradeCounter++;
+            if (tradeCounter % 10 == 0) {
+                logPrice(tradePrice, "TRADE");
+            }
+        });
+        
+        processedCount += batch.size();
     }
 }
 
@@ -465,6 +484,350 @@ void keyboardHandler() {
 #endif
 }
 
+// ============================================================================
+// SESSION COMMANDS
+// ============================================================================
+// Commands are posted to the session's mailbox by the WebSocket thread and
+// applied here, on the tick worker that owns the session, right before it
+// is stepped.
+
+#ifdef WEBSOCKET_ENABLED
+void applySessionCommand(uint32_t clientId, SessionState* session, const SessionCommand& command) {
+    const std::string& type = command.type;
+    const std::string& value = command.value;
+    
+    if (type == "sentiment") {
+        Sentiment s = MarketSentimentController::parseSentiment(value);
+        session->setSentiment(s);
+        std::cout << "[Session " << clientId << "] [SET] Sentiment -> " << value << std::endl;
+    } else if (type == "intensity") {
+        Intensity i = MarketSentimentController::parseIntensity(value);
+        session->setIntensity(i);
+        std::cout << "[Session " << clientId << "] [SET] Intensity -> " << value << std::endl;
+    } else if (type == "spread") {
+        try {
+            double spread = std::stod(value);
+            session->setSpread(spread);
+            std::cout << "[Session " << clientId << "] [SET] Spread -> $" << std::fixed << std::setprecision(2) << spread << std::endl;
+        } catch (...) {}
+    } else if (type == "speed") {
+        try {
+            double speed = std::stod(value);
+            session->setSpeed(speed);
+            std::cout << "[Session " << clientId << "] [SET] Speed -> " << speed << "x" << std::endl;
+        } catch (...) {}
+    } else if (type == "pause") {
+        session->setPaused(value == "true" || value == "1");
+        std::cout << "[Session " << clientId << "] [STATE] " << (session->isPaused() ? "PAUSED" : "RESUMED") << std::endl;
+    } else if (type == "newsShock") {
+        // News Shock toggle
+        if (value == "true") {
+            if (session->getNewsShockController().enable()) {
+                std::cout << "[Session " << clientId << "] [STATE] News Shock ENABLED (5s)\n";
+            } else {
+                std::cout << "[Session " << clientId << "] [WARN] News Shock in cooldown\n";
+            }
+        } else {
+            session->getNewsShockController().disable();
+            std::cout << "[Session " << clientId << "] [STATE] News Shock DISABLED\n";
+        }
+    } else if (type == "reset") {
+        session->reset();
+        std::cout << "[Session " << clientId << "] [INFO] Simulation RESET\n";
+        // Send reset confirmation to clear frontend state
+        g_wsServer->sendToClient(clientId, R"({"type":"simulationReset"})");
+        g_wsServer->sendToClient(clientId, R"({"type":"candleReset"})");
+    } else if (type == "symbol") {
+        std::string symbol = value;
+        for (char& c : symbol) c = std::toupper(c);
+        session->setSymbol(symbol);
+        std::cout << "[Session " << clientId << "] [SET] Symbol -> " << symbol << std::endl;
+    } else if (type == "price") {
+        try {
+            SessionConfig config = session->getConfig();
+            config.basePrice = std::stod(value);
+            config.validate();
+            session->setConfig(config);
+            session->reset(); // Reset with new base price
+            std::cout << "[Session " << clientId << "] [SET] Base Price -> $" << std::fixed << std::setprecision(2) << config.basePrice << std::endl;
+            // Send reset confirmation to clear frontend state
+            g_wsServer->sendToClient(clientId, R"({"type":"simulationReset"})");
+            g_wsServer->sendToClient(clientId, R"({"type":"candleReset"})");
+        } catch (...) {}
+    } else if (type == "getCandles") {
+        // Handle getCandles request - send cached candles for this session's timeframe
+        try {
+            int timeframe = std::stoi(value);
+            const auto& candles = session->getCandleManager().getCachedCandles(timeframe);
+            const auto* current = session->getCandleManager().getCurrentCandle(timeframe);
+            if (session->getWireFormat() == WireFormat::BINARY) {
+                g_wsServer->sendBinaryToClient(clientId, BinaryEncoder::candleHistory(timeframe, candles, current));
+            } else {
+                std::string response = JsonBuilder::candleHistoryToJson(timeframe, candles, current);
+                g_wsServer->sendToClient(clientId, response);
+            }
+            std::cout << "[Session " << clientId << "] [INFO] Sent " << candles.size() << " candles (" << timeframe << "s)\n";
+        } catch (...) {
+            std::cout << "[Session " << clientId << "] [ERROR] Invalid timeframe in getCandles\n";
+        }
+    } else if (type == "start") {
+        session->setRunning(true);
+        std::cout << "[Session " << clientId << "] [INFO] Simulation STARTED\n";
+        // Send confirmation to client
+        g_wsServer->sendToClient(clientId, R"({"type":"started"})");
+    } else if (type == "encoding") {
+        // "binary": tick/candleHistory as binary frames; "json": text (default)
+        session->setWireFormat(value == "binary" ? WireFormat::BINARY : WireFormat::JSON);
+        std::cout << "[Session " << clientId << "] [SET] Encoding -> "
+                  << (value == "binary" ? "BINARY" : "JSON") << std::endl;
+    } else if (type == "bookMode") {
+        // "delta": snapshot + sequenced level changes; "full": levels every tick
+        session->setBookFeedMode(value == "delta" ? BookFeedMode::DELTA : BookFeedMode::FULL);
+        std::cout << "[Session " << clientId << "] [SET] Book feed -> "
+                  << (value == "delta" ? "DELTA" : "FULL") << std::endl;
+    } else if (type == "bookResync") {
+        // Client saw a sequence gap or checksum mismatch
+        session->requestBookResync();
+        if (g_debug) {
+            std::cout << "[Session " << clientId << "] [DEBUG] Book resync requested\n";
+        }
+    } else if (type == "stats") {
+        // Print stats for this session
+        std::cout << "[Session " << clientId << "] [STATS] " << g_wsServer->getSessionStatsString(clientId) << "\n";
+    }
+}
+#endif
+
+// ============================================================================
+// SESSION STEP (one session, one tick)
+// ============================================================================
+// Runs on a tick worker. Sessions are independent, and the pool gives each
+// one to a single worker per tick; shared state here is limited to
+// logPrice (locked) and the server's send path. Randomness comes from the
+// session's own generator.
+
+// Base interval = 100ms, effective interval = 100ms / speed
+// At 2x speed a session ticks every 50ms; at 0.5x, every 200ms
+TickScheduler::Clock::duration sessionTickInterval(double speed) {
+    return std::chrono::duration_cast<TickScheduler::Clock::duration>(
+        std::chrono::duration<double, std::milli>(100.0 / speed));
+}
+
+#ifdef WEBSOCKET_ENABLED
+// Returns false if the session is not running (nothing to schedule)
+bool stepSession(const WebSocketServer::ClientHandle& client, int64_t timestamp) {
+    uint32_t clientId = client->id;
+    SessionState* session = client->session.get();
+    
+    // Commands received since the last tick; they may change the speed
+    size_t applied = session->drainCommands([&](const SessionCommand& command) {
+        applySessionCommand(clientId, session, command);
+    });
+    if (applied > 0) {
+        g_tickScheduler->setInterval(clientId, sessionTickInterval(session->getSpeed()));
+    }
+    if (!session->isRunning()) return false;
+    
+    // Get session-specific values
+    double sessionSpread = session->getSpread();
+    double sessionSpeed = session->getSpeed();
+    Sentiment sessionSentiment = session->getSentiment();
+    Intensity sessionIntensity = session->getIntensity();
+    bool isPaused = session->isPaused();
+    
+    // The scheduler only hands out sessions whose tick is due
+    session->setLastUpdateTime(timestamp);
+    
+    // Wire names for the stats (static strings, no allocation)
+    const char* sentimentStr = MarketSentimentController::getSentimentNameSimple(sessionSentiment);
+    const char* intensityStr = MarketSentimentController::getIntensityNameSimple(sessionIntensity);
+    
+    double sessionPrice = session->getCurrentPrice();
+    int tickVolume = 0;
+    std::vector<orderbook::CompletedCandle> completedCandles;
+    TradeData* tradePtr = nullptr;  // No trade by default (or when paused)
+    TradeData tradeData;
+    
+    // Only update simulation state if NOT paused
+    if (!isPaused) {
+        // Check session's news shock
+        session->getNewsShockController().checkExpiration();
+        
+        // Generate price using session's price engine
+        PriceEngine& priceEngine = session->getPriceEngine();
+        double currentPrice = session->getCurrentPrice();
+        bool newsShockEnabled = session->getNewsShockController().isEnabled();
+        auto priceResult = priceEngine.calculateNextPrice(
+            currentPrice,
+            sessionSentiment,
+            sessionIntensity,
+            newsShockEnabled
+        );
+        
+        // Log significant price changes (debug mode only)
+        if (g_debug) {
+            double priceChange = priceResult.newPrice - currentPrice;
+            double pctChange = (priceChange / currentPrice) * 100.0;
+            if (std::abs(pctChange) > 0.5) {  // Log moves > 0.5%
+                std::cout << "[Price] Session " << clientId 
+                          << " " << sentimentStr << "/" << intensityStr
+                          << " NewsShock=" << (newsShockEnabled ? "ON" : "OFF")
+                          << " $" << std::fixed << std::setprecision(2) << currentPrice 
+                          << " -> $" << priceResult.newPrice 
+                          << " (" << (priceChange >= 0 ? "+" : "") << std::setprecision(2) << pctChange << "%)";
+                if (priceResult.shockApplied) {
+                    std::cout << " [SHOCK: " << priceResult.shockType << "]";
+                }
+                std::cout << "\n";
+            }
+        }
+        
+        session->setCurrentPrice(priceResult.newPrice);
+        sessionPrice = session->getCurrentPrice();
+        
+        // Generate tick volume and simulate trading activity
+        FastRng& rng = session->getRng();
+        tickVolume = 10 + static_cast<int>(rng.nextBelow(40));
+        session->addVolume(tickVolume);
+        session->addOrders(1 + rng.nextBelow(3));
+        
+        // Simulate trades (roughly 1 trade per 2-3 ticks)
+        if (rng.nextBelow(3) == 0) {
+            tradeData = session->generateTrade(sessionPrice, timestamp);
+            tradePtr = &tradeData;
+            
+            // Log every 10th trade per session to prices.txt
+            if (session->getTradeSequence() % 10 == 0) {
+                logPrice(tradeData.price.toDouble(), "TRADE");
+            }
+            
+            if (g_debug) {
+                std::cout << "[Trade] Session " << clientId << " Price: $" << std::fixed << std::setprecision(2) 
+                          << sessionPrice << " -> Trade: $" << tradeData.price << " (" << tradeData.side << ")\n";
+            }
+        }
+        
+        // Simulate market/limit order ratio (~20% market, 80% limit)
+        if (rng.nextBelow(5) == 0) {
+            session->addMarketOrder();
+        } else {
+            session->addLimitOrder();
+        }
+        
+        // Update candles for this session
+        CandleManager& candleManager = session->getCandleManager();
+        completedCandles = candleManager.updateCandles(sessionPrice, tickVolume, timestamp);
+        
+        // Refresh the order book in place only when NOT paused
+        session->getOrderGenerator().refreshOrderBook(session->getOrderBook(), sessionPrice, sessionSpread);
+    }
+    
+    // Always get current order book and candles (to show frozen state when paused)
+    OrderBook& sessionOrderBook = session->getOrderBook();
+    auto currentCandles = session->getCandleManager().getCurrentCandles();
+    
+    // Stats for this session
+    SessionStats stats;
+    stats.symbol = session->getSymbol();
+    stats.currentPrice = sessionPrice;
+    stats.openPrice = session->getOpenPrice();
+    stats.highPrice = session->getHighPrice();
+    stats.lowPrice = session->getLowPrice();
+    stats.totalOrders = session->getTotalOrders();
+    stats.totalTrades = session->getTotalTrades();
+    stats.totalVolume = session->getTotalVolume();
+    stats.marketOrderPct = session->getMarketOrderPct();
+    stats.sentiment = sentimentStr;
+    stats.intensity = intensityStr;
+    stats.spread = sessionSpread;
+    stats.speed = sessionSpeed;
+    stats.paused = session->isPaused();
+    stats.newsShockEnabled = session->getNewsShockController().isEnabled();
+    stats.newsShockCooldown = session->getNewsShockController().isInCooldown();
+    stats.newsShockCooldownRemaining = session->getNewsShockController().getCooldownRemaining();
+    stats.newsShockActiveRemaining = session->getNewsShockController().getActiveRemaining();
+    
+    // DELTA-mode clients get level changes instead of the levels
+    BookFrame bookFrame;
+    bool deltaFeed = session->nextBookFrame(bookFrame);
+    
+    // Build and send batched tick message to THIS client only,
+    // in the encoding it asked for, straight into the session's
+    // recycled frame
+    bool binary = session->getWireFormat() == WireFormat::BINARY;
+    FrameRef tickFrame = session->acquireTickFrame(binary);
+    if (binary) {
+        BinaryEncoder::tick(
+            tickFrame->buffer(),
+            sessionOrderBook,
+            stats,
+            sessionPrice,
+            tickVolume,
+            timestamp,
+            tradePtr,
+            currentCandles,
+            completedCandles,
+            deltaFeed ? &bookFrame : nullptr
+        );
+    } else {
+        JsonBuilder::tickToJson(
+            tickFrame->buffer(),
+            sessionOrderBook,
+            stats,
+            sessionPrice,
+            tickVolume,
+            timestamp,
+            tradePtr,  // Pass trade pointer (nullptr when paused)
+            currentCandles,
+            completedCandles,
+            deltaFeed ? &bookFrame : nullptr
+        );
+    }
+    // A tick still queued is replaced by this one, unless it
+    // completes a candle the chart must not miss
+    g_wsServer->sendFrame(client, std::move(tickFrame),
+                          completedCandles.empty() ? FrameDelivery::CONFLATE
+                                                   : FrameDelivery::ALWAYS);
+    return true;
+}
+
+// Step the sessions whose tick is due, on the tick workers, and schedule
+// their next ticks
+void stepDueSessions(const std::vector<TickScheduler::Due>& due, TickDeadline& tickDeadline) {
+    struct Slot {
+        WebSocketServer::ClientHandle client;  // Keeps the session alive if it disconnects
+        TickScheduler::Clock::time_point started;
+        bool running = false;
+    };
+    std::vector<Slot> slots(due.size());
+    for (size_t i = 0; i < due.size(); ++i) {
+        // The handle given to add(): no registry lookup per tick
+        slots[i].client = std::static_pointer_cast<WebSocketServer::ClientData>(due[i].context);
+    }
+    
+    auto now = std::chrono::system_clock::now();
+    int64_t timestamp = std::chrono::duration_cast<std::chrono::milliseconds>(
+        now.time_since_epoch()).count();
+    
+    auto tickStart = std::chrono::steady_clock::now();
+    g_tickPool->run(slots.size(), [&](size_t i) {
+        Slot& slot = slots[i];
+        if (!slot.client || !WebSocketServer::isConnected(slot.client)) return;  // Disconnected
+        slot.started = TickScheduler::Clock::now();
+        slot.running = stepSession(slot.client, timestamp);
+    });
+    tickDeadline.record(std::chrono::steady_clock::now() - tickStart, slots.size());
+    
+    for (size_t i = 0; i < due.size(); ++i) {
+        if (slots[i].running) {
+            g_tickScheduler->complete(due[i], slots[i].started);
+        } else {
+            g_tickScheduler->remove(due[i].id);
+        }
+    }
+}
+#endif
+
 // ============================================================================
 // DISPLAY UPDATER (Visualization Thread)
 // ============================================================================
@@ -475,7 +838,33 @@ void displayUpdater(Visualizer& visualizer, std::atomic<size_t>& processedCount,
                     std::atomic<size_t>& marketOrderCount,
                     std::atomic<size_t>& limitOrderCount,
                     OrderBook& /*orderBook*/) {
+    // Tick latency against the 50ms tick, reported every 30 seconds
+    TickDeadline tickDeadline(std::chrono::milliseconds(50));
+    auto lastDeadlineReport = std::chrono::steady_clock::now();
+    
+    // Sessions tick on their own deadlines; the screen and the global
+    // housekeeping below refresh on a fixed interval
+    const auto refreshInterval = std::chrono::milliseconds(g_config.headless ? 250 : 50);
+    auto nextRefresh = std::chrono::steady_clock::now();
+    std::vector<TickScheduler::Due> due;
+    
     while (g_running) {
+        // Sleep until the earliest session tick or the next refresh
+        due.clear();
+        g_tickScheduler->waitDue(nextRefresh, due);
+        
+        // Step the due sessions - EACH SESSION GETS ITS OWN DATA
+        #ifdef WEBSOCKET_ENABLED
+        if (g_wsServer && !due.empty()) {
+            stepDueSessions(due, tickDeadline);
+        }
+        #endif
+        
+        if (std::chrono::steady_clock::now() < nextRefresh) {
+            continue;
+        }
+        nextRefresh = std::chrono::steady_clock::now() + refreshInterval;
+        
         // Only render terminal UI if not headless
         if (!g_config.headless) {
             visualizer.render(10);  // Show top 10 levels
@@ -508,164 +897,40 @@ void displayUpdater(Visualizer& visualizer, std::atomic<size_t>& processedCount,
         // Check news shock expiration
         g_newsShockController.checkExpiration();
         
-        // Broadcast to WebSocket clients - EACH SESSION GETS ITS OWN DATA
-        #ifdef WEBSOCKET_ENABLED
-        if (g_wsServer && g_wsServer->getConnectionCount() > 0) {
-            // Get timestamp
-            auto now = std::chrono::system_clock::now();
-            int64_t timestamp = std::chrono::duration_cast<std::chrono::milliseconds>(
-                now.time_since_epoch()).count();
+        if (std::chrono::steady_clock::now() - lastDeadlineReport > std::chrono::seconds(30)) {
+            lastDeadlineReport = std::chrono::steady_clock::now();
+            TickDeadlineStats window = tickDeadline.window();
+            if (window.ticks > 0) {
+                WorkerPoolStats pool = g_tickPool->getStats();
+                std::cout << "[Tick] Max due: " << window.maxSessions
+                          << " | Avg: " << std::fixed << std::setprecision(2) << window.avgMs << "ms"
+                          << " | Max: " << window.maxMs << "ms"
+                          << " | Over " << tickDeadline.budget().count() << "ms: "
+                          << window.overruns << "/" << window.ticks
+                          << " | Workers: " << g_tickPool->size() << " (steals: " << pool.steals << ")\n";
+            }
+            tickDeadline.reset();
             
-            // Process each session independently
-            auto clientIds = g_wsServer->getClientIds();
-            for (uint32_t clientId : clientIds) {
-                SessionState* session = g_wsServer->getSession(clientId);
-                if (!session || !session->isRunning()) continue;
-                
-                // Get session-specific values
-                double sessionSpread = session->getSpread();
-                double sessionSpeed = session->getSpeed();
-                Sentiment sessionSentiment = session->getSentiment();
-                Intensity sessionIntensity = session->getIntensity();
-                bool isPaused = session->isPaused();
-                
-                // Per-session timing: check if enough time has passed based on speed
-                // Base interval = 100ms, effective interval = 100ms / speed
-                // At 2x speed, we update every 50ms; at 0.5x, every 200ms
-                int64_t effectiveInterval = static_cast<int64_t>(100.0 / sessionSpeed);
-                int64_t lastUpdate = session->getLastUpdateTime();
-                if (lastUpdate > 0 && (timestamp - lastUpdate) < effectiveInterval) {
-                    continue;  // Skip this session, not time to update yet
-                }
-                session->setLastUpdateTime(timestamp);
-                
-                // Get sentiment/intensity strings for price engine
-                std::string sentimentStr = MarketSentimentController::getSentimentNameSimple(sessionSentiment);
-                std::string intensityStr = MarketSentimentController::getIntensityNameSimple(sessionIntensity);
-                
-                double sessionPrice = session->getCurrentPrice();
-                int tickVolume = 0;
-                std::vector<orderbook::CompletedCandle> completedCandles;
-                TradeData* tradePtr = nullptr;  // No trade by default (or when paused)
-                TradeData tradeData;
-                
-                // Only update simulation state if NOT paused
-                if (!isPaused) {
-                    // Check session's news shock
-                    session->getNewsShockController().checkExpiration();
-                    
-                    // Generate price using session's price engine
-                    PriceEngine& priceEngine = session->getPriceEngine();
-                    double currentPrice = session->getCurrentPrice();
-                    bool newsShockEnabled = session->getNewsShockController().isEnabled();
-                    auto priceResult = priceEngine.calculateNextPrice(
-                        currentPrice,
-                        sentimentStr,
-                        intensityStr,
-                        newsShockEnabled
-                    );
-                    
-                    // Log significant price changes (debug mode only)
-                    if (g_debug) {
-                        double priceChange = priceResult.newPrice - currentPrice;
-                        double pctChange = (priceChange / currentPrice) * 100.0;
-                        if (std::abs(pctChange) > 0.5) {  // Log moves > 0.5%
-                            std::cout << "[Price] Session " << clientId 
-                                      << " " << sentimentStr << "/" << intensityStr
-                                      << " NewsShock=" << (newsShockEnabled ? "ON" : "OFF")
-                                      << " $" << std::fixed << std::setprecision(2) << currentPrice 
-                                      << " -> $" << priceResult.newPrice 
-                                      << " (" << (priceChange >= 0 ? "+" : "") << std::setprecision(2) << pctChange << "%)";
-                            if (priceResult.shockApplied) {
-                                std::cout << " [SHOCK: " << priceResult.shockType << "]";
-                            }
-                            std::cout << "\n";
-                        }
+            // How late sessions ticked against their own deadlines
+            TickSchedulerStats sched = g_tickScheduler->window();
+            if (sched.steps > 0) {
+                std::cout << "[Sched] Sessions: " << sched.sessions
+                          << " | Drift avg/max: " << std::fixed << std::setprecision(2)
+                          << sched.avgDriftMs << "/" << sched.maxDriftMs << "ms"
+                          << " | Jitter avg/max: " << sched.avgJitterMs << "/" << sched.maxJitterMs << "ms"
+                          << " | Skipped: " << sched.skipped
+                          << " | Worst: session " << sched.worstSession << "\n";
+                if (g_debug) {
+                    for (const SessionTiming& timing : g_tickScheduler->sessionTimings()) {
+                        std::cout << "[Sched] Session " << timing.id
+                                  << " | Ticks: " << timing.steps
+                                  << " | Drift avg/max: " << timing.avgDriftMs << "/" << timing.maxDriftMs << "ms"
+                                  << " | Jitter avg/max: " << timing.avgJitterMs << "/" << timing.maxJitterMs << "ms\n";
                     }
-                    
-                    session->setCurrentPrice(priceResult.newPrice);
-                    sessionPrice = session->getCurrentPrice();
-                    
-                    // Generate tick volume and simulate trading activity
-                    tickVolume = 10 + (rand() % 40);
-                    session->addVolume(tickVolume);
-                    session->addOrders(1 + rand() % 3);
-                    
-                    // Simulate trades (roughly 1 trade per 2-3 ticks)
-                    if (rand() % 3 == 0) {
-                        tradeData = session->generateTrade(sessionPrice, timestamp);
-                        tradePtr = &tradeData;
-                        
-                        // Log every 10th trade per session to prices.txt
-                        static std::map<uint32_t, int> sessionTradeCounters;
-                        sessionTradeCounters[clientId]++;
-                        if (sessionTradeCounters[clientId] % 10 == 0) {
-                            logPrice(tradeData.price, "TRADE");
-                        }
-                        
-                        if (g_debug) {
-                            std::cout << "[Trade] Session " << clientId << " Price: $" << std::fixed << std::setprecision(2) 
-                                      << sessionPrice << " -> Trade: $" << tradeData.price << " (" << tradeData.side << ")\n";
-                        }
-                    }
-                    
-                    // Simulate market/limit order ratio (~20% market, 80% limit)
-                    if (rand() % 5 == 0) {
-                        session->addMarketOrder();
-                    } else {
-                        session->addLimitOrder();
-                    }
-                    
-                    // Update candles for this session
-                    CandleManager& candleManager = session->getCandleManager();
-                    completedCandles = candleManager.updateCandles(sessionPrice, tickVolume, timestamp);
-                    
-                    // Regenerate order book only when NOT paused
-                    SentimentOrderGenerator generator(session->getSentimentController());
-                    generator.regenerateOrderBook(session->getOrderBook(), sessionPrice, sessionSpread);
                 }
-                
-                // Always get current order book and candles (to show frozen state when paused)
-                OrderBook& sessionOrderBook = session->getOrderBook();
-                auto currentCandles = session->getCandleManager().getCurrentCandles();
-                
-                // Build stats JSON for this session
-                std::string statsJson = JsonBuilder::statsToJson(
-                    session->getSymbol(),
-                    sessionPrice,
-                    session->getOpenPrice(),
-                    session->getHighPrice(),
-                    session->getLowPrice(),
-                    session->getTotalOrders(),
-                    session->getTotalTrades(),
-                    session->getTotalVolume(),
-                    session->getMarketOrderPct(),
-                    sentimentStr,
-                    intensityStr,
-                    sessionSpread,
-                    sessionSpeed,
-                    session->isPaused(),
-                    session->getNewsShockController().isEnabled(),
-                    session->getNewsShockController().isInCooldown(),
-                    session->getNewsShockController().getCooldownRemaining(),
-                    session->getNewsShockController().getActiveRemaining()
-                );
-                
-                // Build and send batched tick message to THIS client only
-                std::string tickJson = JsonBuilder::tickToJson(
-                    sessionOrderBook,
-                    statsJson,
-                    sessionPrice,
-                    tickVolume,
-                    timestamp,
-                    tradePtr,  // Pass trade pointer (nullptr when paused)
-                    currentCandles,
-                    completedCandles
-                );
-                g_wsServer->sendToClient(clientId, tickJson);
             }
+            g_tickScheduler->resetWindow();
         }
-        #endif
         
         // Only print status line if not headless
         if (!g_config.headless) {
@@ -688,10 +953,6 @@ void displayUpdater(Visualizer& visualizer, std::atomic<size_t>& processedCount,
             std::cout << "  |  " << color << g_sentimentController.getMarketConditionString() << "\033[0m";
             std::cout << "\n  [1-6]=Sentiment [M/N/A/X]=Intensity [+/-]=Spread [P]=Pause [F/S]=Speed [Q]=Quit\n";
         }
-        
-        // 50ms base tick rate - allows per-session speed control up to 2x
-        // Each session tracks its own timing based on speed setting
-        std::this_thread::sleep_for(std::chrono::milliseconds(50));
     }
 }
 
@@ -715,6 +976,10 @@ void printUsage(const char* programName) {
     std::cout << "  -a, --auto-start        Skip 'press any key' prompt\n";
     std::cout << "  -w, --wait-for-ws       Wait for WebSocket start command\n";
     std::cout << "  --headless              No terminal UI, just logs (for WebSocket mode)\n";
+    std::cout << "  --slow-client-ticks <n> Drop WebSocket clients <n> ticks behind (default: 100, 0 = never)\n";
+    std::cout << "  --ws-threads <n>        WebSocket service threads (default: 1)\n";
+    std::cout << "  --tick-workers <n>      Session stepping threads (default: one per core)\n";
+    std::cout << "  --seed <n>              Base random seed, to replay a run (default: random)\n";
     std::cout << "  -d, --debug             Enable verbose debug logging\n";
     std::cout << "  -h, --help              Show this help\n";
     std::cout << "\nSENTIMENTS:\n";
@@ -895,6 +1160,26 @@ bool parseCommandLine(int argc, char* argv[], SimulationConfig& config, bool& in
             config.headless = true;
             config.autoStart = true;  // Implied
         }
+        else if (arg == "--slow-client-ticks" && i + 1 < argc) {
+            try {
+                config.slowClientTicks = static_cast<uint32_t>(std::stoul(argv[++i]));
+            } catch (...) {}
+        }
+        else if (arg == "--ws-threads" && i + 1 < argc) {
+            try {
+                config.wsThreads = std::max(1, std::stoi(argv[++i]));
+            } catch (...) {}
+        }
+        else if (arg == "--tick-workers" && i + 1 < argc) {
+            try {
+                config.tickWorkers = std::max(0, std::stoi(argv[++i]));
+            } catch (...) {}
+        }
+        else if (arg == "--seed" && i + 1 < argc) {
+            try {
+                config.seed = std::stoull(argv[++i]);
+            } catch (...) {}
+        }
         else if (arg == "--debug" || arg == "-d") {
             config.debug = true;
             g_debug = true;
@@ -966,6 +1251,20 @@ int main(int argc, char* argv[]) {
     // Set up signal handler for graceful shutdown
     std::signal(SIGINT, signalHandler);
     
+    // Session stepping pool; the display thread works as one of the workers
+    WorkerPool tickPool(static_cast<size_t>(g_config.tickWorkers));
+    g_tickPool = &tickPool;
+    std::cout << "[Server] Tick workers: " << tickPool.size() << "\n";
+    
+    // Sessions join the schedule when they start
+    TickScheduler tickScheduler;
+    g_tickScheduler = &tickScheduler;
+    
+    // Every random source derives from one logged seed: session N gets
+    // deriveSeed(base, N), the order generator deriveSeed(base, 0)
+    uint64_t baseSeed = g_config.seed ? g_config.seed : FastRng::randomSeed();
+    std::cout << "[Server] RNG seed: " << baseSeed << " (--seed " << baseSeed << " to replay)\n";
+    
     // Start WebSocket server FIRST if waiting for frontend
     #ifdef WEBSOCKET_ENABLED
     // Read PORT from environment (for cloud deployment) or use default 8080
@@ -975,105 +1274,39 @@ int main(int argc, char* argv[]) {
         wsPort = std::atoi(portEnv);
         std::cout << "[Server] Using PORT from environment: " << wsPort << "\n";
     }
-    WebSocketServer wsServer(wsPort);
+    WebSocketServer wsServer(wsPort, g_config.wsThreads);
     g_wsServer = &wsServer;
     
-    // Set up command callback for WebSocket - now handles per-session state
+    OutboundQueueConfig queueConfig;
+    queueConfig.slowConsumerTicks = g_config.slowClientTicks;
+    wsServer.setOutboundQueueConfig(queueConfig);
+    wsServer.setSessionSeed(baseSeed);
+    
+    // Set up command callback for WebSocket. Session state belongs to the
+    // tick, so commands are only queued here (see applySessionCommand)
     wsServer.setCommandCallback([&](uint32_t clientId, const std::string& type, const std::string& value) {
         // Get the session for this client
-        SessionState* session = wsServer.getSession(clientId);
-        if (!session) {
+        WebSocketServer::ClientHandle client = wsServer.findClient(clientId);
+        if (!client) {
             std::cout << "[Session " << clientId << "] [WARN] No session found\n";
             return;
         }
         
-        // Don't log ping commands (too noisy)
-        if (type != "ping") {
-            std::cout << "[Session " << clientId << "] [COMMAND] " << type << "=" << value << std::endl;
+        if (type == "ping") {
+            // Respond immediately with pong for latency measurement
+            // (not logged, too noisy)
+            g_wsServer->sendToClient(clientId, R"({"type":"pong","timestamp":)" + value + "}");
+            return;
         }
         
-        if (type == "sentiment") {
-            Sentiment s = MarketSentimentController::parseSentiment(value);
-            session->setSentiment(s);
-            std::cout << "[Session " << clientId << "] [SET] Sentiment -> " << value << std::endl;
-        } else if (type == "intensity") {
-            Intensity i = MarketSentimentController::parseIntensity(value);
-            session->setIntensity(i);
-            std::cout << "[Session " << clientId << "] [SET] Intensity -> " << value << std::endl;
-        } else if (type == "spread") {
-            try {
-                double spread = std::stod(value);
-                session->setSpread(spread);
-                std::cout << "[Session " << clientId << "] [SET] Spread -> $" << std::fixed << std::setprecision(2) << spread << std::endl;
-            } catch (...) {}
-        } else if (type == "speed") {
-            try {
-                double speed = std::stod(value);
-                session->setSpeed(speed);
-                std::cout << "[Session " << clientId << "] [SET] Speed -> " << speed << "x" << std::endl;
-            } catch (...) {}
-        } else if (type == "pause") {
-            session->setPaused(value == "true" || value == "1");
-            std::cout << "[Session " << clientId << "] [STATE] " << (session->isPaused() ? "PAUSED" : "RESUMED") << std::endl;
-        } else if (type == "newsShock") {
-            // News Shock toggle
-            if (value == "true") {
-                if (session->getNewsShockController().enable()) {
-                    std::cout << "[Session " << clientId << "] [STATE] News Shock ENABLED (5s)\n";
-                } else {
-                    std::cout << "[Session " << clientId << "] [WARN] News Shock in cooldown\n";
-                }
-            } else {
-                session->getNewsShockController().disable();
-                std::cout << "[Session " << clientId << "] [STATE] News Shock DISABLED\n";
-            }
-        } else if (type == "reset") {
-            session->reset();
-            std::cout << "[Session " << clientId << "] [INFO] Simulation RESET\n";
-            // Send reset confirmation to clear frontend state
-            g_wsServer->sendToClient(clientId, R"({"type":"simulationReset"})");
-            g_wsServer->sendToClient(clientId, R"({"type":"candleReset"})");
-        } else if (type == "symbol") {
-            std::string symbol = value;
-            for (char& c : symbol) c = std::toupper(c);
-            session->setSymbol(symbol);
-            std::cout << "[Session " << clientId << "] [SET] Symbol -> " << symbol << std::endl;
-        } else if (type == "price") {
-            try {
-                SessionConfig config = session->getConfig();
-                config.basePrice = std::stod(value);
-                config.validate();
-                session->setConfig(config);
-                session->reset(); // Reset with new base price
-                std::cout << "[Session " << clientId << "] [SET] Base Price -> $" << std::fixed << std::setprecision(2) << config.basePrice << std::endl;
-                // Send reset confirmation to clear frontend state
-                g_wsServer->sendToClient(clientId, R"({"type":"simulationReset"})");
-                g_wsServer->sendToClient(clientId, R"({"type":"candleReset"})");
-            } catch (...) {}
-        } else if (type == "getCandles") {
-            // Handle getCandles request - send cached candles for this session's timeframe
-            try {
-                int timeframe = std::stoi(value);
-                const auto& candles = session->getCandleManager().getCachedCandles(timeframe);
-                const auto* current = session->getCandleManager().getCurrentCandle(timeframe);
-                std::string response = JsonBuilder::candleHistoryToJson(timeframe, candles, current);
-                g_wsServer->sendToClient(clientId, response);
-                std::cout << "[Session " << clientId << "] [INFO] Sent " << candles.size() << " candles (" << timeframe << "s)\n";
-            } catch (...) {
-                std::cout << "[Session " << clientId << "] [ERROR] Invalid timeframe in getCandles\n";
-            }
-        } else if (type == "start") {
-            session->setRunning(true);
+        std::cout << "[Session " << clientId << "] [COMMAND] " << type << "=" << value << std::endl;
+        client->session->postCommand({type, value});
+        
+        if (type == "start") {
+            // Join the schedule; the first tick applies the queued commands
+            // (speed included) and sets the real interval
+            g_tickScheduler->add(clientId, sessionTickInterval(1.0), TickScheduler::Clock::now(), client);
             g_wsStartReceived = true;  // Still signal for any waiting
-            std::cout << "[Session " << clientId << "] [INFO] Simulation STARTED\n";
-            // Send confirmation to client
-            g_wsServer->sendToClient(clientId, R"({"type":"started"})");
-        } else if (type == "ping") {
-            // Respond immediately with pong for latency measurement
-            g_wsServer->sendToClient(clientId, R"({"type":"pong","timestamp":)" + value + "}");
-        } else if (type == "stats") {
-            // Print stats for this session
-            std::cout << "[Session " << clientId << "] [STATS] " << g_wsServer->getSessionStatsString(clientId) << "\n";
         }
     });
     
@@ -1118,13 +1351,14 @@ int main(int argc, char* argv[]) {
     // Create core components (AFTER WebSocket config is applied)
     OrderBook orderBook;
     MatchingEngine engine(orderBook);
-    OrderQueue orderQueue;
+    SpscOrderQueue orderQueue;  // One generator thread -> one processor thread
     Visualizer visualizer(orderBook, g_config.stockSymbol);
     visualizer.setSentimentController(&g_sentimentController);
     
     // Create the order generator with configured base price
     double basePrice = g_config.basePrice;
-    SentimentOrderGenerator generator(g_sentimentController, basePrice);
+    FastRng generatorRng(FastRng::deriveSeed(baseSeed, 0));
+    SentimentOrderGenerator generator(g_sentimentController, generatorRng, basePrice);
     g_generator = &generator;
     
     // Counters
@@ -0,0 +1,225 @@
+// ============================================================================
+// TEST_BINARY_ENCODER.CPP - Unit tests for the binary wire format
+// ============================================================================
+
+#include <gtest/gtest.h>
+#include "BinaryEncoder.h"
+#include "JsonBuilder.h"
+
+using namespace orderbook;
+
+namespace {
+
+// Little-endian reader mirroring the frontend decoder
+class Reader {
+public:
+    explicit Reader(const std::string& bytes) : m_bytes(bytes) {}
+
+    uint64_t get(int size) {
+        uint64_t value = 0;
+        for (int i = 0; i < size; ++i) {
+            value |= static_cast<uint64_t>(static_cast<uint8_t>(m_bytes.at(m_pos++))) << (8 * i);
+        }
+        return value;
+    }
+    uint8_t  u8()  { return static_cast<uint8_t>(get(1)); }
+    uint16_t u16() { return static_cast<uint16_t>(get(2)); }
+    uint32_t u32() { return static_cast<uint32_t>(get(4)); }
+    int32_t  i32() { return static_cast<int32_t>(get(4)); }
+    int64_t  i64() { return static_cast<int64_t>(get(8)); }
+    std::string str() {
+        size_t length = u8();
+        std::string s = m_bytes.substr(m_pos, length);
+        m_pos += length;
+        return s;
+    }
+    bool atEnd() const { return m_pos == m_bytes.size(); }
+
+private:
+    const std::string& m_bytes;
+    size_t m_pos = 0;
+};
+
+SessionStats sampleStats() {
+    SessionStats stats;
+    stats.symbol = "AAPL";
+    stats.currentPrice = 180.25;
+    stats.openPrice = 180.0;
+    stats.highPrice = 181.5;
+    stats.lowPrice = 179.75;
+    stats.totalOrders = 5000000000ull;  // Past 32 bits on purpose
+    stats.totalTrades = 12;
+    stats.totalVolume = 340;
+    stats.marketOrderPct = 21;
+    stats.sentiment = "BULLISH";
+    stats.intensity = "NORMAL";
+    stats.spread = 0.10;
+    stats.speed = 1.25;
+    stats.paused = true;
+    stats.newsShockCooldown = true;
+    stats.newsShockCooldownRemaining = 7;
+    return stats;
+}
+
+} // namespace
+
+// ============================================================================
+// TICK
+// ============================================================================
+
+TEST(BinaryEncoderTest, Tick_FullBook_RoundTrips) {
+    OrderBook book;
+    book.addOrder(Order(1, Side::BUY, OrderType::LIMIT, 179.95, 300));
+    book.addOrder(Order(2, Side::BUY, OrderType::LIMIT, 179.90, 200));
+    book.addOrder(Order(3, Side::SELL, OrderType::LIMIT, 180.05, 150));
+
+    std::map<int, Candle> current{{1, Candle(1000, Price(180.0), 5)}};
+    std::vector<CompletedCandle> completed;
+    TradeData trade{77, Price(180.05), 40, "SELL", 123456789};
+
+    std::string bytes = BinaryEncoder::tick(book, sampleStats(), Price(180.25), 25, 1700000000000,
+                                            &trade, current, completed);
+    Reader r(bytes);
+    EXPECT_EQ(r.u8(), BinaryEncoder::VERSION);
+    EXPECT_EQ(r.u8(), static_cast<uint8_t>(BinaryEncoder::MessageType::TICK));
+    EXPECT_EQ(r.i64(), 1700000000000);
+    EXPECT_EQ(r.i32(), 18025);  // Cents
+    EXPECT_EQ(r.u32(), 25u);
+
+    // Book: levels mode
+    EXPECT_EQ(r.u8(), 0);
+    ASSERT_EQ(r.u16(), 2);
+    EXPECT_EQ(r.i32(), 17995);
+    EXPECT_EQ(r.u32(), 300u);
+    EXPECT_EQ(r.i32(), 17990);
+    EXPECT_EQ(r.u32(), 200u);
+    ASSERT_EQ(r.u16(), 1);
+    EXPECT_EQ(r.i32(), 18005);
+    EXPECT_EQ(r.u32(), 150u);
+    EXPECT_EQ(r.i32(), 17995);  // bestBid
+    EXPECT_EQ(r.i32(), 18005);  // bestAsk
+    EXPECT_EQ(r.i32(), 10);     // spread
+
+    // Stats
+    EXPECT_EQ(r.str(), "AAPL");
+    EXPECT_EQ(r.i32(), 18025);
+    EXPECT_EQ(r.i32(), 18000);
+    EXPECT_EQ(r.i32(), 18150);
+    EXPECT_EQ(r.i32(), 17975);
+    EXPECT_EQ(r.get(8), 5000000000ull);
+    EXPECT_EQ(r.get(8), 12u);
+    EXPECT_EQ(r.get(8), 340u);
+    EXPECT_EQ(r.u8(), 21);
+    EXPECT_EQ(r.str(), "BULLISH");
+    EXPECT_EQ(r.str(), "NORMAL");
+    EXPECT_EQ(r.i32(), 10);
+    EXPECT_EQ(r.u16(), 125);
+    EXPECT_EQ(r.u8(), 1 | 4);
+    EXPECT_EQ(r.i32(), 7);
+    EXPECT_EQ(r.i32(), 0);
+
+    // Candles
+    ASSERT_EQ(r.u8(), 1);
+    EXPECT_EQ(r.u16(), 1);
+    EXPECT_EQ(r.i64(), 1000);
+    for (int i = 0; i < 4; ++i) EXPECT_EQ(r.i32(), 18000);
+    EXPECT_EQ(r.u32(), 5u);
+    EXPECT_EQ(r.u8(), 0);  // No completed candles
+
+    // Trade
+    ASSERT_EQ(r.u8(), 1);
+    EXPECT_EQ(r.i64(), 77);
+    EXPECT_EQ(r.i32(), 18005);
+    EXPECT_EQ(r.u32(), 40u);
+    EXPECT_EQ(r.u8(), 1);  // SELL
+    EXPECT_EQ(r.i64(), 123456789);
+    EXPECT_TRUE(r.atEnd());
+}
+
+TEST(BinaryEncoderTest, Tick_DeltaFrame_CarriesChangesAndChecksum) {
+    OrderBookConfig config;
+    config.trackLevelChanges = true;
+    OrderBook book(config);
+    book.addOrder(Order(1, Side::BUY, OrderType::LIMIT, 99.95, 100));
+    book.addOrder(Order(2, Side::SELL, OrderType::LIMIT, 100.05, 50));
+    std::vector<LevelChange> changes;
+    book.takeLevelChanges(changes);
+    book.cancelOrder(2);
+    book.takeLevelChanges(changes);
+
+    BookFrame frame;
+    frame.sequence = 9;
+    frame.changes = &changes;
+    std::string bytes = BinaryEncoder::tick(book, SessionStats(), Price(100.0), 0, 0,
+                                            nullptr, {}, {}, &frame);
+    Reader r(bytes);
+    r.get(2 + 8 + 4 + 4);
+    EXPECT_EQ(r.u8(), 1);  // Delta
+    EXPECT_EQ(r.u32(), 9u);
+
+    BookSnapshot snap;
+    book.snapshot(JsonBuilder::BOOK_DEPTH, snap);
+    EXPECT_EQ(r.u32(), JsonBuilder::bookChecksum(snap));
+    EXPECT_EQ(r.u16(), 0);       // No bid changes
+    ASSERT_EQ(r.u16(), 1);
+    EXPECT_EQ(r.i32(), 10005);
+    EXPECT_EQ(r.u32(), 0u);      // Removed
+}
+
+TEST(BinaryEncoderTest, Tick_MuchSmallerThanJson) {
+    OrderBook book;
+    for (int i = 0; i < 15; ++i) {
+        book.addOrder(Order(i + 1, Side::BUY, OrderType::LIMIT, 179.95 - 0.05 * i, 100 + i));
+        book.addOrder(Order(i + 100, Side::SELL, OrderType::LIMIT, 180.05 + 0.05 * i, 100 + i));
+    }
+    std::map<int, Candle> current;
+    for (int tf : {1, 5, 30, 60, 300}) current[tf] = Candle(1000, Price(180.0), 5);
+    SessionStats stats = sampleStats();
+
+    std::string binary = BinaryEncoder::tick(book, stats, Price(180.0), 10, 0, nullptr, current, {});
+    std::string json = JsonBuilder::tickToJson(book, stats, Price(180.0),
+                                               10, 0, nullptr, current, {});
+    EXPECT_LT(binary.size() * 2, json.size());
+}
+
+// ============================================================================
+// TRADE / CANDLE HISTORY
+// ============================================================================
+
+TEST(BinaryEncoderTest, Trade_Layout) {
+    TradeData trade{5, Price(99.5), 12, "BUY", 42};
+    std::string bytes = BinaryEncoder::trade(trade);
+    Reader r(bytes);
+    EXPECT_EQ(r.u8(), BinaryEncoder::VERSION);
+    EXPECT_EQ(r.u8(), static_cast<uint8_t>(BinaryEncoder::MessageType::TRADE));
+    EXPECT_EQ(r.i64(), 5);
+    EXPECT_EQ(r.i32(), 9950);
+    EXPECT_EQ(r.u32(), 12u);
+    EXPECT_EQ(r.u8(), 0);
+    EXPECT_EQ(r.i64(), 42);
+    EXPECT_TRUE(r.atEnd());
+}
+
+TEST(BinaryEncoderTest, CandleHistory_WithAndWithoutCurrent) {
+    std::vector<Candle> candles{Candle(60000, Price(100.0), 10), Candle(120000, Price(100.5), 20)};
+    Candle current(180000, Price(101.0), 3);
+
+    std::string bytes = BinaryEncoder::candleHistory(60, candles, &current);
+    Reader r(bytes);
+    r.get(2);
+    EXPECT_EQ(r.u16(), 60);
+    ASSERT_EQ(r.u32(), 2u);
+    EXPECT_EQ(r.i64(), 60000);
+    r.get(16);
+    EXPECT_EQ(r.u32(), 10u);
+    EXPECT_EQ(r.i64(), 120000);
+    EXPECT_EQ(r.i32(), 10050);
+    r.get(12);
+    EXPECT_EQ(r.u32(), 20u);
+    ASSERT_EQ(r.u8(), 1);
+    EXPECT_EQ(r.i64(), 180000);
+    r.get(20);
+    EXPECT_TRUE(r.atEnd());
+
+    EXPECT_EQ(BinaryEncoder::candleHistory(60, {}, nullptr).size(), 2u + 2 + 4 + 1);
+}
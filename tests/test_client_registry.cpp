@@ -0,0 +1,125 @@
+// ============================================================================
+// TEST_CLIENT_REGISTRY.CPP - Unit tests for the sharded client registry
+// ============================================================================
+
+#include <gtest/gtest.h>
+#include "ClientRegistry.h"
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace orderbook;
+
+namespace {
+
+struct TestClient {
+    explicit TestClient(uint32_t clientId) : id(clientId) {}
+    uint32_t id;
+};
+
+using Registry = ClientRegistry<TestClient>;
+
+std::vector<uint32_t> ids(const Registry::Snapshot& snapshot) {
+    std::vector<uint32_t> result;
+    for (const auto& client : *snapshot) {
+        result.push_back(client->id);
+    }
+    return result;
+}
+
+} // namespace
+
+// ============================================================================
+// LOOKUP
+// ============================================================================
+
+TEST(ClientRegistryTest, InsertFindErase) {
+    Registry registry;
+    EXPECT_TRUE(registry.empty());
+    EXPECT_TRUE(registry.insert(1, std::make_shared<TestClient>(1)));
+    EXPECT_TRUE(registry.insert(17, std::make_shared<TestClient>(17)));  // Same shard as 1
+    EXPECT_EQ(registry.size(), 2u);
+
+    ASSERT_TRUE(registry.find(17));
+    EXPECT_EQ(registry.find(17)->id, 17u);
+    EXPECT_FALSE(registry.find(2));
+
+    EXPECT_EQ(registry.erase(1)->id, 1u);
+    EXPECT_FALSE(registry.find(1));
+    EXPECT_TRUE(registry.find(17));
+    EXPECT_FALSE(registry.erase(1));
+    EXPECT_EQ(registry.size(), 1u);
+}
+
+TEST(ClientRegistryTest, DuplicateId_Rejected) {
+    Registry registry;
+    auto first = std::make_shared<TestClient>(5);
+    EXPECT_TRUE(registry.insert(5, first));
+    EXPECT_FALSE(registry.insert(5, std::make_shared<TestClient>(5)));
+    EXPECT_EQ(registry.find(5), first);
+    EXPECT_EQ(registry.snapshot()->size(), 1u);
+}
+
+// ============================================================================
+// SNAPSHOTS
+// ============================================================================
+
+TEST(ClientRegistryTest, Snapshot_InConnectionOrder) {
+    Registry registry;
+    for (uint32_t id : {3u, 1u, 20u, 2u}) {
+        registry.insert(id, std::make_shared<TestClient>(id));
+    }
+    registry.erase(1);
+    EXPECT_EQ(ids(registry.snapshot()), (std::vector<uint32_t>{3, 20, 2}));
+}
+
+TEST(ClientRegistryTest, Snapshot_UnchangedByLaterWrites) {
+    Registry registry;
+    registry.insert(1, std::make_shared<TestClient>(1));
+    registry.insert(2, std::make_shared<TestClient>(2));
+
+    Registry::Snapshot before = registry.snapshot();
+    std::weak_ptr<TestClient> removed = registry.find(1);
+    registry.erase(1);
+    registry.insert(3, std::make_shared<TestClient>(3));
+
+    // The reader keeps its view, and the removed client stays alive with it
+    EXPECT_EQ(ids(before), (std::vector<uint32_t>{1, 2}));
+    EXPECT_FALSE(removed.expired());
+    before.reset();
+    EXPECT_TRUE(removed.expired());
+    EXPECT_EQ(ids(registry.snapshot()), (std::vector<uint32_t>{2, 3}));
+}
+
+TEST(ClientRegistryTest, ConcurrentReadersAndWriters) {
+    Registry registry;
+    std::atomic<bool> done{false};
+    std::atomic<uint64_t> visited{0};
+
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 2; ++r) {
+        readers.emplace_back([&] {
+            while (!done) {
+                Registry::Snapshot clients = registry.snapshot();
+                for (const auto& client : *clients) {
+                    visited += client->id;  // Dereference every handle
+                }
+                registry.find(1000);
+            }
+        });
+    }
+
+    for (uint32_t id = 1; id <= 2000; ++id) {
+        registry.insert(id, std::make_shared<TestClient>(id));
+        if (id % 2 == 0) registry.erase(id - 1);
+    }
+    done = true;
+    for (std::thread& reader : readers) reader.join();
+
+    EXPECT_EQ(registry.size(), 1000u);
+    EXPECT_EQ(registry.snapshot()->size(), 1000u);
+    for (uint32_t id = 2; id <= 2000; id += 2) {
+        ASSERT_TRUE(registry.find(id));
+    }
+}
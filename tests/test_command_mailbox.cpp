@@ -0,0 +1,85 @@
+// ============================================================================
+// TEST_COMMAND_MAILBOX.CPP - Unit tests for the session command mailbox
+// ============================================================================
+
+#include <gtest/gtest.h>
+#include "CommandMailbox.h"
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace orderbook;
+
+TEST(CommandMailboxTest, DrainsInPostOrder) {
+    CommandMailbox mailbox;
+    EXPECT_TRUE(mailbox.empty());
+
+    mailbox.post({"speed", "2"});
+    mailbox.post({"pause", "true"});
+    mailbox.post({"reset", ""});
+    EXPECT_FALSE(mailbox.empty());
+
+    std::vector<std::string> types;
+    size_t applied = mailbox.drain([&](const SessionCommand& cmd) { types.push_back(cmd.type); });
+    EXPECT_EQ(applied, 3u);
+    EXPECT_EQ(types, (std::vector<std::string>{"speed", "pause", "reset"}));
+    EXPECT_TRUE(mailbox.empty());
+
+    // Usable again after a drain
+    mailbox.post({"spread", "0.10"});
+    SessionCommand last;
+    EXPECT_EQ(mailbox.drain([&](const SessionCommand& cmd) { last = cmd; }), 1u);
+    EXPECT_EQ(last.value, "0.10");
+}
+
+TEST(CommandMailboxTest, EmptyDrain_AppliesNothing) {
+    CommandMailbox mailbox;
+    EXPECT_EQ(mailbox.drain([](const SessionCommand&) { FAIL(); }), 0u);
+}
+
+TEST(CommandMailboxTest, UndrainedCommands_FreedOnDestruction) {
+    // Checked by ASan: nodes still queued must not leak
+    CommandMailbox mailbox;
+    for (int i = 0; i < 100; ++i) {
+        mailbox.post({"sentiment", std::string(64, 'x')});
+    }
+    mailbox.drain([](const SessionCommand&) {});
+    mailbox.post({"reset", ""});
+}
+
+TEST(CommandMailboxTest, ManyProducers_OneConsumer) {
+    constexpr int PRODUCERS = 4;
+    constexpr int PER_PRODUCER = 20000;
+
+    CommandMailbox mailbox;
+    std::atomic<int> finished{0};
+    std::vector<std::thread> producers;
+    for (int p = 0; p < PRODUCERS; ++p) {
+        producers.emplace_back([&, p] {
+            for (int i = 0; i < PER_PRODUCER; ++i) {
+                mailbox.post({std::to_string(p), std::to_string(i)});
+            }
+            finished++;
+        });
+    }
+
+    // Each producer's commands arrive complete and in its own order
+    std::vector<int> next(PRODUCERS, 0);
+    bool ordered = true;
+    auto check = [&](const SessionCommand& cmd) {
+        int p = std::stoi(cmd.type);
+        if (std::stoi(cmd.value) != next[p]) ordered = false;
+        ++next[p];
+    };
+    size_t total = 0;
+    while (finished.load() < PRODUCERS) {
+        total += mailbox.drain(check);
+    }
+    for (std::thread& t : producers) t.join();
+    total += mailbox.drain(check);
+
+    EXPECT_TRUE(ordered);
+    EXPECT_EQ(total, static_cast<size_t>(PRODUCERS * PER_PRODUCER));
+    EXPECT_TRUE(mailbox.empty());
+}
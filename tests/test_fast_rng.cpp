@@ -0,0 +1,102 @@
+// ============================================================================
+// TEST_FAST_RNG.CPP - Unit tests for the per-session random generator
+// ============================================================================
+
+#include <gtest/gtest.h>
+#include "FastRng.h"
+#include "SessionState.h"
+#include <vector>
+
+using namespace orderbook;
+
+// deriveSeed is usable at compile time
+static_assert(FastRng::deriveSeed(1, 1) != FastRng::deriveSeed(1, 2), "streams differ");
+
+// ============================================================================
+// GENERATOR
+// ============================================================================
+
+TEST(FastRngTest, SameSeed_SameSequence) {
+    FastRng a(12345);
+    FastRng b(12345);
+    FastRng c(12346);
+    bool differs = false;
+    for (int i = 0; i < 1000; ++i) {
+        uint64_t x = a();
+        ASSERT_EQ(x, b());
+        if (x != c()) differs = true;
+    }
+    EXPECT_TRUE(differs);
+}
+
+TEST(FastRngTest, Reseed_ReplaysFromStart) {
+    FastRng rng(99);
+    std::vector<uint64_t> first;
+    for (int i = 0; i < 100; ++i) first.push_back(rng());
+
+    rng.reseed(rng.seed());
+    for (int i = 0; i < 100; ++i) {
+        ASSERT_EQ(rng(), first[i]);
+    }
+}
+
+TEST(FastRngTest, Helpers_StayInRange) {
+    FastRng rng(7);
+    std::vector<int> hits(5, 0);
+    for (int i = 0; i < 10000; ++i) {
+        double d = rng.nextDouble();
+        ASSERT_GE(d, 0.0);
+        ASSERT_LT(d, 1.0);
+
+        uint32_t below = rng.nextBelow(5);
+        ASSERT_LT(below, 5u);
+        ++hits[below];
+
+        int n = rng.nextInt(-3, 3);
+        ASSERT_GE(n, -3);
+        ASSERT_LE(n, 3);
+    }
+    // Roughly uniform: every bucket near 2000
+    for (int count : hits) {
+        EXPECT_GT(count, 1700);
+        EXPECT_LT(count, 2300);
+    }
+    EXPECT_EQ(rng.nextBelow(0), 0u);
+}
+
+// ============================================================================
+// SESSIONS
+// ============================================================================
+
+TEST(FastRngTest, SessionWithSeed_ReplaysTrades) {
+    SessionConfig config;
+    config.seed = FastRng::deriveSeed(2024, 7);
+    SessionState a(7, config);
+    SessionState b(7, config);
+    EXPECT_EQ(a.getSeed(), config.seed);
+
+    std::vector<TradeData> trades;
+    for (int i = 0; i < 50; ++i) {
+        TradeData ta = a.generateTrade(180.0, i);
+        TradeData tb = b.generateTrade(180.0, i);
+        ASSERT_EQ(ta.price, tb.price);
+        ASSERT_EQ(ta.quantity, tb.quantity);
+        ASSERT_EQ(ta.side, tb.side);
+        trades.push_back(ta);
+    }
+
+    // reset() starts the sequence over
+    a.reset();
+    for (int i = 0; i < 50; ++i) {
+        TradeData t = a.generateTrade(180.0, i);
+        ASSERT_EQ(t.price, trades[i].price);
+        ASSERT_EQ(t.quantity, trades[i].quantity);
+    }
+}
+
+TEST(FastRngTest, UnseededSessions_GetDistinctSeeds) {
+    SessionState a(1);
+    SessionState b(2);
+    EXPECT_NE(a.getSeed(), 0u);
+    EXPECT_NE(a.getSeed(), b.getSeed());
+}
@@ -0,0 +1,161 @@
+// ============================================================================
+// TEST_JSON_BUILDER.CPP - Unit tests for tick encoding and the delta book feed
+// ============================================================================
+
+#include <gtest/gtest.h>
+#include "JsonBuilder.h"
+#include "SessionState.h"
+#include <map>
+
+using namespace orderbook;
+
+namespace {
+
+// Build a tick for the session the way the server loop does
+std::string buildTick(SessionState& session, BookFrame* frame) {
+    std::map<int, Candle> candles;
+    std::vector<CompletedCandle> completed;
+    return JsonBuilder::tickToJson(session.getOrderBook(), SessionStats(), Price(100.0), 10, 0,
+                                   nullptr, candles, completed, frame);
+}
+
+void refresh(SessionState& session, double price) {
+    session.getOrderGenerator().refreshOrderBook(session.getOrderBook(), price, 0.10);
+}
+
+// Client-side view of one side, built only from frames
+using ClientSide = std::map<int64_t, Quantity>;
+
+void applyChanges(const std::vector<LevelChange>& changes, ClientSide& bids, ClientSide& asks) {
+    for (const LevelChange& change : changes) {
+        ClientSide& side = change.side == Side::BUY ? bids : asks;
+        if (change.quantity == 0) {
+            side.erase(change.price.raw());
+        } else {
+            side[change.price.raw()] = change.quantity;
+        }
+    }
+}
+
+uint32_t clientChecksum(const ClientSide& bids, const ClientSide& asks) {
+    BookSnapshot snap;
+    for (auto it = bids.rbegin(); it != bids.rend() && snap.bidCount < BookSnapshot::MAX_DEPTH; ++it) {
+        snap.bids[snap.bidCount++] = {Price::fromRaw(it->first), it->second};
+    }
+    for (auto it = asks.begin(); it != asks.end() && snap.askCount < BookSnapshot::MAX_DEPTH; ++it) {
+        snap.asks[snap.askCount++] = {Price::fromRaw(it->first), it->second};
+    }
+    return JsonBuilder::bookChecksum(snap);
+}
+
+uint32_t serverChecksum(const OrderBook& book) {
+    BookSnapshot snap;
+    book.snapshot(JsonBuilder::BOOK_DEPTH, snap);
+    return JsonBuilder::bookChecksum(snap);
+}
+
+} // namespace
+
+// ============================================================================
+// FEED MODES
+// ============================================================================
+
+TEST(BookFeedTest, FullMode_TickCarriesLevels) {
+    SessionState session(1);
+    refresh(session, 100.0);
+    
+    BookFrame frame;
+    EXPECT_FALSE(session.nextBookFrame(frame));
+    std::string json = buildTick(session, nullptr);
+    EXPECT_NE(json.find(R"("orderbook":{"bids":[{"price":)"), std::string::npos);
+    EXPECT_EQ(json.find(R"("book":)"), std::string::npos);
+}
+
+TEST(BookFeedTest, DeltaMode_SnapshotThenSequencedDeltas) {
+    SessionState session(1);
+    session.setBookFeedMode(BookFeedMode::DELTA);
+    refresh(session, 100.0);
+    
+    BookFrame frame;
+    ASSERT_TRUE(session.nextBookFrame(frame));
+    EXPECT_TRUE(frame.snapshot);
+    EXPECT_EQ(frame.sequence, 1u);
+    std::string json = buildTick(session, &frame);
+    EXPECT_NE(json.find(R"("book":{"seq":1,"snapshot":true,"bids":[[)"), std::string::npos);
+    EXPECT_EQ(json.find(R"("orderbook":)"), std::string::npos);
+    
+    refresh(session, 100.10);
+    ASSERT_TRUE(session.nextBookFrame(frame));
+    EXPECT_FALSE(frame.snapshot);
+    EXPECT_EQ(frame.sequence, 2u);
+    EXPECT_FALSE(frame.changes->empty());
+    json = buildTick(session, &frame);
+    EXPECT_NE(json.find(R"("book":{"seq":2,"bids":[)"), std::string::npos);
+    EXPECT_EQ(json.find(R"("snapshot")"), std::string::npos);
+}
+
+TEST(BookFeedTest, ResyncRequestAndReset_SendSnapshot) {
+    SessionState session(1);
+    session.setBookFeedMode(BookFeedMode::DELTA);
+    BookFrame frame;
+    session.nextBookFrame(frame);
+    session.nextBookFrame(frame);
+    EXPECT_FALSE(frame.snapshot);
+    
+    session.requestBookResync();
+    session.nextBookFrame(frame);
+    EXPECT_TRUE(frame.snapshot);
+    
+    session.reset();
+    session.nextBookFrame(frame);
+    EXPECT_TRUE(frame.snapshot);
+    EXPECT_EQ(frame.sequence, 4u);  // Sequence keeps counting across snapshots
+}
+
+// ============================================================================
+// CHECKSUM
+// ============================================================================
+
+TEST(BookFeedTest, AppliedDeltas_MatchServerChecksum) {
+    SessionState session(1);
+    session.setBookFeedMode(BookFeedMode::DELTA);
+    ClientSide bids, asks;
+    
+    double price = 100.0;
+    for (int tick = 0; tick < 200; ++tick) {
+        price += (tick % 7 < 4) ? 0.05 : -0.05;
+        refresh(session, price);
+        
+        BookFrame frame;
+        ASSERT_TRUE(session.nextBookFrame(frame));
+        if (frame.snapshot) {
+            // A client rebuilding from the snapshot levels lands in the same place
+            bids.clear();
+            asks.clear();
+            BookSnapshot snap;
+            session.getOrderBook().snapshot(JsonBuilder::BOOK_DEPTH, snap);
+            for (size_t i = 0; i < snap.bidCount; ++i) bids[snap.bids[i].price.raw()] = snap.bids[i].quantity;
+            for (size_t i = 0; i < snap.askCount; ++i) asks[snap.asks[i].price.raw()] = snap.asks[i].quantity;
+        } else {
+            applyChanges(*frame.changes, bids, asks);
+        }
+        ASSERT_EQ(clientChecksum(bids, asks), serverChecksum(session.getOrderBook())) << "tick " << tick;
+    }
+}
+
+TEST(BookFeedTest, Checksum_SensitiveToQuantityAndSide) {
+    BookSnapshot a;
+    a.bids[0] = {Price(99.95), 100};
+    a.bidCount = 1;
+    BookSnapshot b = a;
+    EXPECT_EQ(JsonBuilder::bookChecksum(a), JsonBuilder::bookChecksum(b));
+    
+    b.bids[0].quantity = 101;
+    EXPECT_NE(JsonBuilder::bookChecksum(a), JsonBuilder::bookChecksum(b));
+    
+    // Same level on the other side is a different book
+    BookSnapshot c;
+    c.asks[0] = a.bids[0];
+    c.askCount = 1;
+    EXPECT_NE(JsonBuilder::bookChecksum(a), JsonBuilder::bookChecksum(c));
+}
@@ -0,0 +1,134 @@
+// ============================================================================
+// TEST_JSON_WRITER.CPP - Unit tests for the append-only JSON writer
+// ============================================================================
+
+#include <gtest/gtest.h>
+#include "JsonWriter.h"
+#include "JsonBuilder.h"
+#include <limits>
+
+using namespace orderbook;
+
+// ============================================================================
+// STRUCTURE
+// ============================================================================
+
+TEST(JsonWriterTest, Commas_ObjectsAndNestedArrays) {
+    std::string out;
+    JsonWriter w(out);
+    w.beginObject();
+    w.key("a").value(1);
+    w.key("b").beginArray().value(2).beginArray().endArray().beginObject().endObject().endArray();
+    w.key("c").null();
+    w.endObject();
+    EXPECT_EQ(out, R"({"a":1,"b":[2,[],{}],"c":null})");
+}
+
+TEST(JsonWriterTest, AppendsToExistingContents) {
+    std::string out = "prefix:";
+    JsonWriter w(out);
+    w.beginArray().value(true).value(false).endArray();
+    EXPECT_EQ(out, "prefix:[true,false]");
+}
+
+// ============================================================================
+// NUMBERS
+// ============================================================================
+
+TEST(JsonWriterTest, Integers_FullRange) {
+    std::string out;
+    JsonWriter w(out);
+    w.beginArray()
+        .value(std::numeric_limits<int64_t>::min())
+        .value(std::numeric_limits<uint64_t>::max())
+        .value(static_cast<uint32_t>(0))
+        .value(-7)
+        .endArray();
+    EXPECT_EQ(out, "[-9223372036854775808,18446744073709551615,0,-7]");
+}
+
+TEST(JsonWriterTest, Price_TwoDecimalsLikeStream) {
+    std::string out;
+    JsonWriter w(out);
+    w.beginArray()
+        .value(Price(100.0))
+        .value(Price(100.05))
+        .value(Price(0.1))
+        .value(Price(-0.05))
+        .value(Price(-12.3))
+        .value(Price())
+        .endArray();
+    EXPECT_EQ(out, "[100.00,100.05,0.10,-0.05,-12.30,0.00]");
+}
+
+TEST(JsonWriterTest, Price_SubCentRoundsToNearestCent) {
+    std::string out;
+    JsonWriter w(out);
+    w.beginArray().value(Price::fromRaw(1000049)).value(Price::fromRaw(1000050)).endArray();
+    EXPECT_EQ(out, "[100.00,100.01]");
+}
+
+TEST(JsonWriterTest, Double_FixedPrecision) {
+    std::string out;
+    JsonWriter w(out);
+    w.beginArray().value(0.1).value(1.005).value(2.5, 0).value(-3.14159, 3).endArray();
+    // Same digits printf("%.Nf") produces (1.005 is 1.00499... in binary)
+    EXPECT_EQ(out, "[0.10,1.00,2,-3.142]");
+}
+
+// ============================================================================
+// STRINGS
+// ============================================================================
+
+TEST(JsonWriterTest, String_Escaping) {
+    std::string out;
+    JsonWriter w(out);
+    w.value(std::string("a\"b\\c\nd\te\x01"));
+    EXPECT_EQ(out, R"("a\"b\\c\nd\te\u0001")");
+}
+
+// ============================================================================
+// JSONBUILDER ON TOP
+// ============================================================================
+
+TEST(JsonWriterTest, TickBuffer_AppendsAndReusesAllocation) {
+    OrderBook book;
+    for (int i = 0; i < 15; ++i) {
+        book.addOrder(Order(i + 1, Side::BUY, OrderType::LIMIT, 99.95 - 0.05 * i, 100));
+        book.addOrder(Order(i + 100, Side::SELL, OrderType::LIMIT, 100.05 + 0.05 * i, 100));
+    }
+    SessionStats stats;
+    stats.symbol = "AAPL";
+    std::map<int, Candle> candles{{1, Candle(1000, Price(100.0), 5)}};
+    std::string expected = JsonBuilder::tickToJson(book, stats, Price(100.0), 10, 0, nullptr, candles, {});
+
+    std::string buffer = "head";
+    JsonBuilder::tickToJson(buffer, book, stats, Price(100.0), 10, 0, nullptr, candles, {});
+    EXPECT_EQ(buffer, "head" + expected);  // Appended after what was there
+
+    buffer.resize(4);  // Back to the prefix, like OutboundFrame::reset
+    const char* data = buffer.data();
+    size_t capacity = buffer.capacity();
+    JsonBuilder::tickToJson(buffer, book, stats, Price(100.0), 10, 0, nullptr, candles, {});
+    EXPECT_EQ(buffer, "head" + expected);
+    EXPECT_EQ(buffer.data(), data);
+    EXPECT_EQ(buffer.capacity(), capacity);
+}
+
+TEST(JsonWriterTest, Tick_StatsWrittenInPlace) {
+    OrderBook book;
+    SessionStats stats;
+    stats.symbol = "AAPL";
+    stats.currentPrice = 180.25;
+    stats.spread = 0.05;
+    stats.speed = 1.5;
+    stats.paused = true;
+
+    std::string tick = JsonBuilder::tickToJson(book, stats, Price(180.25), 0, 0, nullptr, {}, {});
+    std::string statsMessage = JsonBuilder::statsToJson(stats);
+    std::string statsData = statsMessage.substr(statsMessage.find(R"("data":)") + 7);
+    statsData.pop_back();  // Outer message brace
+
+    EXPECT_NE(tick.find(R"("stats":)" + statsData + ","), std::string::npos);
+    EXPECT_NE(tick.find(R"("spread":0.05,"speed":1.50,"paused":true)"), std::string::npos);
+}
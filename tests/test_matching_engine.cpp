@@ -20,7 +20,7 @@ TEST(MatchingEngineTest, ProcessOrder_NoMatch_AddsToBook) {
     
     EXPECT_TRUE(trades.empty());
     EXPECT_TRUE(book.getBestBid().has_value());
-    EXPECT_DOUBLE_EQ(*book.getBestBid(), 100.0);
+    EXPECT_EQ(*book.getBestBid(), Price(100.0));
 }
 
 TEST(MatchingEngineTest, CancelOrder_ExistingOrder_Succeeds) {
@@ -34,6 +34,144 @@ TEST(MatchingEngineTest, CancelOrder_ExistingOrder_Succeeds) {
     EXPECT_FALSE(book.getBestBid().has_value());
 }
 
+TEST(MatchingEngineTest, ProcessOrder_Match_ReportsRestingOrderId) {
+    OrderBook book;
+    MatchingEngine engine(book);
+    book.addOrder(Order(7, Side::SELL, OrderType::LIMIT, 100.0, 100));
+    
+    Order buyOrder(8, Side::BUY, OrderType::LIMIT, 100.0, 40);
+    auto trades = engine.processOrder(buyOrder);
+    
+    ASSERT_EQ(trades.size(), 1u);
+    EXPECT_EQ(trades[0].buyOrderId, 8u);
+    EXPECT_EQ(trades[0].sellOrderId, 7u);
+    EXPECT_EQ(trades[0].price, Price(100.0));
+    EXPECT_EQ(trades[0].quantity, 40);
+    EXPECT_EQ(book.getQuantityAtPrice(Side::SELL, 100.0), 60);
+    EXPECT_TRUE(buyOrder.isFilled());
+}
+
+TEST(MatchingEngineTest, ProcessOrder_SweepsLevelsInPriceTimeOrder) {
+    OrderBook book;
+    MatchingEngine engine(book);
+    book.addOrder(Order(1, Side::BUY, OrderType::LIMIT, 100.0, 30));
+    book.addOrder(Order(2, Side::BUY, OrderType::LIMIT, 100.0, 30));
+    book.addOrder(Order(3, Side::BUY, OrderType::LIMIT, 99.0, 50));
+    
+    Order sellOrder(4, Side::SELL, OrderType::MARKET, 0.0, 80);
+    auto trades = engine.processOrder(sellOrder);
+    
+    ASSERT_EQ(trades.size(), 3u);
+    EXPECT_EQ(trades[0].buyOrderId, 1u);
+    EXPECT_EQ(trades[1].buyOrderId, 2u);
+    EXPECT_EQ(trades[2].buyOrderId, 3u);
+    EXPECT_EQ(trades[2].price, Price(99.0));
+    EXPECT_EQ(trades[2].quantity, 20);
+    for (const auto& trade : trades) EXPECT_EQ(trade.sellOrderId, 4u);
+    
+    EXPECT_EQ(engine.getTradeCount(), 3u);
+    EXPECT_EQ(engine.getTotalVolume(), 80);
+    EXPECT_EQ(book.getOrder(1), nullptr);   // Filled orders leave the book
+    EXPECT_EQ(*book.getBestBid(), Price(99.0));
+}
+
+TEST(MatchingEngineTest, ProcessOrder_LimitStopsAtNonCrossingLevel_RestsRemainder) {
+    OrderBook book;
+    MatchingEngine engine(book);
+    book.addOrder(Order(1, Side::SELL, OrderType::LIMIT, 100.0, 50));
+    book.addOrder(Order(2, Side::SELL, OrderType::LIMIT, 101.0, 50));
+    
+    Order buyOrder(3, Side::BUY, OrderType::LIMIT, 100.0, 80);
+    auto trades = engine.processOrder(buyOrder);
+    
+    ASSERT_EQ(trades.size(), 1u);
+    EXPECT_EQ(trades[0].sellOrderId, 1u);
+    EXPECT_EQ(book.getQuantityAtPrice(Side::SELL, 101.0), 50);
+    EXPECT_EQ(*book.getBestBid(), Price(100.0));
+    EXPECT_EQ(book.getQuantityAtPrice(Side::BUY, 100.0), 30);
+}
+
+TEST(MatchingEngineTest, ProcessOrder_MarketRemainder_IsNotRested) {
+    OrderBook book;
+    MatchingEngine engine(book);
+    book.addOrder(Order(1, Side::SELL, OrderType::LIMIT, 100.0, 50));
+    
+    Order buyOrder(2, Side::BUY, OrderType::MARKET, 0.0, 80);
+    auto trades = engine.processOrder(buyOrder);
+    
+    ASSERT_EQ(trades.size(), 1u);
+    EXPECT_EQ(buyOrder.getRemainingQty(), 30);
+    EXPECT_FALSE(book.getBestBid().has_value());
+    EXPECT_FALSE(book.getBestAsk().has_value());
+    EXPECT_EQ(book.getTotalOrderCount(), 0u);
+}
+
+// ============================================================================
+// BATCH TESTS
+// ============================================================================
+
+namespace {
+
+std::vector<Order> makeOrderFlow() {
+    std::vector<Order> orders;
+    orders.emplace_back(1, Side::SELL, OrderType::LIMIT, 101.0, 50);
+    orders.emplace_back(2, Side::SELL, OrderType::LIMIT, 100.5, 30);
+    orders.emplace_back(3, Side::BUY, OrderType::LIMIT, 101.0, 60);   // Sweeps both
+    orders.emplace_back(4, Side::BUY, OrderType::LIMIT, 99.0, 40);    // Rests
+    orders.emplace_back(5, Side::SELL, OrderType::MARKET, 0.0, 25);
+    orders.emplace_back(6, Side::BUY, OrderType::MARKET, 0.0, 100);   // Partial
+    return orders;
+}
+
+} // namespace
+
+TEST(MatchingEngineTest, ProcessBatch_MatchesLikeSequentialProcessOrder) {
+    OrderBook sequentialBook;
+    MatchingEngine sequential(sequentialBook);
+    std::vector<Trade> expected;
+    for (Order& order : makeOrderFlow()) {
+        auto trades = sequential.processOrder(order);
+        expected.insert(expected.end(), trades.begin(), trades.end());
+    }
+    
+    OrderBook batchBook;
+    MatchingEngine batched(batchBook);
+    int callbackCount = 0;
+    batched.onTrade([&](const Trade&) { callbackCount++; });
+    std::vector<Order> orders = makeOrderFlow();
+    std::vector<Trade> trades;
+    
+    EXPECT_EQ(batched.processBatch(orders, trades), expected.size());
+    ASSERT_EQ(trades.size(), expected.size());
+    for (size_t i = 0; i < trades.size(); ++i) {
+        EXPECT_EQ(trades[i].buyOrderId, expected[i].buyOrderId);
+        EXPECT_EQ(trades[i].sellOrderId, expected[i].sellOrderId);
+        EXPECT_EQ(trades[i].price, expected[i].price);
+        EXPECT_EQ(trades[i].quantity, expected[i].quantity);
+    }
+    EXPECT_EQ(callbackCount, static_cast<int>(expected.size()));
+    EXPECT_EQ(batched.getTotalVolume(), sequential.getTotalVolume());
+    EXPECT_EQ(batchBook.getTopBids(), sequentialBook.getTopBids());
+    EXPECT_EQ(batchBook.getTopAsks(), sequentialBook.getTopAsks());
+    EXPECT_EQ(orders[5].getRemainingQty(), 80);  // Caller sees fill state
+}
+
+TEST(MatchingEngineTest, ProcessBatch_Listener_KnowsIncomingOrder) {
+    OrderBook book;
+    MatchingEngine engine(book);
+    std::vector<Order> orders = makeOrderFlow();
+    std::vector<Trade> trades;
+    
+    std::vector<OrderId> takers;
+    engine.processBatch(orders, trades, [&](const Order& order, const Trade& trade) {
+        OrderId taker = order.getSide() == Side::BUY ? trade.buyOrderId : trade.sellOrderId;
+        EXPECT_EQ(taker, order.getId());
+        takers.push_back(order.getId());
+    });
+    
+    EXPECT_EQ(takers, (std::vector<OrderId>{3, 3, 5, 6}));
+}
+
 // ============================================================================
 // TRADE STATISTICS TESTS
 // ============================================================================
@@ -84,6 +222,49 @@ TEST(MatchingEngineTest, OnTrade_CallbackIsCalledOnMatch) {
     }
 }
 
+TEST(MatchingEngineTest, ProcessOrder_Buffer_ReusesStorageAndFiresCallbacks) {
+    OrderBook book;
+    MatchingEngine engine(book);
+    book.addOrder(Order(1, Side::SELL, OrderType::LIMIT, 100.0, 10));
+    book.addOrder(Order(2, Side::SELL, OrderType::LIMIT, 101.0, 10));
+    
+    int callbackCount = 0;
+    engine.onTrade([&](const Trade&) { callbackCount++; });
+    
+    std::vector<Trade> trades;
+    trades.reserve(8);
+    const Trade* storage = trades.data();
+    
+    Order first(3, Side::BUY, OrderType::LIMIT, 101.0, 20);
+    EXPECT_EQ(engine.processOrder(first, trades), 2u);
+    EXPECT_EQ(trades.size(), 2u);
+    EXPECT_EQ(trades[0].timestamp, trades[1].timestamp);  // One match event
+    
+    // The buffer is cleared, not reallocated, by the next call
+    Order second(4, Side::BUY, OrderType::LIMIT, 99.0, 5);
+    EXPECT_EQ(engine.processOrder(second, trades), 0u);
+    EXPECT_TRUE(trades.empty());
+    EXPECT_EQ(trades.data(), storage);
+    EXPECT_EQ(callbackCount, 2);
+}
+
+TEST(MatchingEngineTest, ProcessOrder_Listener_SeesEveryTrade) {
+    OrderBook book;
+    MatchingEngine engine(book);
+    book.addOrder(Order(1, Side::BUY, OrderType::LIMIT, 100.0, 10));
+    book.addOrder(Order(2, Side::BUY, OrderType::LIMIT, 100.0, 10));
+    
+    std::vector<Trade> trades;
+    Quantity seen = 0;
+    Order sellOrder(3, Side::SELL, OrderType::MARKET, 0.0, 15);
+    size_t count = engine.processOrder(sellOrder, trades,
+                                       [&](const Trade& t) { seen += t.quantity; });
+    
+    EXPECT_EQ(count, 2u);
+    EXPECT_EQ(seen, 15);
+    EXPECT_EQ(trades[1].buyOrderId, 2u);
+}
+
 // ============================================================================
 // TRADE STRUCT TESTS
 // ============================================================================
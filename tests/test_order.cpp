@@ -17,7 +17,7 @@ TEST(OrderTest, Constructor_CreatesOrderWithCorrectValues) {
     EXPECT_EQ(order.getId(), 1);
     EXPECT_EQ(order.getSide(), Side::BUY);
     EXPECT_EQ(order.getType(), OrderType::LIMIT);
-    EXPECT_DOUBLE_EQ(order.getPrice(), 100.50);
+    EXPECT_EQ(order.getPrice(), Price(100.50));
     EXPECT_EQ(order.getQuantity(), 200);
     EXPECT_EQ(order.getFilledQty(), 0);
     EXPECT_EQ(order.getRemainingQty(), 200);
@@ -106,7 +106,7 @@ TEST(OrderTest, ModifyPrice_UnfilledLimitOrder_Succeeds) {
     Order order(1, Side::BUY, OrderType::LIMIT, 100.0, 100);
     
     EXPECT_TRUE(order.modifyPrice(105.0));
-    EXPECT_DOUBLE_EQ(order.getPrice(), 105.0);
+    EXPECT_EQ(order.getPrice(), Price(105.0));
 }
 
 TEST(OrderTest, ModifyPrice_PartiallyFilledOrder_Fails) {
@@ -114,7 +114,7 @@ TEST(OrderTest, ModifyPrice_PartiallyFilledOrder_Fails) {
     order.fill(50);
     
     EXPECT_FALSE(order.modifyPrice(105.0));
-    EXPECT_DOUBLE_EQ(order.getPrice(), 100.0);
+    EXPECT_EQ(order.getPrice(), Price(100.0));
 }
 
 TEST(OrderTest, ModifyQuantity_IncreaseAllowed) {
@@ -0,0 +1,146 @@
+// ============================================================================
+// TEST_ORDER_ID_INDEX.CPP - Unit tests for the flat OrderId hash index
+// ============================================================================
+
+#include <gtest/gtest.h>
+#include "OrderIdIndex.h"
+#include "PriceLevelIndex.h"
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+using namespace orderbook;
+
+namespace {
+
+// The index only stores pointers; give each test a pool of distinct nodes
+std::vector<RestingOrder> makeNodes(size_t count) {
+    return std::vector<RestingOrder>(count);
+}
+
+} // namespace
+
+// ============================================================================
+// BASIC OPERATIONS
+// ============================================================================
+
+TEST(OrderIdIndexTest, InsertAndFind_ReturnsNode) {
+    auto nodes = makeNodes(3);
+    OrderIdIndex index;
+
+    EXPECT_TRUE(index.insert(1, &nodes[0]));
+    EXPECT_TRUE(index.insert(2, &nodes[1]));
+    EXPECT_TRUE(index.insert(0, &nodes[2]));  // Id 0 is a valid key
+
+    EXPECT_EQ(index.size(), 3u);
+    EXPECT_EQ(index.find(1), &nodes[0]);
+    EXPECT_EQ(index.find(2), &nodes[1]);
+    EXPECT_EQ(index.find(0), &nodes[2]);
+    EXPECT_EQ(index.find(3), nullptr);
+}
+
+TEST(OrderIdIndexTest, Insert_DuplicateId_Fails) {
+    auto nodes = makeNodes(2);
+    OrderIdIndex index;
+
+    EXPECT_TRUE(index.insert(42, &nodes[0]));
+    EXPECT_FALSE(index.insert(42, &nodes[1]));
+    EXPECT_EQ(index.find(42), &nodes[0]);
+    EXPECT_EQ(index.size(), 1u);
+}
+
+TEST(OrderIdIndexTest, Erase_RemovesOnlyThatId) {
+    auto nodes = makeNodes(2);
+    OrderIdIndex index;
+    index.insert(7, &nodes[0]);
+    index.insert(8, &nodes[1]);
+
+    EXPECT_TRUE(index.erase(7));
+    EXPECT_FALSE(index.erase(7));
+    EXPECT_EQ(index.find(7), nullptr);
+    EXPECT_EQ(index.find(8), &nodes[1]);
+    EXPECT_EQ(index.size(), 1u);
+}
+
+TEST(OrderIdIndexTest, Growth_KeepsAllEntries) {
+    auto nodes = makeNodes(10000);
+    OrderIdIndex index;
+    for (OrderId id = 0; id < nodes.size(); ++id) {
+        ASSERT_TRUE(index.insert(1000000 + id, &nodes[id]));
+    }
+
+    EXPECT_EQ(index.size(), nodes.size());
+    EXPECT_GE(index.capacity(), nodes.size() * 2);
+    for (OrderId id = 0; id < nodes.size(); ++id) {
+        ASSERT_EQ(index.find(1000000 + id), &nodes[id]);
+    }
+}
+
+TEST(OrderIdIndexTest, Clear_KeepsCapacity) {
+    auto nodes = makeNodes(100);
+    OrderIdIndex index(100);
+    size_t capacity = index.capacity();
+    for (OrderId id = 0; id < nodes.size(); ++id) index.insert(id, &nodes[id]);
+
+    index.clear();
+
+    EXPECT_TRUE(index.empty());
+    EXPECT_EQ(index.capacity(), capacity);
+    EXPECT_EQ(index.find(5), nullptr);
+    EXPECT_TRUE(index.insert(5, &nodes[5]));
+}
+
+// ============================================================================
+// BACKWARD-SHIFT DELETION
+// ============================================================================
+
+TEST(OrderIdIndexTest, RandomChurn_MatchesReferenceMap) {
+    // Long insert/erase churn in a small table exercises wrap-around probe
+    // runs; every surviving id must stay reachable after each backward shift
+    auto nodes = makeNodes(512);
+    OrderIdIndex index;
+    std::unordered_map<OrderId, RestingOrder*> reference;
+    std::mt19937_64 rng(7);
+
+    for (int step = 0; step < 50000; ++step) {
+        OrderId id = rng() % 512;
+        if (rng() % 2 == 0) {
+            bool inserted = reference.emplace(id, &nodes[id]).second;
+            EXPECT_EQ(index.insert(id, &nodes[id]), inserted);
+        } else {
+            bool erased = reference.erase(id) > 0;
+            EXPECT_EQ(index.erase(id), erased);
+        }
+    }
+
+    EXPECT_EQ(index.size(), reference.size());
+    for (OrderId id = 0; id < 512; ++id) {
+        auto it = reference.find(id);
+        EXPECT_EQ(index.find(id), it == reference.end() ? nullptr : it->second);
+    }
+}
+
+TEST(OrderIdIndexTest, AliasedIdRanges_StayReachable) {
+    // A long-lived block of old ids plus a sliding window of new ids far
+    // above it - the pattern of a deep initial book under live order flow
+    auto nodes = makeNodes(600);
+    OrderIdIndex index;
+    for (OrderId id = 0; id < 500; ++id) {
+        index.insert(id, &nodes[id]);
+    }
+
+    OrderId base = OrderId(1) << 32;
+    for (OrderId id = 0; id < 20000; ++id) {
+        ASSERT_TRUE(index.insert(base + id, &nodes[500 + id % 100]));
+        if (id >= 100) {
+            ASSERT_TRUE(index.erase(base + id - 100));
+        }
+    }
+
+    EXPECT_EQ(index.size(), 600u);
+    for (OrderId id = 0; id < 500; ++id) {
+        ASSERT_EQ(index.find(id), &nodes[id]);
+    }
+    EXPECT_EQ(index.find(base + 19999), &nodes[599]);
+    EXPECT_EQ(index.find(base + 19899), nullptr);
+}
@@ -120,6 +120,36 @@ TEST(OrderQueueTest, PopWithTimeout_OrderArrives_ReturnsImmediately) {
     EXPECT_LT(elapsed.count(), 100);  // Should return quickly
 }
 
+// ============================================================================
+// BATCH TESTS
+// ============================================================================
+
+TEST(OrderQueueTest, PopBatch_DrainsUpToMaxInOrder) {
+    OrderQueue queue;
+    for (OrderId id = 1; id <= 5; ++id) {
+        queue.push(Order(id, Side::BUY, OrderType::LIMIT, 100.0, 100));
+    }
+    
+    std::vector<Order> batch;
+    EXPECT_EQ(queue.popBatch(batch, 3, 100), 3u);
+    ASSERT_EQ(batch.size(), 3u);
+    EXPECT_EQ(batch[0].getId(), 1u);
+    EXPECT_EQ(batch[2].getId(), 3u);
+    
+    EXPECT_EQ(queue.popBatch(batch, 3, 100), 2u);  // Replaces, not appends
+    ASSERT_EQ(batch.size(), 2u);
+    EXPECT_EQ(batch[0].getId(), 4u);
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(OrderQueueTest, PopBatch_EmptyQueue_TimesOut) {
+    OrderQueue queue;
+    std::vector<Order> batch;
+    
+    EXPECT_EQ(queue.popBatch(batch, 8, 20), 0u);
+    EXPECT_TRUE(batch.empty());
+}
+
 // ============================================================================
 // SHUTDOWN TESTS
 // ============================================================================
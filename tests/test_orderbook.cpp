@@ -19,7 +19,7 @@ TEST(OrderBookTest, AddOrder_SingleBid_SucceedsAndVisible) {
     
     auto bestBid = book.getBestBid();
     ASSERT_TRUE(bestBid.has_value());
-    EXPECT_DOUBLE_EQ(*bestBid, 100.0);
+    EXPECT_EQ(*bestBid, Price(100.0));
 }
 
 TEST(OrderBookTest, AddOrder_SingleAsk_SucceedsAndVisible) {
@@ -30,7 +30,7 @@ TEST(OrderBookTest, AddOrder_SingleAsk_SucceedsAndVisible) {
     
     auto bestAsk = book.getBestAsk();
     ASSERT_TRUE(bestAsk.has_value());
-    EXPECT_DOUBLE_EQ(*bestAsk, 105.0);
+    EXPECT_EQ(*bestAsk, Price(105.0));
 }
 
 TEST(OrderBookTest, AddOrder_DuplicateId_Fails) {
@@ -50,7 +50,7 @@ TEST(OrderBookTest, AddOrder_MultipleBids_SortedDescending) {
     
     auto bestBid = book.getBestBid();
     ASSERT_TRUE(bestBid.has_value());
-    EXPECT_DOUBLE_EQ(*bestBid, 101.0);  // Highest bid first
+    EXPECT_EQ(*bestBid, Price(101.0));  // Highest bid first
 }
 
 TEST(OrderBookTest, AddOrder_MultipleAsks_SortedAscending) {
@@ -61,7 +61,7 @@ TEST(OrderBookTest, AddOrder_MultipleAsks_SortedAscending) {
     
     auto bestAsk = book.getBestAsk();
     ASSERT_TRUE(bestAsk.has_value());
-    EXPECT_DOUBLE_EQ(*bestAsk, 101.0);  // Lowest ask first
+    EXPECT_EQ(*bestAsk, Price(101.0));  // Lowest ask first
 }
 
 // ============================================================================
@@ -91,7 +91,43 @@ TEST(OrderBookTest, CancelOrder_RemovesPriceLevelIfEmpty) {
     
     auto bestBid = book.getBestBid();
     ASSERT_TRUE(bestBid.has_value());
-    EXPECT_DOUBLE_EQ(*bestBid, 99.0);  // Now 99.0 is best
+    EXPECT_EQ(*bestBid, Price(99.0));  // Now 99.0 is best
+}
+
+TEST(OrderBookTest, CancelOrder_MiddleOfQueue_KeepsFifoOrder) {
+    OrderBook book;
+    book.addOrder(Order(1, Side::SELL, OrderType::LIMIT, 100.0, 100));
+    book.addOrder(Order(2, Side::SELL, OrderType::LIMIT, 100.0, 100));
+    book.addOrder(Order(3, Side::SELL, OrderType::LIMIT, 100.0, 100));
+    
+    EXPECT_TRUE(book.cancelOrder(2));
+    EXPECT_EQ(book.getQuantityAtPrice(Side::SELL, 100.0), 200u);
+    
+    // Order 1 fills first, then order 3 starts filling
+    EXPECT_EQ(book.fillQuantityAtPrice(Side::SELL, 100.0, 150), 150u);
+    EXPECT_EQ(book.getOrder(1), nullptr);  // Fully filled orders leave the book
+    ASSERT_NE(book.getOrder(3), nullptr);
+    EXPECT_EQ(book.getOrder(3)->getRemainingQty(), 50u);
+}
+
+TEST(OrderBookTest, CancelOrder_HeadAndTail_LevelStaysConsistent) {
+    OrderBook book;
+    for (OrderId id = 1; id <= 4; ++id) {
+        book.addOrder(Order(id, Side::BUY, OrderType::LIMIT, 100.0, 10));
+    }
+    
+    EXPECT_TRUE(book.cancelOrder(1));  // Head
+    EXPECT_TRUE(book.cancelOrder(4));  // Tail
+    EXPECT_FALSE(book.cancelOrder(4)); // Already cancelled
+    EXPECT_EQ(book.getQuantityAtPrice(Side::BUY, 100.0), 20u);
+    
+    // New order goes behind the survivors
+    book.addOrder(Order(5, Side::BUY, OrderType::LIMIT, 100.0, 10));
+    EXPECT_EQ(book.fillQuantityAtPrice(Side::BUY, 100.0, 20), 20u);
+    EXPECT_EQ(book.getOrder(2), nullptr);
+    EXPECT_EQ(book.getOrder(3), nullptr);
+    ASSERT_NE(book.getOrder(5), nullptr);
+    EXPECT_EQ(book.getOrder(5)->getRemainingQty(), 10u);
 }
 
 // ============================================================================
@@ -105,7 +141,7 @@ TEST(OrderBookTest, GetSpread_ValidBidAndAsk_ReturnsCorrectSpread) {
     
     auto spread = book.getSpread();
     ASSERT_TRUE(spread.has_value());
-    EXPECT_DOUBLE_EQ(*spread, 1.5);
+    EXPECT_EQ(*spread, Price(1.5));
 }
 
 TEST(OrderBookTest, GetSpread_NoBids_ReturnsEmpty) {
@@ -164,9 +200,9 @@ TEST(OrderBookTest, GetTopBids_ReturnsCorrectLevels) {
     auto bids = book.getTopBids(2);
     
     ASSERT_EQ(bids.size(), 2);
-    EXPECT_DOUBLE_EQ(bids[0].first, 100.0);  // Highest first
+    EXPECT_EQ(bids[0].first, Price(100.0));  // Highest first
     EXPECT_EQ(bids[0].second, 100);
-    EXPECT_DOUBLE_EQ(bids[1].first, 99.0);
+    EXPECT_EQ(bids[1].first, Price(99.0));
     EXPECT_EQ(bids[1].second, 200);
 }
 
@@ -179,9 +215,9 @@ TEST(OrderBookTest, GetTopAsks_ReturnsCorrectLevels) {
     auto asks = book.getTopAsks(2);
     
     ASSERT_EQ(asks.size(), 2);
-    EXPECT_DOUBLE_EQ(asks[0].first, 101.0);  // Lowest first
+    EXPECT_EQ(asks[0].first, Price(101.0));  // Lowest first
     EXPECT_EQ(asks[0].second, 200);
-    EXPECT_DOUBLE_EQ(asks[1].first, 102.0);
+    EXPECT_EQ(asks[1].first, Price(102.0));
     EXPECT_EQ(asks[1].second, 100);
 }
 
@@ -206,3 +242,419 @@ TEST(OrderBookTest, GetBidLevelCount_ReturnsCorrectCount) {
     
     EXPECT_EQ(book.getBidLevelCount(), 2);  // 2 price levels
 }
+
+// ============================================================================
+// TICK ARRAY BACKEND TESTS
+// ============================================================================
+
+static OrderBookConfig tickArrayConfig(size_t levels = 16) {
+    OrderBookConfig config;
+    config.backend = BookBackend::TICK_ARRAY;
+    config.tickSize = 0.05;
+    config.tickLevels = levels;
+    return config;
+}
+
+TEST(OrderBookTickArrayTest, BestPrices_TrackedAcrossAddAndCancel) {
+    OrderBook book(tickArrayConfig());
+    book.addOrder(Order(1, Side::BUY, OrderType::LIMIT, 99.95, 100));
+    book.addOrder(Order(2, Side::BUY, OrderType::LIMIT, 100.00, 100));
+    book.addOrder(Order(3, Side::SELL, OrderType::LIMIT, 100.10, 100));
+    book.addOrder(Order(4, Side::SELL, OrderType::LIMIT, 100.05, 100));
+    
+    EXPECT_EQ(book.getBackend(), BookBackend::TICK_ARRAY);
+    EXPECT_EQ(*book.getBestBid(), Price(100.00));
+    EXPECT_EQ(*book.getBestAsk(), Price(100.05));
+    
+    book.cancelOrder(2);
+    book.cancelOrder(4);
+    
+    EXPECT_EQ(*book.getBestBid(), Price(99.95));
+    EXPECT_EQ(*book.getBestAsk(), Price(100.10));
+}
+
+TEST(OrderBookTickArrayTest, OffGridPrice_Rejected) {
+    OrderBook book(tickArrayConfig());
+    
+    EXPECT_FALSE(book.addOrder(Order(1, Side::BUY, OrderType::LIMIT, 100.03, 100)));
+    EXPECT_EQ(book.getTotalOrderCount(), 0);
+}
+
+TEST(OrderBookTickArrayTest, PricesOutsideWindow_RebaseKeepsLevels) {
+    OrderBookConfig config = tickArrayConfig(4);  // Tiny window forces rebasing
+    config.maxTickLevelsFactor = 256;             // ...up to 1024 ticks ($51.20)
+    OrderBook book(config);
+    book.addOrder(Order(1, Side::SELL, OrderType::LIMIT, 100.00, 10));
+    book.addOrder(Order(2, Side::SELL, OrderType::LIMIT, 110.00, 20));
+    book.addOrder(Order(3, Side::SELL, OrderType::LIMIT, 90.00, 30));
+    
+    auto asks = book.getTopAsks(5);
+    ASSERT_EQ(asks.size(), 3);
+    EXPECT_EQ(asks[0].first, Price(90.00));
+    EXPECT_EQ(asks[0].second, 30);
+    EXPECT_EQ(asks[1].first, Price(100.00));
+    EXPECT_EQ(asks[2].first, Price(110.00));
+}
+
+TEST(OrderBookTickArrayTest, PriceBeyondMaxWindow_RejectedWithoutGrowing) {
+    OrderBook book(tickArrayConfig());  // 16 slots, at most 256 ($12.80)
+    ASSERT_TRUE(book.addOrder(Order(1, Side::SELL, OrderType::LIMIT, 100.00, 10)));
+    
+    // Up to the cap the window still grows
+    EXPECT_TRUE(book.addOrder(Order(2, Side::SELL, OrderType::LIMIT, 112.75, 10)));
+    
+    // A stray order millions of ticks away must not size the array to reach it
+    EXPECT_FALSE(book.addOrder(Order(3, Side::SELL, OrderType::LIMIT, 1000000.00, 10)));
+    EXPECT_FALSE(book.addOrder(Order(4, Side::SELL, OrderType::LIMIT, 112.80, 10)));
+    EXPECT_FALSE(book.modifyOrderPrice(1, 1000000.00));
+    EXPECT_EQ(book.getTotalOrderCount(), 2);
+    EXPECT_EQ(book.getAskLevelCount(), 2);
+    EXPECT_EQ(*book.getBestAsk(), Price(100.00));
+    
+    // An empty side re-centres on any price
+    book.cancelOrder(1);
+    book.cancelOrder(2);
+    EXPECT_TRUE(book.addOrder(Order(5, Side::SELL, OrderType::LIMIT, 1000000.00, 10)));
+    EXPECT_EQ(*book.getBestAsk(), Price(1000000.00));
+}
+
+TEST(OrderBookTickArrayTest, FillQuantityAtPrice_RemovesEmptyLevel) {
+    OrderBook book(tickArrayConfig());
+    book.addOrder(Order(1, Side::SELL, OrderType::LIMIT, 100.05, 50));
+    book.addOrder(Order(2, Side::SELL, OrderType::LIMIT, 100.10, 70));
+    
+    EXPECT_EQ(book.fillQuantityAtPrice(Side::SELL, 100.05, 80), 50);
+    EXPECT_EQ(book.getAskLevelCount(), 1);
+    EXPECT_EQ(*book.getBestAsk(), Price(100.10));
+}
+
+TEST(OrderBookTickArrayTest, Clear_EmptiesBothSides) {
+    OrderBook book(tickArrayConfig());
+    book.addOrder(Order(1, Side::BUY, OrderType::LIMIT, 100.00, 100));
+    book.addOrder(Order(2, Side::SELL, OrderType::LIMIT, 100.05, 100));
+    
+    book.clear();
+    
+    EXPECT_FALSE(book.getBestBid().has_value());
+    EXPECT_FALSE(book.getBestAsk().has_value());
+    EXPECT_TRUE(book.addOrder(Order(3, Side::BUY, OrderType::LIMIT, 250.00, 100)));
+    EXPECT_EQ(*book.getBestBid(), Price(250.00));
+}
+
+// ============================================================================
+// ORDER POOL TESTS
+// ============================================================================
+
+namespace {
+OrderBookConfig pooledConfig(size_t orderCapacity) {
+    OrderBookConfig config;
+    config.orderCapacity = orderCapacity;
+    return config;
+}
+} // namespace
+
+TEST(OrderBookPoolTest, Stats_TrackAddFillAndCancel) {
+    OrderBook book(pooledConfig(16));
+    book.addOrder(Order(1, Side::BUY, OrderType::LIMIT, 100.0, 100));
+    book.addOrder(Order(2, Side::BUY, OrderType::LIMIT, 99.0, 100));
+    book.addOrder(Order(3, Side::SELL, OrderType::LIMIT, 101.0, 100));
+    
+    auto stats = book.getPoolStats();
+    EXPECT_EQ(stats.inUse, 3u);
+    EXPECT_EQ(stats.highWater, 3u);
+    EXPECT_EQ(stats.capacity, 16u);
+    
+    book.cancelOrder(2);
+    book.fillQuantityAtPrice(Side::SELL, 101.0, 100);
+    
+    stats = book.getPoolStats();
+    EXPECT_EQ(stats.inUse, 1u);
+    EXPECT_EQ(stats.highWater, 3u);
+    EXPECT_EQ(book.getTotalOrderCount(), 1u);
+    EXPECT_EQ(book.getOrder(2), nullptr);  // Cancelled orders leave the book
+}
+
+TEST(OrderBookPoolTest, SteadyState_ReusesNodesWithoutGrowing) {
+    OrderBook book(pooledConfig(8));
+    for (OrderId id = 1; id <= 1000; ++id) {
+        book.addOrder(Order(id, Side::BUY, OrderType::LIMIT, 100.0, 10));
+        if (id > 4) {
+            book.cancelOrder(id - 4);
+        }
+    }
+    
+    auto stats = book.getPoolStats();
+    EXPECT_EQ(stats.inUse, 4u);
+    EXPECT_EQ(stats.highWater, 5u);
+    EXPECT_EQ(stats.capacity, 8u);
+    EXPECT_EQ(stats.slabs, 1u);
+}
+
+TEST(OrderBookPoolTest, BeyondCapacityHint_GrowsBySlab) {
+    OrderBook book(pooledConfig(4));
+    for (OrderId id = 1; id <= 10; ++id) {
+        book.addOrder(Order(id, Side::SELL, OrderType::LIMIT, 100.0 + id, 10));
+    }
+    
+    auto stats = book.getPoolStats();
+    EXPECT_EQ(stats.inUse, 10u);
+    EXPECT_GE(stats.capacity, 10u);
+    EXPECT_GT(stats.slabs, 1u);
+    EXPECT_EQ(book.getQuantityAtPrice(Side::SELL, 101.0), 10u);
+    EXPECT_EQ(book.getQuantityAtPrice(Side::SELL, 110.0), 10u);
+}
+
+TEST(OrderBookPoolTest, Clear_ReturnsAllNodes) {
+    OrderBook book(pooledConfig(4));
+    for (OrderId id = 1; id <= 6; ++id) {
+        book.addOrder(Order(id, Side::BUY, OrderType::LIMIT, 100.0, 10));
+    }
+    size_t capacity = book.getPoolStats().capacity;
+    
+    book.clear();
+    
+    auto stats = book.getPoolStats();
+    EXPECT_EQ(stats.inUse, 0u);
+    EXPECT_EQ(stats.highWater, 6u);
+    EXPECT_EQ(stats.capacity, capacity);
+    
+    // Slots are reusable after clear
+    for (OrderId id = 1; id <= 6; ++id) {
+        EXPECT_TRUE(book.addOrder(Order(id, Side::BUY, OrderType::LIMIT, 100.0, 10)));
+    }
+    EXPECT_EQ(book.getPoolStats().capacity, capacity);
+    EXPECT_EQ(book.getQuantityAtPrice(Side::BUY, 100.0), 60u);
+}
+
+// ============================================================================
+// SNAPSHOT TESTS
+// ============================================================================
+
+TEST(OrderBookSnapshotTest, MatchesIndividualGetters) {
+    OrderBook book;
+    book.addOrder(Order(1, Side::BUY, OrderType::LIMIT, 99.0, 100));
+    book.addOrder(Order(2, Side::BUY, OrderType::LIMIT, 99.0, 50));
+    book.addOrder(Order(3, Side::BUY, OrderType::LIMIT, 98.0, 70));
+    book.addOrder(Order(4, Side::SELL, OrderType::LIMIT, 101.0, 30));
+    
+    BookSnapshot snap;
+    book.snapshot(10, snap);
+    
+    ASSERT_EQ(snap.bidCount, 2u);
+    ASSERT_EQ(snap.askCount, 1u);
+    EXPECT_EQ(snap.bids[0].price, Price(99.0));
+    EXPECT_EQ(snap.bids[0].quantity, 150);
+    EXPECT_EQ(snap.bids[1].price, Price(98.0));
+    EXPECT_EQ(snap.asks[0].quantity, 30);
+    EXPECT_EQ(snap.bestBid, book.getBestBid());
+    EXPECT_EQ(snap.bestAsk, book.getBestAsk());
+    EXPECT_EQ(snap.spread, book.getSpread());
+    EXPECT_EQ(snap.bidLevels, 2u);
+    EXPECT_EQ(snap.askLevels, 1u);
+    EXPECT_EQ(snap.orderCount, 4u);
+}
+
+TEST(OrderBookSnapshotTest, EmptySide_HasNoBestOrSpread) {
+    OrderBook book;
+    book.addOrder(Order(1, Side::BUY, OrderType::LIMIT, 99.0, 100));
+    
+    BookSnapshot snap;
+    book.snapshot(5, snap);
+    
+    EXPECT_TRUE(snap.bestBid.has_value());
+    EXPECT_FALSE(snap.bestAsk.has_value());
+    EXPECT_FALSE(snap.spread.has_value());
+    EXPECT_EQ(snap.askCount, 0u);
+}
+
+TEST(OrderBookSnapshotTest, Depth_LimitsCopiedLevelsNotTotals) {
+    OrderBook book;
+    for (int i = 0; i < 50; ++i) {
+        book.addOrder(Order(i + 1, Side::BUY, OrderType::LIMIT, 100.0 - i, 10));
+    }
+    
+    BookSnapshot snap;
+    book.snapshot(3, snap);
+    EXPECT_EQ(snap.bidCount, 3u);
+    EXPECT_EQ(snap.bidLevels, 50u);
+    
+    book.snapshot(1000, snap);  // Capped at the fixed capacity
+    EXPECT_EQ(snap.bidCount, BookSnapshot::MAX_DEPTH);
+    EXPECT_EQ(snap.bids[BookSnapshot::MAX_DEPTH - 1].price, Price(100.0 - 31));
+}
+
+TEST(OrderBookSnapshotTest, Sequence_AdvancesOnChangesOnly) {
+    OrderBook book;
+    BookSnapshot snap;
+    book.snapshot(0, snap);
+    uint64_t start = snap.sequence;
+    
+    book.addOrder(Order(1, Side::SELL, OrderType::LIMIT, 101.0, 100));
+    uint64_t afterAdd = book.getSequence();
+    EXPECT_GT(afterAdd, start);
+    
+    // Reads and failed operations leave it alone
+    book.getTopAsks();
+    EXPECT_FALSE(book.cancelOrder(99));
+    EXPECT_EQ(book.getSequence(), afterAdd);
+    
+    book.fillQuantityAtPrice(Side::SELL, 101.0, 40);
+    uint64_t afterFill = book.getSequence();
+    EXPECT_GT(afterFill, afterAdd);
+    
+    EXPECT_TRUE(book.cancelOrder(1));
+    book.snapshot(0, snap);
+    EXPECT_GT(snap.sequence, afterFill);
+}
+
+// ============================================================================
+// CHANGE SET TESTS
+// ============================================================================
+
+namespace {
+
+OrderBookConfig trackingConfig() {
+    OrderBookConfig config;
+    config.trackLevelChanges = true;
+    return config;
+}
+
+} // namespace
+
+TEST(OrderBookChangeSetTest, Disabled_ReportsNothing) {
+    OrderBook book;
+    book.addOrder(Order(1, Side::BUY, OrderType::LIMIT, 100.0, 10));
+    
+    std::vector<LevelChange> changes;
+    book.takeLevelChanges(changes);
+    EXPECT_TRUE(changes.empty());
+}
+
+TEST(OrderBookChangeSetTest, ClassifiesAddedChangedRemoved) {
+    OrderBook book(trackingConfig());
+    book.addOrder(Order(1, Side::BUY, OrderType::LIMIT, 100.0, 10));
+    book.addOrder(Order(2, Side::SELL, OrderType::LIMIT, 101.0, 20));
+    book.addOrder(Order(3, Side::SELL, OrderType::LIMIT, 102.0, 30));
+    
+    std::vector<LevelChange> changes;
+    book.takeLevelChanges(changes);
+    ASSERT_EQ(changes.size(), 3u);
+    EXPECT_EQ(changes[0].type, LevelChangeType::ADDED);
+    EXPECT_EQ(changes[0].side, Side::BUY);
+    EXPECT_EQ(changes[1].price, Price(101.0));  // Asks best first
+    EXPECT_EQ(changes[2].price, Price(102.0));
+    EXPECT_EQ(changes[2].quantity, 30u);
+    
+    book.fillQuantityAtPrice(Side::SELL, 101.0, 5);
+    book.cancelOrder(3);
+    book.takeLevelChanges(changes);
+    ASSERT_EQ(changes.size(), 2u);
+    EXPECT_EQ(changes[0].type, LevelChangeType::CHANGED);
+    EXPECT_EQ(changes[0].quantity, 15u);
+    EXPECT_EQ(changes[1].type, LevelChangeType::REMOVED);
+    EXPECT_EQ(changes[1].quantity, 0u);
+    
+    // Taken changes are not reported again
+    book.takeLevelChanges(changes);
+    EXPECT_TRUE(changes.empty());
+}
+
+TEST(OrderBookChangeSetTest, CoalescesAndDropsNetZero) {
+    OrderBook book(trackingConfig());
+    book.addOrder(Order(1, Side::BUY, OrderType::LIMIT, 100.0, 10));
+    std::vector<LevelChange> changes;
+    book.takeLevelChanges(changes);
+    
+    // Many touches to one level -> one entry with the final total
+    book.addOrder(Order(2, Side::BUY, OrderType::LIMIT, 100.0, 5));
+    book.modifyOrderQuantity(2, 8);
+    book.addOrder(Order(3, Side::BUY, OrderType::LIMIT, 100.0, 2));
+    // Added then removed within the interval -> nothing to report
+    book.addOrder(Order(4, Side::BUY, OrderType::LIMIT, 99.0, 7));
+    book.cancelOrder(4);
+    
+    book.takeLevelChanges(changes);
+    ASSERT_EQ(changes.size(), 1u);
+    EXPECT_EQ(changes[0].type, LevelChangeType::CHANGED);
+    EXPECT_EQ(changes[0].quantity, 20u);
+}
+
+TEST(OrderBookChangeSetTest, Clear_ReportsEveryLevelRemoved) {
+    OrderBook book(trackingConfig());
+    book.addOrder(Order(1, Side::BUY, OrderType::LIMIT, 100.0, 10));
+    book.addOrder(Order(2, Side::SELL, OrderType::LIMIT, 101.0, 10));
+    std::vector<LevelChange> changes;
+    book.takeLevelChanges(changes);
+    
+    book.clear();
+    book.takeLevelChanges(changes);
+    ASSERT_EQ(changes.size(), 2u);
+    EXPECT_EQ(changes[0].type, LevelChangeType::REMOVED);
+    EXPECT_EQ(changes[1].type, LevelChangeType::REMOVED);
+}
+
+// ============================================================================
+// IN-PLACE LEVEL UPDATE TESTS
+// ============================================================================
+
+TEST(OrderBookUpdateLevelsTest, AddsRemovesAndResizes) {
+    OrderBook book(trackingConfig());
+    OrderId nextId = 100;
+    BookSnapshot::Level first[] = {{100.0, 10}, {99.95, 20}, {99.90, 30}};
+    book.updateLevels(Side::BUY, first, 3, nextId);
+    EXPECT_EQ(book.getBidLevelCount(), 3u);
+    EXPECT_EQ(nextId, 103u);
+    
+    std::vector<LevelChange> changes;
+    book.takeLevelChanges(changes);
+    EXPECT_EQ(changes.size(), 3u);
+    
+    // Window moves down a tick; 99.95 keeps its size, 99.90 is resized
+    BookSnapshot::Level second[] = {{99.95, 20}, {99.90, 35}, {99.85, 40}};
+    book.updateLevels(Side::BUY, second, 3, nextId);
+    EXPECT_EQ(nextId, 104u);  // Only the new level needed an order
+    EXPECT_EQ(book.getBestBid(), Price(99.95));
+    EXPECT_EQ(book.getQuantityAtPrice(Side::BUY, 99.90), 35u);
+    EXPECT_EQ(book.getQuantityAtPrice(Side::BUY, 100.0), 0u);
+    EXPECT_EQ(book.getTotalOrderCount(), 3u);
+    
+    book.takeLevelChanges(changes);
+    ASSERT_EQ(changes.size(), 3u);
+    EXPECT_EQ(changes[0].type, LevelChangeType::REMOVED);   // 100.00
+    EXPECT_EQ(changes[1].type, LevelChangeType::CHANGED);   // 99.90
+    EXPECT_EQ(changes[2].type, LevelChangeType::ADDED);     // 99.85
+}
+
+TEST(OrderBookUpdateLevelsTest, ResizeTrimsLevelToOneOrder) {
+    OrderBook book;
+    book.addOrder(Order(1, Side::SELL, OrderType::LIMIT, 101.0, 10));
+    book.addOrder(Order(2, Side::SELL, OrderType::LIMIT, 101.0, 10));
+    book.fillQuantityAtPrice(Side::SELL, 101.0, 4);  // Head partly filled
+    
+    OrderId nextId = 100;
+    BookSnapshot::Level target[] = {{101.0, 50}};
+    book.updateLevels(Side::SELL, target, 1, nextId);
+    
+    EXPECT_EQ(book.getQuantityAtPrice(Side::SELL, 101.0), 50u);
+    EXPECT_EQ(book.getTotalOrderCount(), 1u);
+    ASSERT_NE(book.getOrder(1), nullptr);
+    EXPECT_EQ(book.getOrder(1)->getRemainingQty(), 50u);
+    EXPECT_EQ(book.getOrder(2), nullptr);
+}
+
+TEST(OrderBookUpdateLevelsTest, Unchanged_LeavesBookAndSequenceAlone) {
+    OrderBook book;
+    OrderId nextId = 1;
+    BookSnapshot::Level target[] = {{101.0, 10}, {101.05, 20}};
+    book.updateLevels(Side::SELL, target, 2, nextId);
+    uint64_t sequence = book.getSequence();
+    size_t capacity = book.getPoolStats().capacity;
+    
+    for (int i = 0; i < 100; ++i) {
+        book.updateLevels(Side::SELL, target, 2, nextId);
+    }
+    EXPECT_EQ(book.getSequence(), sequence);
+    EXPECT_EQ(nextId, 3u);
+    EXPECT_EQ(book.getPoolStats().capacity, capacity);
+    EXPECT_EQ(book.getTopOfBook().askSize, 10u);
+}
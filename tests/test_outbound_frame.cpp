@@ -0,0 +1,97 @@
+// ============================================================================
+// TEST_OUTBOUND_FRAME.CPP - Unit tests for refcounted outbound frames
+// ============================================================================
+
+#include <gtest/gtest.h>
+#include "OutboundFrame.h"
+#include "SessionState.h"
+#include <thread>
+#include <vector>
+
+using namespace orderbook;
+
+// ============================================================================
+// LAYOUT
+// ============================================================================
+
+TEST(OutboundFrameTest, PayloadFollowsHeadroom) {
+    FrameRef frame = FrameRef::copyOf("hello", true);
+    EXPECT_EQ(frame->payload(), "hello");
+    EXPECT_EQ(frame->size(), 5u);
+    EXPECT_TRUE(frame->isBinary());
+    EXPECT_EQ(frame->buffer().size(), OutboundFrame::HEADROOM + 5);
+    EXPECT_EQ(reinterpret_cast<const char*>(frame->wireData()), frame->data());
+    EXPECT_EQ(frame->data() - frame->buffer().data(), static_cast<ptrdiff_t>(OutboundFrame::HEADROOM));
+}
+
+TEST(OutboundFrameTest, Reset_KeepsAllocation) {
+    FrameRef frame = FrameRef::create(false);
+    frame->buffer().append(4096, 'x');
+    const char* storage = frame->buffer().data();
+
+    frame->reset(true);
+    EXPECT_TRUE(frame->empty());
+    EXPECT_TRUE(frame->isBinary());
+    frame->buffer().append(4096, 'y');
+    EXPECT_EQ(frame->buffer().data(), storage);
+}
+
+// ============================================================================
+// SHARING
+// ============================================================================
+
+TEST(OutboundFrameTest, Copies_SharePayload) {
+    FrameRef frame = FrameRef::copyOf("tick", false);
+    EXPECT_FALSE(frame->isShared());
+    {
+        std::vector<FrameRef> queues(3, frame);  // A broadcast to three clients
+        EXPECT_TRUE(frame->isShared());
+        for (const FrameRef& queued : queues) {
+            EXPECT_EQ(queued->data(), frame->data());
+        }
+    }
+    EXPECT_FALSE(frame->isShared());
+
+    FrameRef moved = std::move(frame);
+    EXPECT_FALSE(frame);
+    EXPECT_FALSE(moved->isShared());
+}
+
+TEST(OutboundFrameTest, ReleasedFromOtherThreads) {
+    FrameRef frame = FrameRef::copyOf("payload", false);
+    std::vector<std::thread> writers;
+    for (int i = 0; i < 4; ++i) {
+        writers.emplace_back([copy = frame]() mutable {
+            EXPECT_EQ(copy->payload(), "payload");
+            copy = FrameRef();
+        });
+    }
+    for (std::thread& writer : writers) writer.join();
+    EXPECT_FALSE(frame->isShared());
+}
+
+// ============================================================================
+// SESSION TICK FRAME
+// ============================================================================
+
+TEST(OutboundFrameTest, SessionTickFrame_ReusedOnceReleased) {
+    SessionState session(1);
+    FrameRef first = session.acquireTickFrame(false);
+    first->buffer().append("tick one");
+    const OutboundFrame* firstFrame = &*first;
+
+    // Still queued: the next tick must not overwrite it
+    FrameRef second = session.acquireTickFrame(true);
+    EXPECT_NE(&*second, firstFrame);
+    EXPECT_EQ(first->payload(), "tick one");
+    EXPECT_TRUE(second->empty());
+    EXPECT_TRUE(second->isBinary());
+
+    // Written and dropped: the same storage comes back, emptied
+    const OutboundFrame* secondFrame = &*second;
+    second = FrameRef();
+    FrameRef third = session.acquireTickFrame(false);
+    EXPECT_EQ(&*third, secondFrame);
+    EXPECT_TRUE(third->empty());
+    EXPECT_FALSE(third->isBinary());
+}
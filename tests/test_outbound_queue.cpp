@@ -0,0 +1,178 @@
+// ============================================================================
+// TEST_OUTBOUND_QUEUE.CPP - Unit tests for tick conflation and slow consumers
+// ============================================================================
+
+#include <gtest/gtest.h>
+#include "OutboundQueue.h"
+#include "SessionState.h"
+#include <string>
+#include <vector>
+
+using namespace orderbook;
+
+namespace {
+
+FrameRef frame(const std::string& payload) {
+    return FrameRef::copyOf(payload, false);
+}
+
+// Payloads in the order the client would receive them
+std::vector<std::string> drain(OutboundQueue& queue) {
+    std::vector<std::string> sent;
+    while (FrameRef next = queue.pop()) {
+        sent.emplace_back(next->payload());
+    }
+    return sent;
+}
+
+} // namespace
+
+// ============================================================================
+// CONFLATION
+// ============================================================================
+
+TEST(OutboundQueueTest, Tick_ReplacesQueuedTick) {
+    OutboundQueue queue;
+    EXPECT_EQ(queue.push(frame("tick1"), FrameDelivery::CONFLATE), OutboundQueue::PushResult::QUEUED);
+    EXPECT_EQ(queue.push(frame("tick2"), FrameDelivery::CONFLATE), OutboundQueue::PushResult::CONFLATED);
+    EXPECT_EQ(queue.push(frame("tick3"), FrameDelivery::CONFLATE), OutboundQueue::PushResult::CONFLATED);
+
+    OutboundQueueStats stats = queue.getStats();
+    EXPECT_EQ(stats.queuedFrames, 1u);
+    EXPECT_EQ(stats.queuedBytes, 5u);
+    EXPECT_EQ(stats.conflated, 2u);
+    EXPECT_EQ(stats.lagTicks, 2u);
+    EXPECT_EQ(drain(queue), std::vector<std::string>{"tick3"});
+}
+
+TEST(OutboundQueueTest, MustDeliver_KeptInOrder) {
+    OutboundQueue queue;
+    queue.push(frame("tick1"), FrameDelivery::CONFLATE);
+    queue.push(frame("candleHistory"), FrameDelivery::ALWAYS);
+    queue.push(frame("tick2"), FrameDelivery::CONFLATE);
+    queue.push(frame("timeout"), FrameDelivery::ALWAYS);
+    queue.push(frame("tick3"), FrameDelivery::CONFLATE);
+
+    // The newest tick follows everything queued before it
+    EXPECT_EQ(drain(queue), (std::vector<std::string>{"candleHistory", "timeout", "tick3"}));
+    EXPECT_EQ(queue.getStats().queuedBytes, 0u);
+}
+
+TEST(OutboundQueueTest, SentTick_NotConflated) {
+    OutboundQueue queue;
+    queue.push(frame("tick1"), FrameDelivery::CONFLATE);
+    queue.push(frame("tick2"), FrameDelivery::CONFLATE);
+    EXPECT_EQ(queue.pop()->payload(), "tick2");
+    EXPECT_EQ(queue.getStats().lagTicks, 0u);  // Caught up
+
+    EXPECT_EQ(queue.push(frame("tick3"), FrameDelivery::CONFLATE), OutboundQueue::PushResult::QUEUED);
+    EXPECT_EQ(queue.getStats().conflated, 1u);
+}
+
+TEST(OutboundQueueTest, ConflatedFrame_ReleasedForReuse) {
+    OutboundQueue queue;
+    FrameRef tick = frame("tick1");
+    queue.push(tick, FrameDelivery::CONFLATE);
+    EXPECT_TRUE(tick->isShared());
+    queue.push(frame("tick2"), FrameDelivery::CONFLATE);
+    EXPECT_FALSE(tick->isShared());
+}
+
+// ============================================================================
+// SLOW CONSUMERS
+// ============================================================================
+
+TEST(OutboundQueueTest, SlowConsumer_AfterLagThreshold) {
+    OutboundQueueConfig config;
+    config.slowConsumerTicks = 3;
+    OutboundQueue queue(config);
+
+    queue.push(frame("t"), FrameDelivery::CONFLATE);
+    for (int i = 0; i < 2; ++i) queue.push(frame("t"), FrameDelivery::CONFLATE);
+    EXPECT_FALSE(queue.isSlowConsumer());
+    queue.push(frame("t"), FrameDelivery::CONFLATE);
+    EXPECT_TRUE(queue.isSlowConsumer());
+
+    queue.pop();
+    EXPECT_FALSE(queue.isSlowConsumer());  // Lag only counts while behind
+}
+
+TEST(OutboundQueueTest, SlowConsumer_DisabledWithZero) {
+    OutboundQueueConfig config;
+    config.slowConsumerTicks = 0;
+    OutboundQueue queue(config);
+    for (int i = 0; i < 1000; ++i) queue.push(frame("t"), FrameDelivery::CONFLATE);
+    EXPECT_FALSE(queue.isSlowConsumer());
+    EXPECT_EQ(queue.getStats().lagTicks, 999u);
+}
+
+TEST(OutboundQueueTest, Full_DropsAndMarksSlow) {
+    OutboundQueueConfig config;
+    config.maxFrames = 2;
+    config.slowConsumerTicks = 0;
+    OutboundQueue queue(config);
+
+    queue.push(frame("a"), FrameDelivery::ALWAYS);
+    queue.push(frame("b"), FrameDelivery::ALWAYS);
+
+    // A tick that does not fit is dropped and counts as lag
+    EXPECT_EQ(queue.push(frame("t"), FrameDelivery::CONFLATE), OutboundQueue::PushResult::DROPPED);
+    EXPECT_FALSE(queue.isSlowConsumer());
+    EXPECT_EQ(queue.getStats().lagTicks, 1u);
+
+    // A must-deliver frame that does not fit makes the client slow
+    EXPECT_EQ(queue.push(frame("c"), FrameDelivery::ALWAYS), OutboundQueue::PushResult::DROPPED);
+    EXPECT_TRUE(queue.isSlowConsumer());
+    EXPECT_EQ(queue.getStats().dropped, 2u);
+    EXPECT_EQ(drain(queue), (std::vector<std::string>{"a", "b"}));
+}
+
+TEST(OutboundQueueTest, Full_TickStillReplacesQueuedTick) {
+    OutboundQueueConfig config;
+    config.maxFrames = 2;
+    OutboundQueue queue(config);
+    queue.push(frame("a"), FrameDelivery::ALWAYS);
+    queue.push(frame("tick1"), FrameDelivery::CONFLATE);
+    EXPECT_EQ(queue.push(frame("tick2"), FrameDelivery::CONFLATE), OutboundQueue::PushResult::CONFLATED);
+    EXPECT_EQ(drain(queue), (std::vector<std::string>{"a", "tick2"}));
+}
+
+// ============================================================================
+// DELTA FEED
+// ============================================================================
+
+TEST(OutboundQueueTest, TickLost_OnlyForReplacedOrDroppedTicks) {
+    using Result = OutboundQueue::PushResult;
+    EXPECT_FALSE(OutboundQueue::tickLost(Result::QUEUED, FrameDelivery::CONFLATE));
+    EXPECT_TRUE(OutboundQueue::tickLost(Result::CONFLATED, FrameDelivery::CONFLATE));
+    EXPECT_TRUE(OutboundQueue::tickLost(Result::DROPPED, FrameDelivery::CONFLATE));
+    EXPECT_FALSE(OutboundQueue::tickLost(Result::DROPPED, FrameDelivery::ALWAYS));
+}
+
+TEST(OutboundQueueTest, DroppedDeltaTick_NextBookFrameIsSnapshot) {
+    OutboundQueueConfig config;
+    config.maxFrames = 2;
+    config.slowConsumerTicks = 0;
+    OutboundQueue queue(config);
+    SessionState session(1);
+    session.setBookFeedMode(BookFeedMode::DELTA);
+
+    BookFrame book;
+    ASSERT_TRUE(session.nextBookFrame(book));
+    EXPECT_TRUE(book.snapshot);  // First frame after subscribing
+    ASSERT_TRUE(session.nextBookFrame(book));
+    EXPECT_FALSE(book.snapshot);
+
+    // Queue full of must-deliver frames: the delta tick is dropped
+    queue.push(frame("candleHistory"), FrameDelivery::ALWAYS);
+    queue.push(frame("timeout"), FrameDelivery::ALWAYS);
+    OutboundQueue::PushResult result = queue.push(frame("delta"), FrameDelivery::CONFLATE);
+    ASSERT_EQ(result, OutboundQueue::PushResult::DROPPED);
+
+    // What the server does with the result
+    if (OutboundQueue::tickLost(result, FrameDelivery::CONFLATE)) {
+        session.requestBookResync();
+    }
+    ASSERT_TRUE(session.nextBookFrame(book));
+    EXPECT_TRUE(book.snapshot);
+}
@@ -0,0 +1,77 @@
+// ============================================================================
+// TEST_PRICE.CPP - Unit tests for the fixed-point Price type
+// ============================================================================
+
+#include <gtest/gtest.h>
+#include "OrderBook.h"
+#include <sstream>
+#include <iomanip>
+#include <unordered_set>
+
+using namespace orderbook;
+
+// ============================================================================
+// CONVERSION TESTS
+// ============================================================================
+
+TEST(PriceTest, FromDouble_RoundsToNearestRawUnit) {
+    EXPECT_EQ(Price(150.25).raw(), 1502500);
+    EXPECT_EQ(Price(0.00004).raw(), 0);
+    EXPECT_EQ(Price(0.00005).raw(), 1);
+    EXPECT_EQ(Price(-1.5).raw(), -15000);
+    EXPECT_DOUBLE_EQ(Price(150.25).toDouble(), 150.25);
+}
+
+TEST(PriceTest, FloatNoise_ComparesEqual) {
+    // 0.1 + 0.2 != 0.3 as doubles, but they are the same Price
+    EXPECT_EQ(Price(0.1 + 0.2), Price(0.3));
+    EXPECT_EQ(std::hash<Price>()(Price(0.1 + 0.2)), std::hash<Price>()(Price(0.3)));
+
+    std::unordered_set<Price> prices{Price(100.05), Price(100.0 + 0.05)};
+    EXPECT_EQ(prices.size(), 1u);
+}
+
+TEST(PriceTest, Stream_PrintsDecimalDollars) {
+    std::ostringstream oss;
+    oss << std::fixed << std::setprecision(2) << Price(99.95);
+    EXPECT_EQ(oss.str(), "99.95");
+}
+
+// ============================================================================
+// ARITHMETIC / TICK TESTS
+// ============================================================================
+
+TEST(PriceTest, Arithmetic_IsExact) {
+    Price p = 100.0;
+    for (int i = 0; i < 1000; ++i) p += DEFAULT_TICK_SIZE;
+    EXPECT_EQ(p, Price(150.0));
+    EXPECT_EQ(Price(100.10) - Price(100.05), DEFAULT_TICK_SIZE);
+    EXPECT_EQ(DEFAULT_TICK_SIZE * 3, Price(0.15));
+}
+
+TEST(PriceTest, RoundToTick_NearestMultiple) {
+    EXPECT_EQ(Price(100.02).roundToTick(DEFAULT_TICK_SIZE), Price(100.00));
+    EXPECT_EQ(Price(100.03).roundToTick(DEFAULT_TICK_SIZE), Price(100.05));
+    EXPECT_EQ(Price(100.025).roundToTick(DEFAULT_TICK_SIZE), Price(100.05));  // Half rounds away
+    EXPECT_EQ(Price(-0.03).roundToTick(DEFAULT_TICK_SIZE), Price(-0.05));
+    EXPECT_EQ(Price(12.34).roundToTick(0.01), Price(12.34));
+}
+
+TEST(PriceTest, IsOnTick_ExactCheck) {
+    EXPECT_TRUE(Price(100.05).isOnTick(DEFAULT_TICK_SIZE));
+    EXPECT_FALSE(Price(100.07).isOnTick(DEFAULT_TICK_SIZE));
+    EXPECT_EQ(Price(100.05).toTicks(DEFAULT_TICK_SIZE), 2001);
+}
+
+// ============================================================================
+// ORDER BOOK KEYING
+// ============================================================================
+
+TEST(PriceTest, OrderBook_FloatNoisePricesShareLevel) {
+    OrderBook book;
+    book.addOrder(Order(1, Side::BUY, OrderType::LIMIT, 0.1 + 0.2, 100));
+    book.addOrder(Order(2, Side::BUY, OrderType::LIMIT, 0.3, 50));
+
+    EXPECT_EQ(book.getBidLevelCount(), 1u);
+    EXPECT_EQ(book.getQuantityAtPrice(Side::BUY, 0.3), 150u);
+}
@@ -0,0 +1,86 @@
+// ============================================================================
+// TEST_PRICE_ENGINE.CPP - Unit tests for the price model tables and engine
+// ============================================================================
+
+#include <gtest/gtest.h>
+#include "PriceEngine.h"
+
+using namespace orderbook;
+
+// Lookups are compile-time
+static_assert(getSentimentParams(Sentiment::CALM).meanReversion, "CALM mean-reverts");
+static_assert(getIntensityMultiplier(Intensity::NORMAL) == 0.85, "NORMAL price multiplier");
+static_assert(MarketSentimentController::getSentimentNameSimple(Sentiment::CALM)[0] == 'S',
+              "CALM is SIDEWAYS on the wire");
+
+// ============================================================================
+// PARAMETER TABLES
+// ============================================================================
+
+TEST(PriceEngineTest, TablesFollowEnumOrder) {
+    EXPECT_DOUBLE_EQ(getSentimentParams(Sentiment::BULLISH).upProbability, 0.62);
+    EXPECT_DOUBLE_EQ(getSentimentParams(Sentiment::BEARISH).upProbability, 0.38);
+    EXPECT_DOUBLE_EQ(getSentimentParams(Sentiment::VOLATILE).spikeChance, 0.15);
+    EXPECT_TRUE(getSentimentParams(Sentiment::CHOPPY).erratic);
+    EXPECT_EQ(getSentimentParams(Sentiment::NEUTRAL).maxConsecutive, 8);
+
+    EXPECT_DOUBLE_EQ(getIntensityMultiplier(Intensity::MILD), 0.4);
+    EXPECT_DOUBLE_EQ(getIntensityMultiplier(Intensity::EXTREME), 1.25);
+    EXPECT_DOUBLE_EQ(getVolumeMultiplier(Intensity::AGGRESSIVE), 1.2);
+
+    FastRng rng(42);
+    EXPECT_DOUBLE_EQ(getBuyProbability(Sentiment::BULLISH, rng), 0.72);
+    EXPECT_DOUBLE_EQ(getDepthMultipliers(Sentiment::BEARISH, rng).askMultiplier, 1.5);
+}
+
+TEST(PriceEngineTest, ChoppyFlow_StaysInRange) {
+    FastRng rng(42);
+    for (int i = 0; i < 1000; ++i) {
+        double buy = getBuyProbability(Sentiment::CHOPPY, rng);
+        ASSERT_GE(buy, 0.40);
+        ASSERT_LE(buy, 0.60);
+        DepthMultipliers depth = getDepthMultipliers(Sentiment::CHOPPY, rng);
+        ASSERT_GE(depth.bidMultiplier, 0.8);
+        ASSERT_LE(depth.askMultiplier, 1.4);
+    }
+}
+
+// ============================================================================
+// PRICE STEPS
+// ============================================================================
+
+TEST(PriceEngineTest, EveryStepMovesOnTheTickGrid) {
+    for (size_t s = 0; s < SENTIMENT_COUNT; ++s) {
+        for (size_t i = 0; i < INTENSITY_COUNT; ++i) {
+            FastRng rng(s * INTENSITY_COUNT + i + 1);
+            PriceEngine engine(rng);
+            double price = 180.0;
+            for (int tick = 0; tick < 200; ++tick) {
+                PriceResult result = engine.calculateNextPrice(
+                    price, static_cast<Sentiment>(s), static_cast<Intensity>(i), false);
+                ASSERT_NE(Price(result.newPrice), Price(price));
+                ASSERT_EQ(Price(result.newPrice).raw() % DEFAULT_TICK_SIZE.raw(), 0);
+                ASSERT_FALSE(result.shockApplied);
+                price = result.newPrice;
+            }
+        }
+    }
+}
+
+TEST(PriceEngineTest, NewsShock_MovesOneToThreePercent) {
+    FastRng rng(42);
+    PriceEngine engine(rng);
+    double price = 200.0;
+    int shocks = 0;
+    for (int tick = 0; tick < 5000 && shocks < 5; ++tick) {
+        PriceResult result = engine.calculateNextPrice(price, Sentiment::NEUTRAL, Intensity::EXTREME, true);
+        if (result.shockApplied) {
+            ++shocks;
+            EXPECT_GE(result.shockPercent, 0.01 * 1.25 - 1e-12);
+            EXPECT_LE(result.shockPercent, 0.03 * 1.25 + 1e-12);
+            EXPECT_TRUE(result.shockType == "bullish" || result.shockType == "bearish");
+        }
+        price = result.newPrice;
+    }
+    EXPECT_EQ(shocks, 5);
+}
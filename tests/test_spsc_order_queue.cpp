@@ -0,0 +1,189 @@
+// ============================================================================
+// TEST_SPSC_ORDER_QUEUE.CPP - Unit tests for SpscOrderQueue class
+// ============================================================================
+
+#include <gtest/gtest.h>
+#include "SpscOrderQueue.h"
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+using namespace orderbook;
+
+// ============================================================================
+// BASIC QUEUE OPERATIONS
+// ============================================================================
+
+TEST(SpscOrderQueueTest, Capacity_RoundsUpToPowerOfTwo) {
+    SpscOrderQueue queue(100);
+    EXPECT_EQ(queue.capacity(), 128u);
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(SpscOrderQueueTest, FIFO_OrdersReturnedInCorrectOrder) {
+    SpscOrderQueue queue(8);
+    queue.push(Order(1, Side::BUY, OrderType::LIMIT, 100.0, 100));
+    queue.push(Order(2, Side::SELL, OrderType::LIMIT, 101.0, 200));
+    EXPECT_EQ(queue.size(), 2u);
+    
+    auto first = queue.tryPop();
+    auto second = queue.tryPop();
+    
+    ASSERT_TRUE(first.has_value());
+    ASSERT_TRUE(second.has_value());
+    EXPECT_EQ(first->getId(), 1u);
+    EXPECT_EQ(second->getId(), 2u);
+    EXPECT_EQ(second->getSide(), Side::SELL);
+    EXPECT_EQ(second->getQuantity(), 200);
+    EXPECT_FALSE(queue.tryPop().has_value());
+}
+
+TEST(SpscOrderQueueTest, TryPush_FullRing_Fails) {
+    SpscOrderQueue queue(4);
+    for (OrderId id = 0; id < 4; ++id) {
+        EXPECT_TRUE(queue.tryPush(Order(id, Side::BUY, OrderType::LIMIT, 100.0, 1)));
+    }
+    EXPECT_FALSE(queue.tryPush(Order(4, Side::BUY, OrderType::LIMIT, 100.0, 1)));
+    
+    // Freeing one slot makes room again
+    queue.tryPop();
+    EXPECT_TRUE(queue.tryPush(Order(4, Side::BUY, OrderType::LIMIT, 100.0, 1)));
+}
+
+TEST(SpscOrderQueueTest, WrapAround_KeepsOrder) {
+    SpscOrderQueue queue(4);
+    OrderId expected = 0;
+    for (OrderId id = 0; id < 50; ++id) {
+        queue.push(Order(id, Side::BUY, OrderType::LIMIT, 100.0, 1));
+        if (id % 3 == 2) {
+            while (auto order = queue.tryPop()) {
+                EXPECT_EQ(order->getId(), expected++);
+            }
+        }
+    }
+    while (auto order = queue.tryPop()) {
+        EXPECT_EQ(order->getId(), expected++);
+    }
+    EXPECT_EQ(expected, 50u);
+}
+
+TEST(SpscOrderQueueTest, Clear_RemovesAllOrders) {
+    SpscOrderQueue queue(8);
+    queue.push(Order(1, Side::BUY, OrderType::LIMIT, 100.0, 100));
+    queue.push(Order(2, Side::BUY, OrderType::LIMIT, 101.0, 100));
+    
+    queue.clear();
+    
+    EXPECT_TRUE(queue.empty());
+    EXPECT_FALSE(queue.tryPop().has_value());
+}
+
+TEST(SpscOrderQueueTest, PopBatch_DrainsAcrossWrapAround) {
+    SpscOrderQueue queue(4);
+    queue.push(Order(0, Side::BUY, OrderType::LIMIT, 100.0, 1));
+    queue.push(Order(1, Side::BUY, OrderType::LIMIT, 100.0, 1));
+    queue.tryPop();
+    queue.tryPop();
+    for (OrderId id = 2; id < 6; ++id) {    // Slots 2, 3, 0, 1
+        queue.push(Order(id, Side::BUY, OrderType::LIMIT, 100.0, 1));
+    }
+    
+    std::vector<Order> batch;
+    EXPECT_EQ(queue.popBatch(batch, 8, 100), 4u);
+    for (size_t i = 0; i < batch.size(); ++i) {
+        EXPECT_EQ(batch[i].getId(), i + 2);
+    }
+    EXPECT_TRUE(queue.empty());
+    EXPECT_EQ(queue.popBatch(batch, 8, 10), 0u);
+    EXPECT_TRUE(batch.empty());
+}
+
+// ============================================================================
+// WAITING AND SHUTDOWN
+// ============================================================================
+
+TEST(SpscOrderQueueTest, PopWithTimeout_EmptyQueue_ReturnsAfterTimeout) {
+    SpscOrderQueue queue;
+    
+    auto start = std::chrono::steady_clock::now();
+    auto result = queue.popWithTimeout(100);
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - start);
+    
+    EXPECT_FALSE(result.has_value());
+    EXPECT_GE(elapsed.count(), 90);
+}
+
+TEST(SpscOrderQueueTest, PopWithTimeout_WakesParkedConsumer) {
+    SpscOrderQueue queue;
+    
+    std::thread producer([&queue] {
+        // Long enough for the consumer to stop spinning and park
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        queue.push(Order(7, Side::BUY, OrderType::LIMIT, 100.0, 100));
+    });
+    
+    auto start = std::chrono::steady_clock::now();
+    auto result = queue.popWithTimeout(2000);
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - start);
+    producer.join();
+    
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(result->getId(), 7u);
+    EXPECT_LT(elapsed.count(), 1000);
+}
+
+TEST(SpscOrderQueueTest, Shutdown_StopsBlockingPop) {
+    SpscOrderQueue queue;
+    std::optional<Order> result;
+    
+    std::thread consumer([&] { result = queue.pop(); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    queue.shutdown();
+    consumer.join();
+    
+    EXPECT_TRUE(queue.isShutdown());
+    EXPECT_FALSE(result.has_value());
+}
+
+TEST(SpscOrderQueueTest, Shutdown_QueuedOrdersStillDrain) {
+    SpscOrderQueue queue;
+    queue.push(Order(1, Side::BUY, OrderType::LIMIT, 100.0, 100));
+    queue.shutdown();
+    
+    auto result = queue.pop();
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(result->getId(), 1u);
+    EXPECT_FALSE(queue.pop().has_value());
+}
+
+// ============================================================================
+// THREAD SAFETY TESTS
+// ============================================================================
+
+TEST(SpscOrderQueueTest, ThreadSafety_ProducerConsumer_KeepsOrder) {
+    // Small ring so the producer regularly hits back-pressure
+    SpscOrderQueue queue(16);
+    const OrderId totalOrders = 100000;
+    
+    std::thread producer([&queue, totalOrders] {
+        for (OrderId id = 0; id < totalOrders; ++id) {
+            queue.push(Order(id, Side::BUY, OrderType::LIMIT, 100.0, 1));
+        }
+    });
+    
+    OrderId expected = 0;
+    bool inOrder = true;
+    while (expected < totalOrders) {
+        auto order = queue.popWithTimeout(1000);
+        if (!order) break;
+        inOrder = inOrder && order->getId() == expected;
+        expected++;
+    }
+    producer.join();
+    
+    EXPECT_EQ(expected, totalOrders);
+    EXPECT_TRUE(inOrder);
+    EXPECT_TRUE(queue.empty());
+}
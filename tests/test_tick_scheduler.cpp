@@ -0,0 +1,212 @@
+// ============================================================================
+// TEST_TICK_SCHEDULER.CPP - Unit tests for per-session tick deadlines
+// ============================================================================
+
+#include <gtest/gtest.h>
+#include "TickScheduler.h"
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace orderbook;
+using namespace std::chrono_literals;
+
+namespace {
+
+using Clock = TickScheduler::Clock;
+
+std::vector<uint32_t> ids(const std::vector<TickScheduler::Due>& due) {
+    std::vector<uint32_t> result;
+    for (const auto& d : due) result.push_back(d.id);
+    return result;
+}
+
+} // namespace
+
+// ============================================================================
+// DEADLINES
+// ============================================================================
+
+TEST(TickSchedulerTest, DueInDeadlineOrder) {
+    TickScheduler scheduler;
+    Clock::time_point t0 = Clock::now();
+    scheduler.add(1, 100ms, t0 + 30ms);
+    scheduler.add(2, 100ms, t0 + 10ms);
+    scheduler.add(3, 100ms, t0 + 20ms);
+    EXPECT_EQ(scheduler.nextDue(), t0 + 10ms);
+
+    std::vector<TickScheduler::Due> due;
+    scheduler.popDue(t0 + 5ms, due);
+    EXPECT_TRUE(due.empty());
+
+    scheduler.popDue(t0 + 25ms, due);
+    EXPECT_EQ(ids(due), (std::vector<uint32_t>{2, 3}));
+    EXPECT_EQ(due[0].at, t0 + 10ms);
+}
+
+TEST(TickSchedulerTest, PerSessionRates) {
+    TickScheduler scheduler;
+    Clock::time_point t0 = Clock::now();
+    scheduler.add(1, 50ms, t0);    // 2x
+    scheduler.add(2, 400ms, t0);   // 0.25x
+
+    // Step each session on time for 400ms
+    int steps[3] = {0, 0, 0};
+    for (Clock::time_point now = t0; now < t0 + 400ms; now += 10ms) {
+        std::vector<TickScheduler::Due> due;
+        scheduler.popDue(now, due);
+        for (const auto& d : due) {
+            ++steps[d.id];
+            scheduler.complete(d, now);
+        }
+    }
+    EXPECT_EQ(steps[1], 8);
+    EXPECT_EQ(steps[2], 1);
+}
+
+TEST(TickSchedulerTest, InFlightSessionIsNotHandedOutTwice) {
+    TickScheduler scheduler;
+    Clock::time_point t0 = Clock::now();
+    scheduler.add(1, 10ms, t0);
+
+    std::vector<TickScheduler::Due> due;
+    scheduler.popDue(t0, due);
+    ASSERT_EQ(due.size(), 1u);
+    scheduler.popDue(t0 + 1s, due);
+    EXPECT_EQ(due.size(), 1u);
+
+    // Completed late: the missed ticks are skipped, not replayed
+    scheduler.complete(due[0], t0 + 35ms);
+    EXPECT_EQ(scheduler.nextDue(), t0 + 40ms);
+    EXPECT_EQ(scheduler.window().skipped, 3u);
+}
+
+TEST(TickSchedulerTest, RemovedSessionIsDropped) {
+    TickScheduler scheduler;
+    Clock::time_point t0 = Clock::now();
+    scheduler.add(1, 10ms, t0);
+    scheduler.add(2, 10ms, t0);
+
+    std::vector<TickScheduler::Due> due;
+    scheduler.popDue(t0, due);
+    ASSERT_EQ(due.size(), 2u);
+
+    // Removed while in flight: completing it must not bring it back
+    scheduler.remove(1);
+    scheduler.complete(due[0], t0);
+    scheduler.complete(due[1], t0);
+    EXPECT_EQ(scheduler.size(), 1u);
+
+    due.clear();
+    scheduler.popDue(t0 + 1s, due);
+    EXPECT_EQ(ids(due), (std::vector<uint32_t>{2}));
+}
+
+TEST(TickSchedulerTest, ContextComesBackWithEveryDue) {
+    TickScheduler scheduler;
+    Clock::time_point t0 = Clock::now();
+    auto client = std::make_shared<int>(7);
+    std::weak_ptr<int> watch = client;
+    scheduler.add(1, 10ms, t0, client);
+    client.reset();
+
+    for (int tick = 0; tick < 3; ++tick) {
+        std::vector<TickScheduler::Due> due;
+        scheduler.popDue(t0 + tick * 10ms, due);
+        ASSERT_EQ(due.size(), 1u);
+        EXPECT_EQ(*std::static_pointer_cast<int>(due[0].context), 7);
+        scheduler.complete(due[0], t0 + tick * 10ms);
+    }
+
+    // Held until the session is removed
+    EXPECT_FALSE(watch.expired());
+    scheduler.remove(1);
+    EXPECT_TRUE(watch.expired());
+}
+
+TEST(TickSchedulerTest, SetInterval_MovesNextDeadline) {
+    TickScheduler scheduler;
+    Clock::time_point t0 = Clock::now();
+    scheduler.add(1, 400ms, t0);
+
+    std::vector<TickScheduler::Due> due;
+    scheduler.popDue(t0, due);
+    scheduler.complete(due[0], t0);
+    EXPECT_EQ(scheduler.nextDue(), t0 + 400ms);
+
+    // Sped up: due 50ms after the last step (or now, if that has passed)
+    scheduler.setInterval(1, 50ms);
+    EXPECT_LE(scheduler.nextDue(), std::max(Clock::now(), t0 + 50ms));
+}
+
+// ============================================================================
+// DRIFT AND JITTER
+// ============================================================================
+
+TEST(TickSchedulerTest, RecordsDriftAndJitterPerSession) {
+    TickScheduler scheduler;
+    Clock::time_point t0 = Clock::now();
+    scheduler.add(1, 100ms, t0);
+    scheduler.add(2, 100ms, t0);
+
+    // Session 1 runs on time; session 2 starts 4ms late, then 1ms late
+    Clock::time_point late[2] = {t0 + 4ms, t0 + 101ms};
+    for (int tick = 0; tick < 2; ++tick) {
+        std::vector<TickScheduler::Due> due;
+        scheduler.popDue(t0 + tick * 100ms, due);
+        ASSERT_EQ(due.size(), 2u);
+        for (const auto& d : due) {
+            scheduler.complete(d, d.id == 1 ? d.at : late[tick]);
+        }
+    }
+
+    std::vector<SessionTiming> timings = scheduler.sessionTimings();
+    ASSERT_EQ(timings.size(), 2u);
+    EXPECT_EQ(timings[0].steps, 2u);
+    EXPECT_DOUBLE_EQ(timings[0].maxDriftMs, 0.0);
+    EXPECT_DOUBLE_EQ(timings[0].maxJitterMs, 0.0);
+    EXPECT_DOUBLE_EQ(timings[1].maxDriftMs, 4.0);
+    EXPECT_DOUBLE_EQ(timings[1].avgDriftMs, 2.5);
+    EXPECT_DOUBLE_EQ(timings[1].maxJitterMs, 3.0);  // 97ms apart
+
+    TickSchedulerStats stats = scheduler.window();
+    EXPECT_EQ(stats.steps, 4u);
+    EXPECT_EQ(stats.worstSession, 2u);
+
+    scheduler.resetWindow();
+    EXPECT_EQ(scheduler.window().steps, 0u);
+}
+
+// ============================================================================
+// WAITING
+// ============================================================================
+
+TEST(TickSchedulerTest, WaitDue_SleepsUntilEarliestDeadline) {
+    TickScheduler scheduler;
+    Clock::time_point start = Clock::now();
+    scheduler.add(1, 100ms, start + 20ms);
+
+    std::vector<TickScheduler::Due> due;
+    scheduler.waitDue(start + 1s, due);
+    ASSERT_EQ(ids(due), (std::vector<uint32_t>{1}));
+    EXPECT_GE(Clock::now(), start + 20ms);
+    EXPECT_LT(Clock::now(), start + 1s);
+}
+
+TEST(TickSchedulerTest, WaitDue_WokenByNewSession) {
+    TickScheduler scheduler;
+    std::thread adder([&] {
+        std::this_thread::sleep_for(20ms);
+        scheduler.add(7, 100ms, Clock::now());
+    });
+
+    Clock::time_point start = Clock::now();
+    std::vector<TickScheduler::Due> due;
+    while (due.empty() && Clock::now() < start + 5s) {
+        scheduler.waitDue(start + 5s, due);
+    }
+    adder.join();
+    EXPECT_EQ(ids(due), (std::vector<uint32_t>{7}));
+    EXPECT_LT(Clock::now(), start + 5s);
+}
@@ -0,0 +1,121 @@
+// ============================================================================
+// TEST_TOP_OF_BOOK.CPP - Unit tests for the seqlock-published top of book
+// ============================================================================
+
+#include <gtest/gtest.h>
+#include "TopOfBook.h"
+#include "OrderBook.h"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace orderbook;
+
+// ============================================================================
+// SEQLOCK CELL
+// ============================================================================
+
+TEST(TopOfBookSeqlockTest, Read_ReturnsLastPublished) {
+    TopOfBookSeqlock cell;
+    EXPECT_FALSE(cell.read().hasBid());
+    
+    TopOfBook top;
+    top.bestBid = 99.95;
+    top.bidSize = 300;
+    top.bestAsk = 100.05;
+    top.askSize = 200;
+    top.lastTradePrice = 100.0;
+    top.lastTradeQuantity = 10;
+    top.sequence = 42;
+    cell.publish(top);
+    
+    TopOfBook read = cell.read();
+    EXPECT_EQ(read.bestBid, Price(99.95));
+    EXPECT_EQ(read.bidSize, 300u);
+    EXPECT_EQ(read.bestAsk, Price(100.05));
+    EXPECT_EQ(read.askSize, 200u);
+    EXPECT_EQ(read.lastTradePrice, Price(100.0));
+    EXPECT_EQ(read.lastTradeQuantity, 10u);
+    EXPECT_EQ(read.sequence, 42u);
+}
+
+TEST(TopOfBookSeqlockTest, ConcurrentReaders_NeverSeeTornRecord) {
+    // Every published record satisfies ask = bid + 1 tick and
+    // askSize = bidSize = sequence; a torn read would break one of them
+    TopOfBookSeqlock cell;
+    std::atomic<bool> done{false};
+    std::atomic<int> torn{0};
+    
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 2; ++r) {
+        readers.emplace_back([&] {
+            while (!done.load(std::memory_order_relaxed)) {
+                TopOfBook top = cell.read();
+                bool consistent = top.bestAsk == top.bestBid + DEFAULT_TICK_SIZE &&
+                                  top.bidSize == top.askSize &&
+                                  top.bidSize == static_cast<Quantity>(top.sequence);
+                if (top.sequence > 0 && !consistent) torn++;
+            }
+        });
+    }
+    
+    for (uint64_t seq = 1; seq <= 200000; ++seq) {
+        TopOfBook top;
+        top.bestBid = Price::fromRaw(static_cast<int64_t>(seq) * 500);
+        top.bestAsk = top.bestBid + DEFAULT_TICK_SIZE;
+        top.bidSize = top.askSize = static_cast<Quantity>(seq);
+        top.sequence = seq;
+        cell.publish(top);
+    }
+    done = true;
+    for (auto& reader : readers) reader.join();
+    
+    EXPECT_EQ(torn.load(), 0);
+    EXPECT_EQ(cell.read().sequence, 200000u);
+}
+
+// ============================================================================
+// ORDER BOOK PUBLISHING
+// ============================================================================
+
+TEST(OrderBookTopOfBookTest, TracksBestLevelsAndSizes) {
+    OrderBook book;
+    EXPECT_FALSE(book.getTopOfBook().hasBid());
+    EXPECT_FALSE(book.getTopOfBook().hasAsk());
+    
+    book.addOrder(Order(1, Side::BUY, OrderType::LIMIT, 99.0, 100));
+    book.addOrder(Order(2, Side::BUY, OrderType::LIMIT, 99.0, 50));
+    book.addOrder(Order(3, Side::SELL, OrderType::LIMIT, 101.0, 70));
+    
+    TopOfBook top = book.getTopOfBook();
+    EXPECT_EQ(top.bestBid, Price(99.0));
+    EXPECT_EQ(top.bidSize, 150u);
+    EXPECT_EQ(top.bestAsk, Price(101.0));
+    EXPECT_EQ(top.askSize, 70u);
+    EXPECT_EQ(top.sequence, book.getSequence());
+    
+    book.modifyOrderQuantity(2, 20);
+    EXPECT_EQ(book.getTopOfBook().bidSize, 120u);
+    
+    book.cancelOrder(3);
+    EXPECT_FALSE(book.getTopOfBook().hasAsk());
+    EXPECT_FALSE(book.getSpread().has_value());
+}
+
+TEST(OrderBookTopOfBookTest, MatchPublishesLastTrade) {
+    OrderBook book;
+    book.addOrder(Order(1, Side::SELL, OrderType::LIMIT, 100.0, 30));
+    book.addOrder(Order(2, Side::SELL, OrderType::LIMIT, 100.5, 30));
+    EXPECT_EQ(book.getTopOfBook().lastTradeQuantity, 0u);
+    
+    std::vector<Fill> fills;
+    Order taker(3, Side::BUY, OrderType::MARKET, 0.0, 40);
+    book.matchOrder(taker, fills);
+    
+    TopOfBook top = book.getTopOfBook();
+    EXPECT_EQ(top.lastTradePrice, Price(100.5));
+    EXPECT_EQ(top.lastTradeQuantity, 10u);
+    EXPECT_EQ(top.bestAsk, Price(100.5));
+    EXPECT_EQ(top.askSize, 20u);
+    EXPECT_EQ(*book.getBestAsk(), Price(100.5));
+}
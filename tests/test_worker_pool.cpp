@@ -0,0 +1,106 @@
+// ============================================================================
+// TEST_WORKER_POOL.CPP - Unit tests for the work-stealing worker pool
+// ============================================================================
+
+#include <gtest/gtest.h>
+#include "WorkerPool.h"
+#include "TickDeadline.h"
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace orderbook;
+
+// ============================================================================
+// BATCHES
+// ============================================================================
+
+TEST(WorkerPoolTest, EveryIndexRunsOnce) {
+    WorkerPool pool(4);
+    EXPECT_EQ(pool.size(), 4u);
+
+    std::vector<std::atomic<int>> runs(1000);
+    pool.run(runs.size(), [&](size_t i) { runs[i]++; });
+    for (const auto& count : runs) {
+        ASSERT_EQ(count.load(), 1);
+    }
+
+    WorkerPoolStats stats = pool.getStats();
+    EXPECT_EQ(stats.batches, 1u);
+    EXPECT_EQ(stats.tasks, 1000u);
+}
+
+TEST(WorkerPoolTest, SingleWorker_RunsInline) {
+    WorkerPool pool(1);
+    std::vector<size_t> order;
+    std::thread::id caller = std::this_thread::get_id();
+    pool.run(5, [&](size_t i) {
+        EXPECT_EQ(std::this_thread::get_id(), caller);
+        order.push_back(i);
+    });
+    EXPECT_EQ(order, (std::vector<size_t>{0, 1, 2, 3, 4}));
+}
+
+TEST(WorkerPoolTest, EmptyBatch_ReturnsImmediately) {
+    WorkerPool pool(2);
+    pool.run(0, [](size_t) { FAIL(); });
+    EXPECT_EQ(pool.getStats().batches, 0u);
+}
+
+TEST(WorkerPoolTest, BatchesDoNotOverlap) {
+    WorkerPool pool(3);
+    std::atomic<int> batch{0};
+    std::atomic<bool> overlap{false};
+    for (int b = 0; b < 200; ++b) {
+        batch = b;
+        pool.run(8, [&](size_t) {
+            if (batch.load() != b) overlap = true;
+        });
+    }
+    EXPECT_FALSE(overlap);
+    EXPECT_EQ(pool.getStats().tasks, 1600u);
+}
+
+TEST(WorkerPoolTest, UnevenTasks_Stolen) {
+    WorkerPool pool(2);
+
+    // Task 0 holds whichever worker runs it until the rest of the batch is
+    // done: the other worker must take its own range and steal the rest
+    std::atomic<int> others{0};
+    pool.run(8, [&](size_t i) {
+        if (i != 0) {
+            others++;
+            return;
+        }
+        auto giveUp = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (others.load() < 7 && std::chrono::steady_clock::now() < giveUp) {
+            std::this_thread::yield();
+        }
+        EXPECT_EQ(others.load(), 7);
+    });
+    EXPECT_GE(pool.getStats().steals, 3u);
+}
+
+// ============================================================================
+// TICK DEADLINE
+// ============================================================================
+
+TEST(TickDeadlineTest, CountsOverrunsInWindow) {
+    using std::chrono::milliseconds;
+    TickDeadline deadline(milliseconds(50));
+    deadline.record(milliseconds(10), 100);
+    deadline.record(milliseconds(70), 300);
+    deadline.record(milliseconds(30), 200);
+
+    TickDeadlineStats stats = deadline.window();
+    EXPECT_EQ(stats.ticks, 3u);
+    EXPECT_EQ(stats.overruns, 1u);
+    EXPECT_DOUBLE_EQ(stats.avgMs, 110.0 / 3.0);
+    EXPECT_DOUBLE_EQ(stats.maxMs, 70.0);
+    EXPECT_EQ(stats.maxSessions, 300u);
+
+    deadline.reset();
+    EXPECT_EQ(deadline.window().ticks, 0u);
+    EXPECT_EQ(deadline.window().avgMs, 0.0);
+}